@@ -14,6 +14,7 @@
 
 #include "storm/utility/initialize.h"
 #include "storm/utility/Stopwatch.h"
+#include "storm/utility/parallel.h"
 
 #include <type_traits>
 
@@ -34,6 +35,7 @@
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/models/symbolic/StandardRewardModel.h"
 #include "storm/models/symbolic/MarkovAutomaton.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/ResourceSettings.h"
@@ -453,6 +455,14 @@ namespace storm {
                 options.setAddOverlappingGuardsLabel(true);
             }
 
+            if (buildSettings.isSymmetryReductionSet()) {
+                options.setSymmetryReduction(true);
+            }
+
+            if (buildSettings.isGuardCachingSet()) {
+                options.setGuardCaching(true);
+            }
+
             return storm::api::buildSparseModel<ValueType>(input.model.get(), options, useJit, storm::settings::getModule<storm::settings::modules::JitBuilderSettings>().isDoctorSet());
         }
         
@@ -854,36 +864,45 @@ namespace storm {
             }
         };
         
+        typedef std::function<std::unique_ptr<storm::modelchecker::CheckResult>(std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states)> VerificationCallback;
+        
         template<typename ValueType>
-        void verifyProperties(SymbolicInput const& input, std::function<std::unique_ptr<storm::modelchecker::CheckResult>(std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states)> const& verificationCallback, std::function<void(std::unique_ptr<storm::modelchecker::CheckResult> const&)> const& postprocessingCallback = PostprocessingIdentity()) {
+        std::unique_ptr<storm::modelchecker::CheckResult> verifyProperty(storm::jani::Property const& property, VerificationCallback const& verificationCallback, bool& ignored) {
             auto transformationSettings = storm::settings::getModule<storm::settings::modules::TransformationSettings>();
+            ignored = false;
+            std::unique_ptr<storm::modelchecker::CheckResult> result;
+            try {
+                auto rawFormula = property.getRawFormula();
+                if (transformationSettings.isChainEliminationSet() &&
+                    !storm::transformer::NonMarkovianChainTransformer<ValueType>::preservesFormula(*rawFormula)) {
+                    STORM_LOG_WARN("Property is not preserved by elimination of non-markovian states.");
+                    ignored = true;
+                } else if (transformationSettings.isToDiscreteTimeModelSet()) {
+                    auto propertyFormula = storm::api::checkAndTransformContinuousToDiscreteTimeFormula<ValueType>(*property.getRawFormula());
+                    auto filterFormula = storm::api::checkAndTransformContinuousToDiscreteTimeFormula<ValueType>(*property.getFilter().getStatesFormula());
+                    if (propertyFormula && filterFormula) {
+                        result = verificationCallback(propertyFormula, filterFormula);
+                    } else {
+                        ignored = true;
+                    }
+                } else {
+                    result = verificationCallback(property.getRawFormula(),
+                                                  property.getFilter().getStatesFormula());
+                }
+            } catch (storm::exceptions::BaseException const& ex) {
+                STORM_LOG_WARN("Cannot handle property: " << ex.what());
+            }
+            return result;
+        }
+        
+        template<typename ValueType>
+        void verifyProperties(SymbolicInput const& input, VerificationCallback const& verificationCallback, std::function<void(std::unique_ptr<storm::modelchecker::CheckResult> const&)> const& postprocessingCallback = PostprocessingIdentity()) {
             auto const& properties = input.preprocessedProperties ? input.preprocessedProperties.get() : input.properties;
             for (auto const& property : properties) {
                 printModelCheckingProperty(property);
                 bool ignored = false;
                 storm::utility::Stopwatch watch(true);
-                std::unique_ptr<storm::modelchecker::CheckResult> result;
-                try {
-                    auto rawFormula = property.getRawFormula();
-                    if (transformationSettings.isChainEliminationSet() &&
-                        !storm::transformer::NonMarkovianChainTransformer<ValueType>::preservesFormula(*rawFormula)) {
-                        STORM_LOG_WARN("Property is not preserved by elimination of non-markovian states.");
-                        ignored = true;
-                    } else if (transformationSettings.isToDiscreteTimeModelSet()) {
-                        auto propertyFormula = storm::api::checkAndTransformContinuousToDiscreteTimeFormula<ValueType>(*property.getRawFormula());
-                        auto filterFormula = storm::api::checkAndTransformContinuousToDiscreteTimeFormula<ValueType>(*property.getFilter().getStatesFormula());
-                        if (propertyFormula && filterFormula) {
-                            result = verificationCallback(propertyFormula, filterFormula);
-                        } else {
-                            ignored = true;
-                        }
-                    } else {
-                        result = verificationCallback(property.getRawFormula(),
-                                                      property.getFilter().getStatesFormula());
-                    }
-                } catch (storm::exceptions::BaseException const& ex) {
-                    STORM_LOG_WARN("Cannot handle property: " << ex.what());
-                }
+                std::unique_ptr<storm::modelchecker::CheckResult> result = verifyProperty<ValueType>(property, verificationCallback, ignored);
                 watch.stop();
                 if (!ignored) {
                     postprocessingCallback(result);
@@ -892,6 +911,41 @@ namespace storm {
             }
         }
         
+        /*!
+         * Checks the properties concurrently on the given number of threads. The verification callback must be safe to
+         * be called concurrently, in particular it may only read the (shared) model. The results are postprocessed and
+         * printed on the calling thread in the original order of the properties as soon as they become available.
+         */
+        template<typename ValueType>
+        void verifyPropertiesConcurrently(SymbolicInput const& input, uint64_t numberOfThreads, VerificationCallback const& verificationCallback, std::function<void(std::unique_ptr<storm::modelchecker::CheckResult> const&)> const& postprocessingCallback = PostprocessingIdentity()) {
+            auto const& properties = input.preprocessedProperties ? input.preprocessedProperties.get() : input.properties;
+            numberOfThreads = std::min<uint64_t>(numberOfThreads, properties.size());
+            if (numberOfThreads <= 1) {
+                verifyProperties<ValueType>(input, verificationCallback, postprocessingCallback);
+                return;
+            }
+            STORM_LOG_INFO("Checking " << properties.size() << " properties on " << numberOfThreads << " threads.");
+            
+            struct PropertyResult {
+                std::unique_ptr<storm::modelchecker::CheckResult> result;
+                bool ignored;
+                storm::utility::Stopwatch watch;
+            };
+            storm::utility::parallel::computeConcurrentlyInOrder<PropertyResult>(properties.size(), numberOfThreads, [&properties,&verificationCallback] (uint64_t propertyIndex) {
+                PropertyResult propertyResult;
+                propertyResult.watch.start();
+                propertyResult.result = verifyProperty<ValueType>(properties[propertyIndex], verificationCallback, propertyResult.ignored);
+                propertyResult.watch.stop();
+                return propertyResult;
+            }, [&properties,&postprocessingCallback] (uint64_t propertyIndex, PropertyResult& propertyResult) {
+                printModelCheckingProperty(properties[propertyIndex]);
+                if (!propertyResult.ignored) {
+                    postprocessingCallback(propertyResult.result);
+                    printResult<ValueType>(propertyResult.result, properties[propertyIndex], &propertyResult.watch);
+                }
+            });
+        }
+        
         std::vector<storm::expressions::Expression> parseConstraints(storm::expressions::ExpressionManager const& expressionManager, std::string const& constraintsString) {
             std::vector<storm::expressions::Expression> constraints;
             
@@ -988,41 +1042,65 @@ namespace storm {
         void verifyWithSparseEngine(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input, ModelProcessingInformation const& mpi) {
             auto sparseModel = model->as<storm::models::sparse::Model<ValueType>>();
             auto const& ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
-            verifyProperties<ValueType>(input,
-                                        [&sparseModel,&ioSettings,&mpi] (std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states) {
-                                            bool filterForInitialStates = states->isInitialFormula();
-                                            auto task = storm::api::createTask<ValueType>(formula, filterForInitialStates);
-                                            if (ioSettings.isExportSchedulerSet()) {
-                                                task.setProduceSchedulers(true);
-                                            }
-                                            std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngine<ValueType>(mpi.env, sparseModel, task);
-                                            
-                                            std::unique_ptr<storm::modelchecker::CheckResult> filter;
-                                            if (filterForInitialStates) {
-                                                filter = std::make_unique<storm::modelchecker::ExplicitQualitativeCheckResult>(sparseModel->getInitialStates());
-                                            } else {
-                                                filter = storm::api::verifyWithSparseEngine<ValueType>(mpi.env, sparseModel, storm::api::createTask<ValueType>(states, false));
-                                            }
-                                            if (result && filter) {
-                                                result->filter(filter->asQualitativeCheckResult());
-                                            }
-                                            return result;
-                                        },
-                                        [&sparseModel,&ioSettings] (std::unique_ptr<storm::modelchecker::CheckResult> const& result) {
-                                            if (ioSettings.isExportSchedulerSet()) {
-                                                if (result->isExplicitQuantitativeCheckResult()) {
-                                                    if (result->template asExplicitQuantitativeCheckResult<ValueType>().hasScheduler()) {
-                                                        auto const& scheduler = result->template asExplicitQuantitativeCheckResult<ValueType>().getScheduler();
-                                                        STORM_PRINT_AND_LOG("Exporting scheduler ... ")
-                                                        storm::api::exportScheduler(sparseModel, scheduler, ioSettings.getExportSchedulerFilename());
-                                                    } else {
-                                                        STORM_LOG_ERROR("Scheduler requested but could not be generated.");
-                                                    }
-                                                } else {
-                                                    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Scheduler export not supported for this property.");
-                                                }
-                                            }
-                                        });
+            auto const& modelCheckerSettings = storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>();
+            
+            // Parametric computations rely on caches that must not be shared among threads.
+            bool checkConcurrently = modelCheckerSettings.isConcurrentPropertiesSet() && !std::is_same<ValueType, storm::RationalFunction>::value;
+            STORM_LOG_WARN_COND(checkConcurrently || !modelCheckerSettings.isConcurrentPropertiesSet(), "Concurrent checking of properties is not supported for parametric models. Checking properties sequentially.");
+            if (checkConcurrently) {
+                // Trigger the lazily computed parts of the model such that all threads can share it read-only.
+                sparseModel->getTransitionMatrix().getRowGroupIndices();
+                if (sparseModel->isOfType(storm::models::ModelType::MarkovAutomaton)) {
+                    sparseModel->template as<storm::models::sparse::MarkovAutomaton<ValueType>>()->containsZenoCycle();
+                }
+            }
+            
+            VerificationCallback verificationCallback = [&sparseModel,&ioSettings,&mpi,checkConcurrently] (std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states) {
+                // Concurrent checks must not share the environment (and the solvers created from it).
+                boost::optional<storm::Environment> localEnv;
+                if (checkConcurrently) {
+                    localEnv = mpi.env;
+                }
+                storm::Environment const& env = checkConcurrently ? localEnv.get() : mpi.env;
+                
+                bool filterForInitialStates = states->isInitialFormula();
+                auto task = storm::api::createTask<ValueType>(formula, filterForInitialStates);
+                if (ioSettings.isExportSchedulerSet()) {
+                    task.setProduceSchedulers(true);
+                }
+                std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngine<ValueType>(env, sparseModel, task);
+                
+                std::unique_ptr<storm::modelchecker::CheckResult> filter;
+                if (filterForInitialStates) {
+                    filter = std::make_unique<storm::modelchecker::ExplicitQualitativeCheckResult>(sparseModel->getInitialStates());
+                } else {
+                    filter = storm::api::verifyWithSparseEngine<ValueType>(env, sparseModel, storm::api::createTask<ValueType>(states, false));
+                }
+                if (result && filter) {
+                    result->filter(filter->asQualitativeCheckResult());
+                }
+                return result;
+            };
+            auto postprocessingCallback = [&sparseModel,&ioSettings] (std::unique_ptr<storm::modelchecker::CheckResult> const& result) {
+                if (ioSettings.isExportSchedulerSet()) {
+                    if (result->isExplicitQuantitativeCheckResult()) {
+                        if (result->template asExplicitQuantitativeCheckResult<ValueType>().hasScheduler()) {
+                            auto const& scheduler = result->template asExplicitQuantitativeCheckResult<ValueType>().getScheduler();
+                            STORM_PRINT_AND_LOG("Exporting scheduler ... ")
+                            storm::api::exportScheduler(sparseModel, scheduler, ioSettings.getExportSchedulerFilename());
+                        } else {
+                            STORM_LOG_ERROR("Scheduler requested but could not be generated.");
+                        }
+                    } else {
+                        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Scheduler export not supported for this property.");
+                    }
+                }
+            };
+            if (checkConcurrently) {
+                verifyPropertiesConcurrently<ValueType>(input, modelCheckerSettings.getNumberOfConcurrentPropertyThreads(), verificationCallback, postprocessingCallback);
+            } else {
+                verifyProperties<ValueType>(input, verificationCallback, postprocessingCallback);
+            }
         }
         
         template <storm::dd::DdType DdType, typename ValueType>
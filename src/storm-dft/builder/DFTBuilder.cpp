@@ -15,7 +15,7 @@ namespace storm {
     namespace builder {
         
         template<typename ValueType>
-        std::size_t DFTBuilder<ValueType>::mUniqueOffset = 0;
+        std::atomic<std::size_t> DFTBuilder<ValueType>::mUniqueOffset(0);
 
         template<typename ValueType>
         storm::storage::DFT<ValueType> DFTBuilder<ValueType>::build() {
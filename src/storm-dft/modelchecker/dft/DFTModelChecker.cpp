@@ -1,5 +1,9 @@
 #include "DFTModelChecker.h"
 
+#include <atomic>
+#include <future>
+#include <type_traits>
+
 #include "storm/settings/modules/IOSettings.h"
 #include "storm/settings/modules/GeneralSettings.h"
 #include "storm/builder/ParallelCompositionBuilder.h"
@@ -101,20 +105,30 @@ namespace storm {
             // Perform modularisation
             if (dfts.size() > 1) {
                 STORM_LOG_DEBUG("Modularisation of " << dft.getTopLevelGate()->name() << " into " << dfts.size() << " submodules.");
-                // TODO: compute simultaneously
+                property_vector probabilityProperties;
+                for (auto property : properties) {
+                    if (property->isProbabilityOperatorFormula()) {
+                        probabilityProperties.push_back(property);
+                    }
+                }
+                // Recursively call model checking
+                std::vector<dft_results> moduleResults;
+                if (!probabilityProperties.empty()) {
+                    moduleResults = checkModules(dfts, probabilityProperties, symred, relevantEvents);
+                }
+
                 dft_results results;
+                uint64_t propertyIndex = 0;
                 for (auto property : properties) {
                     if (!property->isProbabilityOperatorFormula()) {
                         STORM_LOG_WARN("Could not check property: " << *property);
                     } else {
-                        // Recursively call model checking
                         std::vector<ValueType> res;
-                        for (auto const ft : dfts) {
-                            // TODO: allow approximation in modularisation
-                            dft_results ftResults = checkHelper(ft, {property}, symred, true, relevantEvents, 0.0);
-                            STORM_LOG_ASSERT(ftResults.size() == 1, "Wrong number of results");
-                            res.push_back(boost::get<ValueType>(ftResults[0]));
+                        for (auto const& ftResults : moduleResults) {
+                            STORM_LOG_ASSERT(ftResults.size() == probabilityProperties.size(), "Wrong number of results");
+                            res.push_back(boost::get<ValueType>(ftResults[propertyIndex]));
                         }
+                        ++propertyIndex;
 
                         // Combine modularisation results
                         STORM_LOG_TRACE("Combining all results... K=" << nrK << "; M=" << nrM << "; invResults="
@@ -153,6 +167,64 @@ namespace storm {
             }
         }
 
+        template<typename ValueType>
+        std::vector<typename DFTModelChecker<ValueType>::dft_results> DFTModelChecker<ValueType>::checkModules(std::vector<storm::storage::DFT<ValueType>> const& dfts, property_vector const& properties, bool symred, storm::utility::RelevantEvents const& relevantEvents) {
+            std::vector<dft_results> moduleResults(dfts.size());
+            uint64_t numberOfThreads = 1;
+            if (numberOfModuleThreads) {
+                numberOfThreads = numberOfModuleThreads.get();
+            } else {
+                auto const& ftSettings = storm::settings::getModule<storm::settings::modules::FaultTreeSettings>();
+                if (ftSettings.isConcurrentModulesSet()) {
+                    numberOfThreads = ftSettings.getNumberOfConcurrentModuleThreads();
+                }
+            }
+            numberOfThreads = std::min<uint64_t>(numberOfThreads, dfts.size());
+            if (numberOfThreads > 1 && !std::is_same<ValueType, double>::value) {
+                // The polynomials of parametric values share a global cache that is not thread-safe.
+                STORM_LOG_WARN("Concurrent checking of modules is only supported for double values. Checking the modules sequentially.");
+                numberOfThreads = 1;
+            }
+
+            if (numberOfThreads <= 1) {
+                for (uint64_t module = 0; module < dfts.size(); ++module) {
+                    // TODO: allow approximation in modularisation
+                    moduleResults[module] = checkHelper(dfts[module], properties, symred, true, relevantEvents, 0.0);
+                }
+                return moduleResults;
+            }
+
+            // Each thread has its own checker (and thus its own timers). The modules of the modules are checked sequentially.
+            STORM_LOG_DEBUG("Checking " << dfts.size() << " submodules with " << numberOfThreads << " threads.");
+            std::vector<std::unique_ptr<DFTModelChecker<ValueType>>> moduleCheckers;
+            for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+                moduleCheckers.push_back(std::make_unique<DFTModelChecker<ValueType>>(false));
+                moduleCheckers.back()->setNumberOfModuleThreads(1);
+            }
+            std::atomic<uint64_t> nextModule(0);
+            std::vector<std::future<void>> futures;
+            for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+                DFTModelChecker<ValueType>& moduleChecker = *moduleCheckers[thread];
+                futures.push_back(std::async(std::launch::async, [&nextModule, &moduleResults, &moduleChecker, &dfts, &properties, symred, &relevantEvents] () {
+                    for (uint64_t module = nextModule++; module < dfts.size(); module = nextModule++) {
+                        moduleResults[module] = moduleChecker.checkHelper(dfts[module], properties, symred, true, relevantEvents, 0.0);
+                    }
+                }));
+            }
+            for (auto& future : futures) {
+                future.get();
+            }
+
+            // The timings of the modules are accumulated, i.e., they can exceed the total time.
+            for (auto const& moduleChecker : moduleCheckers) {
+                explorationTimer.add(moduleChecker->explorationTimer);
+                buildingTimer.add(moduleChecker->buildingTimer);
+                bisimulationTimer.add(moduleChecker->bisimulationTimer);
+                modelCheckingTimer.add(moduleChecker->modelCheckingTimer);
+            }
+            return moduleResults;
+        }
+
         template<typename ValueType>
         std::shared_ptr<storm::models::sparse::Ctmc<ValueType>>
         DFTModelChecker<ValueType>::buildModelViaComposition(storm::storage::DFT<ValueType> const &dft, property_vector const &properties, bool symred, bool allowModularisation, storm::utility::RelevantEvents const& relevantEvents) {
@@ -1,5 +1,7 @@
 #pragma  once
 
+#include <boost/optional.hpp>
+
 #include "storm/logic/Formula.h"
 #include "storm/modelchecker/results/CheckResult.h"
 #include "storm/api/storm.h"
@@ -40,6 +42,16 @@ namespace storm {
             DFTModelChecker(bool printOutput) : printInfo(printOutput) {
             }
 
+            /*!
+             * Sets the number of threads with which independent modules are checked (instead of taking it from the
+             * settings). Modules are only checked concurrently for double values.
+             *
+             * @param numberOfThreads Number of threads. Value 1 disables the concurrent checking.
+             */
+            void setNumberOfModuleThreads(uint64_t numberOfThreads) {
+                numberOfModuleThreads = numberOfThreads;
+            }
+
             /*!
              * Main method for checking DFTs.
              *
@@ -77,6 +89,9 @@ namespace storm {
 
             bool printInfo;
 
+            // The number of threads with which independent modules are checked (if not set, it is taken from the settings).
+            boost::optional<uint64_t> numberOfModuleThreads;
+
             // Timing values
             storm::utility::Stopwatch buildingTimer;
             storm::utility::Stopwatch explorationTimer;
@@ -102,6 +117,17 @@ namespace storm {
                                     double approximationError = 0.0, storm::builder::ApproximationHeuristic approximationHeuristic = storm::builder::ApproximationHeuristic::DEPTH,
                                     bool eliminateChains = false, storm::transformer::EliminationLabelBehavior labelBehavior = storm::transformer::EliminationLabelBehavior::KeepLabels);
 
+            /*!
+             * Internal helper for checking the independent modules of a DFT. If enabled, the modules are checked concurrently.
+             *
+             * @param dfts The modules.
+             * @param properties Properties to check for.
+             * @param symred Flag indicating if symmetry reduction should be used.
+             * @param relevantEvents Relevant events which should be observed.
+             * @return For each module, the model checking results for the given properties.
+             */
+            std::vector<dft_results> checkModules(std::vector<storm::storage::DFT<ValueType>> const& dfts, property_vector const& properties, bool symred, storm::utility::RelevantEvents const& relevantEvents);
+
             /*!
              * Internal helper for building a CTMC from a DFT via parallel composition.
              *
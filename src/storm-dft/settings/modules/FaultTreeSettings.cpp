@@ -9,6 +9,7 @@
 #include "storm/exceptions/IllegalArgumentValueException.h"
 #include "storm/exceptions/InvalidSettingsException.h"
 #include "storm/parser/CSVParser.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
     namespace settings {
@@ -28,6 +29,7 @@ namespace storm {
             const std::string FaultTreeSettings::maxDepthOptionName = "maxdepth";
             const std::string FaultTreeSettings::firstDependencyOptionName = "firstdep";
             const std::string FaultTreeSettings::uniqueFailedBEOptionName = "uniquefailedbe";
+            const std::string FaultTreeSettings::concurrentModulesOptionName = "concurrent-modules";
 #ifdef STORM_HAVE_Z3
             const std::string FaultTreeSettings::solveWithSmtOptionName = "smt";
 #endif
@@ -59,6 +61,8 @@ namespace storm {
                         storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("depth", "The maximal depth.").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, uniqueFailedBEOptionName, false,
                                                                "Use a unique constantly failed BE.").build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, concurrentModulesOptionName, false, "Analyse the independent modules obtained by modularisation concurrently.")
+                                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("threads", "The number of threads (0 means 'auto-detect').").setDefaultValueUnsignedInteger(0).makeOptional().build()).build());
 #ifdef STORM_HAVE_Z3
                 this->addOption(storm::settings::OptionBuilder(moduleName, solveWithSmtOptionName, true, "Solve the DFT with SMT.").build());
 #endif
@@ -129,6 +133,14 @@ namespace storm {
                 return this->getOption(uniqueFailedBEOptionName).getHasOptionBeenSet();
             }
 
+            bool FaultTreeSettings::isConcurrentModulesSet() const {
+                return this->getOption(concurrentModulesOptionName).getHasOptionBeenSet();
+            }
+
+            uint64_t FaultTreeSettings::getNumberOfConcurrentModuleThreads() const {
+                return storm::utility::parallel::resolveNumberOfThreads(this->getOption(concurrentModulesOptionName).getArgumentByName("threads").getValueAsUnsignedInteger());
+            }
+
 #ifdef STORM_HAVE_Z3
 
             bool FaultTreeSettings::solveWithSMT() const {
@@ -117,6 +117,21 @@ namespace storm {
                   */
                 bool isUniqueFailedBE() const;
 
+                /*!
+                 * Retrieves whether the independent modules of a DFT should be analysed concurrently.
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool isConcurrentModulesSet() const;
+
+                /*!
+                 * Retrieves the number of threads used to analyse independent modules. If the user did not specify a
+                 * number, the number of hardware threads is returned.
+                 *
+                 * @return The number of threads.
+                 */
+                uint64_t getNumberOfConcurrentModuleThreads() const;
+
 #ifdef STORM_HAVE_Z3
 
                 /*!
@@ -150,6 +165,7 @@ namespace storm {
                 static const std::string maxDepthOptionName;
                 static const std::string firstDependencyOptionName;
                 static const std::string uniqueFailedBEOptionName;
+                static const std::string concurrentModulesOptionName;
 #ifdef STORM_HAVE_Z3
                 static const std::string solveWithSmtOptionName;
 #endif
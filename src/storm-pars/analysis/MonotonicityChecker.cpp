@@ -18,6 +18,9 @@
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm-pars/modelchecker/region/SparseDtmcParameterLiftingModelChecker.h"
 
+#include <algorithm>
+#include <unordered_map>
+
 
 
 namespace storm {
@@ -29,6 +32,7 @@ namespace storm {
             this->formulas = formulas;
             this->validate = validate;
             this->precision = precision;
+            this->numberOfDerivativeCacheHits = 0;
             std::shared_ptr<storm::models::sparse::Model<ValueType>> sparseModel = model->as<storm::models::sparse::Model<ValueType>>();
 
             if (regions.size() == 1) {
@@ -299,6 +303,199 @@ namespace storm {
             return result;
         }
 
+        namespace {
+            template <typename CoefficientType>
+            std::pair<CoefficientType, CoefficientType> multiplyBounds(std::pair<CoefficientType, CoefficientType> const& first, std::pair<CoefficientType, CoefficientType> const& second) {
+                std::vector<CoefficientType> products = {first.first * second.first, first.first * second.second, first.second * second.first, first.second * second.second};
+                return std::make_pair(*std::min_element(products.begin(), products.end()), *std::max_element(products.begin(), products.end()));
+            }
+
+            template <typename CoefficientType>
+            std::pair<CoefficientType, CoefficientType> powerBounds(std::pair<CoefficientType, CoefficientType> const& bounds, uint_fast64_t exponent) {
+                CoefficientType lower = storm::utility::pow(bounds.first, exponent);
+                CoefficientType upper = storm::utility::pow(bounds.second, exponent);
+                if (exponent % 2 == 1) {
+                    // Odd powers are monotone.
+                    return std::make_pair(lower, upper);
+                }
+                if (bounds.first >= storm::utility::zero<CoefficientType>()) {
+                    return std::make_pair(lower, upper);
+                } else if (bounds.second <= storm::utility::zero<CoefficientType>()) {
+                    return std::make_pair(upper, lower);
+                }
+                return std::make_pair(storm::utility::zero<CoefficientType>(), std::max(lower, upper));
+            }
+
+            template <typename PolynomialType, typename ValueType>
+            std::pair<typename storm::storage::ParameterRegion<ValueType>::CoefficientType, typename storm::storage::ParameterRegion<ValueType>::CoefficientType> evaluateBounds(PolynomialType const& polynomial, storm::storage::ParameterRegion<ValueType> const& reg) {
+                typedef typename storm::storage::ParameterRegion<ValueType>::CoefficientType CoefficientType;
+                std::pair<CoefficientType, CoefficientType> result(storm::utility::zero<CoefficientType>(), storm::utility::zero<CoefficientType>());
+                std::set<typename utility::parametric::VariableType<ValueType>::type> termVariables;
+                for (auto itr = polynomial.begin(); itr != polynomial.end(); ++itr) {
+                    CoefficientType coefficient = itr->coeff();
+                    std::pair<CoefficientType, CoefficientType> termBounds(coefficient, coefficient);
+                    if (!itr->isConstant()) {
+                        termVariables.clear();
+                        itr->gatherVariables(termVariables);
+                        for (auto const& var : termVariables) {
+                            std::pair<CoefficientType, CoefficientType> variableBounds(reg.getLowerBoundary(var), reg.getUpperBoundary(var));
+                            termBounds = multiplyBounds(termBounds, powerBounds(variableBounds, itr->monomial()->exponentOfVariable(var)));
+                        }
+                    }
+                    result.first += termBounds.first;
+                    result.second += termBounds.second;
+                }
+                return result;
+            }
+        }
+
+        template <typename ValueType>
+        std::pair<bool, bool> MonotonicityChecker<ValueType>::checkDerivative(ValueType derivative, storm::storage::ParameterRegion<ValueType> reg) {
+            bool monIncr = false;
+            bool monDecr = false;
+
+            if (derivative.isZero()) {
+                monIncr = true;
+                monDecr = true;
+            } else if (derivative.isConstant()) {
+                monIncr = derivative.constantPart() >= 0;
+                monDecr = derivative.constantPart() <= 0;
+            } else {
+                boost::optional<std::pair<bool, bool>> boundsResult = checkDerivativeOnBounds(derivative, reg);
+                std::pair<bool, bool> result;
+                if (boundsResult) {
+                    result = boundsResult.get();
+                } else {
+                    std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
+                    storm::solver::Z3SmtSolver s(*manager);
+                    result = checkDerivativeWithSmt(derivative, reg, manager, s);
+                }
+                monIncr = result.first;
+                monDecr = result.second;
+            }
+            assert (!(monIncr && monDecr) || derivative.isZero());
+
+            return std::pair<bool, bool>(monIncr, monDecr);
+        }
+
+        template <typename ValueType>
+        std::pair<bool, bool> MonotonicityChecker<ValueType>::checkDerivativeOnRegion(ValueType const& derivative) {
+            if (derivative.isConstant()) {
+                return checkDerivative(derivative, region);
+            }
+
+            // The same derivatives are typically checked for many states, so we remember the results.
+            auto cacheIt = derivativeCheckResults.find(derivative);
+            if (cacheIt != derivativeCheckResults.end()) {
+                ++numberOfDerivativeCacheHits;
+                return cacheIt->second;
+            }
+
+            boost::optional<std::pair<bool, bool>> boundsResult = checkDerivativeOnBounds(derivative, region);
+            std::pair<bool, bool> result;
+            if (boundsResult) {
+                result = boundsResult.get();
+            } else {
+                if (!smtSolver) {
+                    smtManager = std::make_shared<storm::expressions::ExpressionManager>();
+                    smtSolver = std::make_unique<storm::solver::Z3SmtSolver>(*smtManager);
+                }
+                result = checkDerivativeWithSmt(derivative, region, smtManager, *smtSolver);
+            }
+            derivativeCheckResults.emplace(derivative, result);
+            return result;
+        }
+
+        template <typename ValueType>
+        uint_fast64_t MonotonicityChecker<ValueType>::getNumberOfDerivativeCacheHits() const {
+            return numberOfDerivativeCacheHits;
+        }
+
+        template <typename ValueType>
+        boost::optional<std::pair<bool, bool>> MonotonicityChecker<ValueType>::checkDerivativeOnBounds(ValueType const& derivative, storm::storage::ParameterRegion<ValueType> const& reg) {
+            typedef typename storm::storage::ParameterRegion<ValueType>::CoefficientType CoefficientType;
+
+            // The bounds are only meaningful if all variables are bounded by the region and the region is not
+            // degenerate (as the derivative is considered on its interior).
+            for (auto const& variable : derivative.gatherVariables()) {
+                if (reg.getVariables().find(variable) == reg.getVariables().end() || reg.getLowerBoundary(variable) >= reg.getUpperBoundary(variable)) {
+                    return boost::none;
+                }
+            }
+
+            std::pair<CoefficientType, CoefficientType> denominatorBounds = evaluateBounds(derivative.denominator().polynomialWithCoefficient(), reg);
+            bool positiveDenominator;
+            if (denominatorBounds.first > storm::utility::zero<CoefficientType>()) {
+                positiveDenominator = true;
+            } else if (denominatorBounds.second < storm::utility::zero<CoefficientType>()) {
+                positiveDenominator = false;
+            } else {
+                return boost::none;
+            }
+
+            // As all monomials are non-negative on non-negative regions, this also covers the sign-of-coefficients test.
+            std::pair<CoefficientType, CoefficientType> nominatorBounds = evaluateBounds(derivative.nominator().polynomialWithCoefficient(), reg);
+            bool nonNegativeNominator = nominatorBounds.first >= storm::utility::zero<CoefficientType>();
+            bool nonPositiveNominator = nominatorBounds.second <= storm::utility::zero<CoefficientType>();
+            if (nonNegativeNominator == nonPositiveNominator) {
+                return boost::none;
+            }
+
+            // A non-constant derivative cannot be both >= 0 and <= 0 on the interior of the region.
+            bool nonNegative = positiveDenominator ? nonNegativeNominator : nonPositiveNominator;
+            return std::make_pair(nonNegative, !nonNegative);
+        }
+
+        template <typename ValueType>
+        std::pair<bool, bool> MonotonicityChecker<ValueType>::checkDerivativeWithSmt(ValueType const& derivative, storm::storage::ParameterRegion<ValueType> const& reg, std::shared_ptr<storm::expressions::ExpressionManager> const& manager, storm::solver::SmtSolver& s) {
+            // The individual queries are scoped using backtracking points, so the solver can be reused across calls.
+
+            std::set<typename utility::parametric::VariableType<ValueType>::type> variables = derivative.gatherVariables();
+            for (auto variable : variables) {
+                if (!manager->hasVariable(variable.name())) {
+                    manager->declareRationalVariable(variable.name());
+                }
+            }
+            storm::expressions::Expression exprBounds = manager->boolean(true);
+            for (auto variable : variables) {
+                auto var = manager->getVariable(variable.name());
+                auto lb = storm::utility::convertNumber<storm::RationalNumber>(reg.getLowerBoundary(var.getName()));
+                auto ub = storm::utility::convertNumber<storm::RationalNumber>(reg.getUpperBoundary(var.getName()));
+                exprBounds = exprBounds && manager->rational(lb) < var && var < manager->rational(ub);
+            }
+
+            auto converter = storm::expressions::RationalFunctionToExpression<ValueType>(manager);
+            storm::expressions::Expression derivativeExpr = converter.toExpression(derivative);
+
+            bool monIncr;
+            bool monDecr;
+            try {
+                s.push();
+                s.add(exprBounds);
+                assert (s.check() == storm::solver::SmtSolver::CheckResult::Sat);
+
+                // < 0 so not monotone increasing. If it is unsatisfiable then it should be monotone increasing
+                s.push();
+                s.add(derivativeExpr < manager->rational(0));
+                monIncr = s.check() == storm::solver::SmtSolver::CheckResult::Unsat;
+                s.pop();
+
+                // > 0 so not monotone decreasing
+                s.push();
+                s.add(derivativeExpr > manager->rational(0));
+                monDecr = s.check() == storm::solver::SmtSolver::CheckResult::Unsat;
+                s.pop();
+
+                s.pop();
+            } catch (...) {
+                // Make sure no assertions of this query survive.
+                s.reset();
+                throw;
+            }
+
+            return std::pair<bool, bool>(monIncr, monDecr);
+        }
+
         template <typename ValueType>
         ValueType MonotonicityChecker<ValueType>::getDerivative(ValueType function, typename utility::parametric::VariableType<ValueType>::type var) {
             if (function.isConstant()) {
@@ -384,7 +581,7 @@ namespace storm {
                                             // As the first state (itr2) is above the second state (itr3) it
                                             // is sufficient to look at the derivative of itr2.
                                             std::pair<bool, bool> mon2;
-                                            mon2 = checkDerivative(derivative2, region);
+                                            mon2 = checkDerivativeOnRegion(derivative2);
                                             value->first &= mon2.first;
                                             value->second &= mon2.second;
                                         } else if (compare == Order::BELOW) {
@@ -392,7 +589,7 @@ namespace storm {
                                             // is sufficient to look at the derivative of itr3.
                                             std::pair<bool, bool> mon3;
 
-                                            mon3 = checkDerivative(derivative3, region);
+                                            mon3 = checkDerivativeOnRegion(derivative3);
                                             value->first &= mon3.first;
                                             value->second &= mon3.second;
                                         } else if (compare == Order::SAME) {
@@ -417,7 +614,7 @@ namespace storm {
                             std::pair<bool, bool> *value = &varsMonotone.find(var)->second;
                             bool change = false;
                             for (auto const &i : sortedStates) {
-                                auto res = checkDerivative(getDerivative(transitions[i], var), region);
+                                auto res = checkDerivativeOnRegion(getDerivative(transitions[i], var));
                                 change = change || (!(value->first && value->second) // they do not hold both
                                                     && ((value->first && !res.first)
                                                         || (value->second && !res.second)));
@@ -502,7 +699,7 @@ namespace storm {
                                         // As the first state (itr2) is above the second state (itr3) it
                                         // is sufficient to look at the derivative of itr2.
                                         std::pair<bool, bool> mon2;
-                                        mon2 = checkDerivative(derivative2, region);
+                                        mon2 = checkDerivativeOnRegion(derivative2);
                                         value->first &= mon2.first;
                                         value->second &= mon2.second;
                                     } else if (compare == Order::BELOW) {
@@ -510,7 +707,7 @@ namespace storm {
                                         // is sufficient to look at the derivative of itr3.
                                         std::pair<bool, bool> mon3;
 
-                                        mon3 = checkDerivative(derivative3, region);
+                                        mon3 = checkDerivativeOnRegion(derivative3);
                                         value->first &= mon3.first;
                                         value->second &= mon3.second;
                                     } else if (compare == Order::SAME) {
@@ -2,6 +2,7 @@
 #define STORM_MONOTONICITYCHECKER_H
 
 #include <map>
+#include <boost/optional.hpp>
 #include "Order.h"
 #include "OrderExtender.h"
 #include "AssumptionMaker.h"
@@ -50,69 +51,41 @@ namespace storm {
 
             /*!
              * Checks if a derivative >=0 or/and <=0
+             * The sign is first bounded using interval arithmetic over the region and only if this is inconclusive,
+             * an SMT solver is queried.
              * @param derivative The derivative you want to check
+             * @param reg The region on which the derivative is considered
              * @return pair of bools, >= 0 and <= 0
              */
-            static std::pair<bool, bool> checkDerivative(ValueType derivative, storm::storage::ParameterRegion<ValueType> reg) {
-                bool monIncr = false;
-                bool monDecr = false;
-
-                if (derivative.isZero()) {
-                    monIncr = true;
-                    monDecr = true;
-                } else if (derivative.isConstant()) {
-                    monIncr = derivative.constantPart() >= 0;
-                    monDecr = derivative.constantPart() <= 0;
-                } else {
-
-                    std::shared_ptr<storm::utility::solver::SmtSolverFactory> smtSolverFactory = std::make_shared<storm::utility::solver::MathsatSmtSolverFactory>();
-                    std::shared_ptr<storm::expressions::ExpressionManager> manager(
-                            new storm::expressions::ExpressionManager());
-
-                    storm::solver::Z3SmtSolver s(*manager);
-
-                    std::set<typename utility::parametric::VariableType<ValueType>::type> variables = derivative.gatherVariables();
-
-
-                    for (auto variable : variables) {
-                        manager->declareRationalVariable(variable.name());
-
-                    }
-                    storm::expressions::Expression exprBounds = manager->boolean(true);
-                    auto managervars = manager->getVariables();
-                    for (auto var : managervars) {
-                        auto lb = storm::utility::convertNumber<storm::RationalNumber>(reg.getLowerBoundary(var.getName()));
-                        auto ub = storm::utility::convertNumber<storm::RationalNumber>(reg.getUpperBoundary(var.getName()));
-                        exprBounds = exprBounds && manager->rational(lb) < var && var < manager->rational(ub);
-                    }
-                    assert (s.check() == storm::solver::SmtSolver::CheckResult::Sat);
-
-                    auto converter = storm::expressions::RationalFunctionToExpression<ValueType>(manager);
-
-                    // < 0 so not monotone increasing
-                    storm::expressions::Expression exprToCheck =
-                            converter.toExpression(derivative) < manager->rational(0);
-                    s.add(exprBounds);
-                    s.add(exprToCheck);
-                    // If it is unsatisfiable then it should be monotone increasing
-                    monIncr = s.check() == storm::solver::SmtSolver::CheckResult::Unsat;
-
-                    // > 0 so not monotone decreasing
-                    exprToCheck =
-                            converter.toExpression(derivative) > manager->rational(0);
-
-                    s.reset();
-                    s.add(exprBounds);
-                    assert (s.check() == storm::solver::SmtSolver::CheckResult::Sat);
-                    s.add(exprToCheck);
-                    monDecr = s.check() == storm::solver::SmtSolver::CheckResult::Unsat;
-                }
-                assert (!(monIncr && monDecr) || derivative.isZero());
-
-                return std::pair<bool, bool>(monIncr, monDecr);
-            }
+            static std::pair<bool, bool> checkDerivative(ValueType derivative, storm::storage::ParameterRegion<ValueType> reg);
+
+            /*!
+             * Checks if a derivative >=0 or/and <=0 on the region of this checker.
+             * Results are cached per derivative and the SMT solver is reused across calls.
+             * @param derivative The derivative you want to check
+             * @return pair of bools, >= 0 and <= 0
+             */
+            std::pair<bool, bool> checkDerivativeOnRegion(ValueType const& derivative);
+
+            /*!
+             * Retrieves how many derivative checks on the region of this checker were answered from the cache.
+             */
+            uint_fast64_t getNumberOfDerivativeCacheHits() const;
 
         private:
+            /*!
+             * Tries to determine the sign of a non-constant derivative by bounding it with interval arithmetic.
+             * @return pair of bools, >= 0 and <= 0, or none if the bounds are inconclusive
+             */
+            static boost::optional<std::pair<bool, bool>> checkDerivativeOnBounds(ValueType const& derivative, storm::storage::ParameterRegion<ValueType> const& reg);
+
+            /*!
+             * Determines the sign of a non-constant derivative using the given SMT solver (whose assertions are left
+             * unchanged). The solver has to be built over the given expression manager.
+             * @return pair of bools, >= 0 and <= 0
+             */
+            static std::pair<bool, bool> checkDerivativeWithSmt(ValueType const& derivative, storm::storage::ParameterRegion<ValueType> const& reg, std::shared_ptr<storm::expressions::ExpressionManager> const& manager, storm::solver::SmtSolver& solver);
+
             std::map<storm::analysis::Order*, std::map<typename utility::parametric::VariableType<ValueType>::type, std::pair<bool, bool>>> checkMonotonicity(std::ostream& outfile, std::map<storm::analysis::Order*, std::vector<std::shared_ptr<storm::expressions::BinaryRelationExpression>>> map, storm::storage::SparseMatrix<ValueType> matrix);
 
             std::map<typename utility::parametric::VariableType<ValueType>::type, std::pair<bool, bool>> analyseMonotonicity(uint_fast64_t i, Order* order, storm::storage::SparseMatrix<ValueType> matrix) ;
@@ -144,6 +117,16 @@ namespace storm {
             double precision;
 
             storm::storage::ParameterRegion<ValueType> region;
+
+            // The results of the derivative checks on the region.
+            std::unordered_map<ValueType, std::pair<bool, bool>> derivativeCheckResults;
+
+            uint_fast64_t numberOfDerivativeCacheHits;
+
+            // The expression manager and solver used for derivative checks on the region (created on demand).
+            std::shared_ptr<storm::expressions::ExpressionManager> smtManager;
+
+            std::unique_ptr<storm::solver::Z3SmtSolver> smtSolver;
         };
     }
 }
@@ -4,6 +4,9 @@
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
+#include "storm/modelchecker/reachability/SparseDtmcEliminationModelChecker.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/EliminationSettings.h"
 #include "storm/utility/vector.h"
 
 #include "storm/exceptions/InvalidArgumentException.h"
@@ -16,9 +19,20 @@ namespace storm {
             //Intentionally left empty
         }
 
+        template <typename SparseModelType, typename ConstantType>
+        void SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::specifyFormula(CheckTask<storm::logic::Formula, typename SparseModelType::ValueType> const& checkTask) {
+            SparseInstantiationModelChecker<SparseModelType, ConstantType>::specifyFormula(checkTask);
+            straightLineProgram = boost::none;
+            straightLineProgramNodes.clear();
+        }
+
         template <typename SparseModelType, typename ConstantType>
         std::unique_ptr<CheckResult> SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::check(Environment const& env, storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) {
             STORM_LOG_THROW(this->currentCheckTask, storm::exceptions::InvalidStateException, "Checking has been invoked but no property has been specified before.");
+            if (canUseStraightLineProgram()) {
+                // The program is evaluated directly, so there is no need to instantiate the model.
+                return checkReachabilityProbabilityFormulaWithStraightLineProgram(valuation);
+            }
             auto const& instantiatedModel = modelInstantiator.instantiate(valuation);
             STORM_LOG_THROW(instantiatedModel.getTransitionMatrix().isProbabilistic(), storm::exceptions::InvalidArgumentException, "Instantiation point is invalid as the transition matrix becomes non-stochastic.");
             storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>> modelChecker(instantiatedModel);
@@ -162,6 +176,62 @@ namespace storm {
             return result;
         }
         
+        template <typename SparseModelType, typename ConstantType>
+        bool SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::canUseStraightLineProgram() const {
+            // The elimination is performed on the graph of the parametric model, which is only valid for graph-preserving instantiations.
+            if (!storm::settings::getModule<storm::settings::modules::EliminationSettings>().isUseStraightLineProgramSet() || !this->getInstantiationsAreGraphPreserving() || !this->currentCheckTask->isOnlyInitialStatesRelevantSet()) {
+                return false;
+            }
+            storm::logic::Formula const& formula = this->currentCheckTask->getFormula();
+            if (!formula.isProbabilityOperatorFormula()) {
+                return false;
+            }
+            storm::logic::Formula const& pathFormula = formula.asProbabilityOperatorFormula().getSubformula();
+            if (pathFormula.isUntilFormula()) {
+                return pathFormula.asUntilFormula().getLeftSubformula().isInFragment(storm::logic::propositional()) && pathFormula.asUntilFormula().getRightSubformula().isInFragment(storm::logic::propositional());
+            }
+            return pathFormula.isEventuallyFormula() && pathFormula.asEventuallyFormula().getSubformula().isInFragment(storm::logic::propositional());
+        }
+        
+        template <typename SparseModelType, typename ConstantType>
+        std::unique_ptr<CheckResult> SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::checkReachabilityProbabilityFormulaWithStraightLineProgram(storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) {
+            typedef typename SparseModelType::ValueType ParametricType;
+            storm::logic::OperatorFormula const& operatorFormula = this->currentCheckTask->getFormula().asOperatorFormula();
+            
+            if (!straightLineProgram) {
+                // Determine the phi and psi states on the parametric model and record the elimination once.
+                storm::modelchecker::SparseDtmcPrctlModelChecker<SparseModelType> parametricModelChecker(this->parametricModel);
+                storm::logic::Formula const& pathFormula = operatorFormula.getSubformula();
+                storm::storage::BitVector phiStates(this->parametricModel.getNumberOfStates(), true);
+                storm::storage::BitVector psiStates;
+                if (pathFormula.isUntilFormula()) {
+                    phiStates = parametricModelChecker.check(pathFormula.asUntilFormula().getLeftSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+                    psiStates = parametricModelChecker.check(pathFormula.asUntilFormula().getRightSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+                } else {
+                    psiStates = parametricModelChecker.check(pathFormula.asEventuallyFormula().getSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+                }
+                
+                straightLineProgram = storm::storage::StraightLineProgram<ParametricType>();
+                straightLineProgramNodes = storm::modelchecker::SparseDtmcEliminationModelChecker<SparseModelType>::computeUntilProbabilitiesAsStraightLineProgram(this->parametricModel.getTransitionMatrix(), this->parametricModel.getBackwardTransitions(), this->parametricModel.getInitialStates(), phiStates, psiStates, straightLineProgram.get());
+                STORM_LOG_INFO("Recorded the elimination as a straight-line program with " << straightLineProgram->getNumberOfNodes() << " nodes.");
+            }
+            
+            std::vector<ConstantType> values = straightLineProgram->template evaluate<ConstantType>(straightLineProgramNodes, [&valuation] (ParametricType const& function) {
+                return storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(function, valuation));
+            });
+            
+            std::unique_ptr<ExplicitQuantitativeCheckResult<ConstantType>> quantitativeResult = std::make_unique<ExplicitQuantitativeCheckResult<ConstantType>>();
+            auto valueIt = values.begin();
+            for (auto state : this->parametricModel.getInitialStates()) {
+                (*quantitativeResult)[state] = *valueIt;
+                ++valueIt;
+            }
+            if (operatorFormula.hasQuantitativeResult()) {
+                return std::move(quantitativeResult); // move() required by, e.g., clang 3.8
+            }
+            return quantitativeResult->compareAgainstBound(operatorFormula.getComparisonType(), operatorFormula.template getThresholdAs<ConstantType>());
+        }
+        
         template class SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double>;
         template class SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, storm::RationalNumber>;
 
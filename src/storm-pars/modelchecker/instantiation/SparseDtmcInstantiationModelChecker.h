@@ -8,6 +8,7 @@
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
+#include "storm/storage/StraightLineProgram.h"
 
 namespace storm {
     namespace modelchecker {
@@ -20,6 +21,8 @@ namespace storm {
         public:
             SparseDtmcInstantiationModelChecker(SparseModelType const& parametricModel);
             
+            virtual void specifyFormula(CheckTask<storm::logic::Formula, typename SparseModelType::ValueType> const& checkTask) override;
+            
             virtual std::unique_ptr<CheckResult> check(Environment const& env, storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) override;
 
         protected:
@@ -29,6 +32,16 @@ namespace storm {
             std::unique_ptr<CheckResult> checkReachabilityRewardFormula(Environment const& env, storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>>& modelChecker);
             std::unique_ptr<CheckResult> checkBoundedUntilFormula(Environment const& env, storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>>& modelChecker);
             
+            // Checks whether the current formula is an (unbounded) reachability probability that can be obtained by evaluating a straight-line program
+            bool canUseStraightLineProgram() const;
+            
+            // Evaluates the straight-line program for the current formula (and builds it on the first call)
+            std::unique_ptr<CheckResult> checkReachabilityProbabilityFormulaWithStraightLineProgram(storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation);
+            
+            // The straight-line program recording the state elimination on the parametric model and its nodes representing the values of the initial states
+            boost::optional<storm::storage::StraightLineProgram<typename SparseModelType::ValueType>> straightLineProgram;
+            std::vector<uint64_t> straightLineProgramNodes;
+            
             storm::utility::ModelInstantiator<SparseModelType, storm::models::sparse::Dtmc<ConstantType>> modelInstantiator;
         };
     }
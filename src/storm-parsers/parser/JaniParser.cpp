@@ -79,7 +79,7 @@ namespace storm {
         template <typename ValueType>
         std::pair<storm::jani::Model, std::vector<storm::jani::Property>> JaniParser<ValueType>::parse(std::string const& path, bool parseProperties) {
             JaniParser parser;
-            parser.readFile(path);
+            parser.readFile(path, parseProperties);
             return parser.parseModel(parseProperties);
         }
 
@@ -89,10 +89,27 @@ namespace storm {
         }
 
         template <typename ValueType>
-        void JaniParser<ValueType>::readFile(std::string const &path) {
+        void JaniParser<ValueType>::readFile(std::string const &path, bool parseProperties) {
             std::ifstream file;
             storm::utility::openFile(path, file);
-            parsedStructure << file;
+            // Parts of the structure that are never inspected are dropped while reading the file, such that they do
+            // not occupy any memory. Note that this includes comments, which generated models often attach to every edge.
+            // Only the comments of the properties themselves are read and therefore kept.
+            bool insideProperties = false;
+            parsedStructure = Json::parse(file, [parseProperties, &insideProperties] (int depth, typename Json::parse_event_t event, Json& parsed) {
+                if (event == Json::parse_event_t::key) {
+                    std::string const& key = parsed.template get_ref<std::string const&>();
+                    if (depth == 1) {
+                        insideProperties = key == "properties";
+                        if (insideProperties && !parseProperties) {
+                            return false;
+                        }
+                    } else if (key == "comment" && !(insideProperties && depth == 3)) {
+                        return false;
+                    }
+                }
+                return true;
+            });
             storm::utility::closeFile(file);
         }
 
@@ -195,8 +212,11 @@ namespace storm {
             STORM_LOG_THROW(parsedStructure.count("automata") == 1, storm::exceptions::InvalidJaniException, "Exactly one list of automata must be given");
             STORM_LOG_THROW(parsedStructure.at("automata").is_array(), storm::exceptions::InvalidJaniException, "Automata must be an array");
             // Automatons can only be parsed after constants and variables.
-            for (auto const& automataEntry : parsedStructure.at("automata")) {
+            for (auto& automataEntry : parsedStructure.at("automata")) {
                 model.addAutomaton(parseAutomaton(automataEntry, model, scope.refine("automata[" + std::to_string(model.getNumberOfAutomata()) + "]")));
+                // The structure of the automaton is not needed anymore. Releasing it right away avoids holding both the
+                // complete structure and the complete model in memory.
+                automataEntry = Json();
             }
             STORM_LOG_THROW(parsedStructure.count("restrict-initial") < 2, storm::exceptions::InvalidJaniException, "Model has multiple initial value restrictions");
             storm::expressions::Expression initialValueRestriction = expressionManager->boolean(true);
@@ -216,7 +236,7 @@ namespace storm {
             std::vector<storm::jani::Property> properties;
             if (parseProperties && parsedStructure.count("properties") == 1) {
                 STORM_LOG_THROW(parsedStructure.at("properties").is_array(), storm::exceptions::InvalidJaniException, "Properties should be an array");
-                for(auto const& propertyEntry : parsedStructure.at("properties")) {
+                for(auto& propertyEntry : parsedStructure.at("properties")) {
                     try {
                         auto prop = this->parseProperty(model, propertyEntry, scope.refine("property[" + std::to_string(properties.size()) + "]"));
                         // Eliminate reward accumulations as much as possible
@@ -227,6 +247,7 @@ namespace storm {
                     } catch (storm::exceptions::NotImplementedException const&  ex) {
                         STORM_LOG_WARN("Cannot handle property: " << ex.what());
                     }
+                    propertyEntry = Json();
                 }
             }
             return {model, properties};
@@ -24,6 +24,8 @@ namespace storm {
             const std::string exportWinningRegionOption = "exportwinningregion";
             const std::string preventGraphPreprocessing = "nographprocessing";
             const std::string memlessSearchOption = "memlesssearch";
+            const std::string incrementalSearchOption = "incremental";
+            const std::string graphPruningOption = "graphpruning";
             std::vector<std::string> memlessSearchMethods = {"one-shot", "iterative"};
 
 
@@ -40,6 +42,8 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, printWinningRegionOption, false, "Print Winning Region").setIsAdvanced().build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, exportWinningRegionOption, false, "Export the winning region.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createStringArgument("path", "The name of the file to which to write the winning region.").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, preventGraphPreprocessing, true, "Prevent graph preprocessing (for debugging)").setIsAdvanced().build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, incrementalSearchOption, false, "Keep the encoding in the solver when restarting the iterative search.").setIsAdvanced().build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, graphPruningOption, false, "Extend the target states with graph analysis before (re)starting the iterative search.").setIsAdvanced().build());
             }
 
             uint64_t QualitativePOMDPAnalysisSettings::getLookahead() const {
@@ -97,6 +101,14 @@ namespace storm {
                 return this->getOption(memlessSearchOption).getArgumentByName("method").getValueAsString();
             }
 
+            bool QualitativePOMDPAnalysisSettings::isIncrementalSearchSet() const {
+                return this->getOption(incrementalSearchOption).getHasOptionBeenSet();
+            }
+
+            bool QualitativePOMDPAnalysisSettings::isGraphPruningSet() const {
+                return this->getOption(graphPruningOption).getHasOptionBeenSet();
+            }
+
             void QualitativePOMDPAnalysisSettings::finalize() {
             }
 
@@ -35,6 +35,8 @@ namespace storm {
                 bool isGraphPreprocessingAllowed() const;
                 bool isMemlessSearchSet() const;
                 std::string getMemlessSearchMethod() const;
+                bool isIncrementalSearchSet() const;
+                bool isGraphPruningSet() const;
 
 
 
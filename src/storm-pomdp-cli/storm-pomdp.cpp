@@ -130,6 +130,8 @@ namespace storm {
                 options.validateResult = qualSettings.validateFinalResult();
 
                 options.pathVariableType = storm::pomdp::pathVariableTypeFromString(qualSettings.getLookaheadType());
+                options.incrementalSolving = qualSettings.isIncrementalSearchSet();
+                options.graphPruning = qualSettings.isGraphPruningSet();
 
                 if (qualSettings.isExportSATCallsSet()) {
                     options.setExportSATCalls(qualSettings.getExportSATCallsPath());
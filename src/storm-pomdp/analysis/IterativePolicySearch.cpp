@@ -45,6 +45,12 @@ namespace storm {
             STORM_PRINT_AND_LOG("Update solver with new scheduler time: " << updateNewStrategySolverTime);
             STORM_PRINT_AND_LOG("Winning regions update time: " << winningRegionUpdatesTimer);
             STORM_PRINT_AND_LOG("Graph search time: " << graphSearchTime);
+            if (!iterationRecords.empty()) {
+                STORM_PRINT_AND_LOG("Per iteration: iteration, SAT calls, SAT time (ms), covered states, winning observations");
+                for (auto const& record : iterationRecords) {
+                    STORM_PRINT_AND_LOG("\t" << record.iteration << ", " << record.smtChecks << ", " << record.smtTimeInMilliseconds << ", " << record.coveredStates << ", " << record.winningObservations);
+                }
+            }
         }
 
         template <typename ValueType>
@@ -96,6 +102,17 @@ namespace storm {
                 k = 10; //magic constant, consider moving.
             }
 
+            if (options.incrementalSolving) {
+                // Adding the lookahead constraints is never wrong (cf. forceLookahead), so we keep them once encoded.
+                lookaheadConstraintsRequired |= encodedK && encodedWithLookahead;
+                if (encodedK && encodedK.get() == k && encodedWithLookahead == lookaheadConstraintsRequired) {
+                    STORM_LOG_INFO("Reuse encoding present in solver.");
+                    fixTargetStates();
+                    return lookaheadConstraintsRequired;
+                }
+                smtSolver->reset();
+                openScopes = 0;
+            }
 
             if (actionSelectionVars.empty()) {
 
@@ -111,6 +128,10 @@ namespace storm {
                     continuationVars.push_back(
                             expressionManager->declareBooleanVariable("D-" + std::to_string(stateId)));
                     continuationVarExpressions.push_back(continuationVars.back().getExpression());
+                    if (options.incrementalSolving) {
+                        targetVars.push_back(expressionManager->declareBooleanVariable("T-" + std::to_string(stateId)));
+                        targetVarExpressions.push_back(targetVars.back().getExpression());
+                    }
                 }
                 // Create the action selection variables.
                 uint64_t obs = 0;
@@ -172,6 +193,29 @@ namespace storm {
             assert(reachVars.size() == pomdp.getNumberOfStates());
             assert(reachVarExpressions.size() == pomdp.getNumberOfStates());
 
+            // In the incremental mode, we encode the constraints for both the case that a state is a target state and
+            // the case that it is not. They are guarded by a literal whose value is fixed in an outer scope of the
+            // solver (see fixTargetStates), so that new target states do not require to encode everything again.
+            auto encodeAsTarget = [this] (uint64_t state) {
+                return options.incrementalSolving ? !surelyReachSinkStates.get(state) : targetStates.get(state);
+            };
+            auto encodeAsNonTarget = [this] (uint64_t state) {
+                return options.incrementalSolving || !targetStates.get(state);
+            };
+            auto addForTarget = [this] (uint64_t state, storm::expressions::Expression const& constraint) {
+                if (options.incrementalSolving) {
+                    smtSolver->add(storm::expressions::implies(targetVarExpressions[state], constraint));
+                } else {
+                    smtSolver->add(constraint);
+                }
+            };
+            auto addForNonTarget = [this] (uint64_t state, storm::expressions::Expression const& constraint) {
+                if (options.incrementalSolving && !surelyReachSinkStates.get(state)) {
+                    smtSolver->add(storm::expressions::implies(!targetVarExpressions[state], constraint));
+                } else {
+                    smtSolver->add(constraint);
+                }
+            };
 
             uint64_t obs = 0;
 
@@ -213,10 +257,11 @@ namespace storm {
             if (lookaheadConstraintsRequired) {
                 if (options.pathVariableType == MemlessSearchPathVariables::BooleanRanking) {
                     for (uint64_t state = 0; state < pomdp.getNumberOfStates(); ++state) {
-                        if (targetStates.get(state)) {
-                            smtSolver->add(pathVarExpressions[state][0]);
-                        } else {
-                            smtSolver->add(!pathVarExpressions[state][0] || followVarExpressions[pomdp.getObservation(state)]);
+                        if (encodeAsTarget(state)) {
+                            addForTarget(state, pathVarExpressions[state][0]);
+                        }
+                        if (encodeAsNonTarget(state)) {
+                            addForNonTarget(state, !pathVarExpressions[state][0] || followVarExpressions[pomdp.getObservation(state)]);
                         }
                     }
                 } else {
@@ -233,7 +278,7 @@ namespace storm {
             // PAPER COMMENT: 4
             uint64_t rowindex = 0;
             for (uint64_t state = 0; state < pomdp.getNumberOfStates(); ++state) {
-                if (targetStates.get(state) || surelyReachSinkStates.get(state)) {
+                if (!encodeAsNonTarget(state) || surelyReachSinkStates.get(state)) {
                     rowindex += pomdp.getNumberOfChoices(state);
                     continue;
                 }
@@ -254,10 +299,10 @@ namespace storm {
                         } else {
                             subexprreachSwitch.push_back(reachVarExpressions.at(entries.getColumn()));
                         }
-                        smtSolver->add(storm::expressions::disjunction(subexprreachSwitch));
+                        addForNonTarget(state, storm::expressions::disjunction(subexprreachSwitch));
                         subexprreachSwitch.pop_back();
                         subexprreachNoSwitch.push_back(reachVarExpressions.at(entries.getColumn()));
-                        smtSolver->add(storm::expressions::disjunction(subexprreachNoSwitch));
+                        addForNonTarget(state, storm::expressions::disjunction(subexprreachNoSwitch));
                         subexprreachNoSwitch.pop_back();
                     }
 
@@ -267,7 +312,6 @@ namespace storm {
 
 
 
-            rowindex = 0;
             for (uint64_t state = 0; state < pomdp.getNumberOfStates(); ++state) {
                 // PAPER COMMENT 5
                 if (surelyReachSinkStates.get(state)) {
@@ -282,14 +326,15 @@ namespace storm {
                             smtSolver->add(pathVarExpressions[state][0] == expressionManager->integer(k));
                         }
                     }
-                    rowindex += pomdp.getNumberOfChoices(state);
-                } else if(!targetStates.get(state)) {
+                    continue;
+                }
+                if (encodeAsNonTarget(state)) {
                     if (lookaheadConstraintsRequired) {
-
+                        rowindex = pomdp.getTransitionMatrix().getRowGroupIndices()[state];
 
                         if(options.pathVariableType == MemlessSearchPathVariables::BooleanRanking) {
                             // PAPER COMMENT 6
-                            smtSolver->add(storm::expressions::implies(reachVarExpressions.at(state),
+                            addForNonTarget(state, storm::expressions::implies(reachVarExpressions.at(state),
                                                                            pathVarExpressions.at(state).back()));
                             // PAPER COMMENT 7
 
@@ -319,7 +364,7 @@ namespace storm {
                                 }
                                 pathsubexprs.push_back(switchVarExpressions.at(pomdp.getObservation(state)));
                                 pathsubexprs.push_back(followVarExpressions[pomdp.getObservation(state)]);
-                                smtSolver->add(storm::expressions::iff(pathVarExpressions[state][j],
+                                addForNonTarget(state, storm::expressions::iff(pathVarExpressions[state][j],
                                                                            storm::expressions::disjunction(pathsubexprs)));
 
                             }
@@ -338,22 +383,22 @@ namespace storm {
                             actPathDisjunction.push_back(switchVarExpressions.at(pomdp.getObservation(state)));
                             actPathDisjunction.push_back(followVarExpressions[pomdp.getObservation(state)]);
                             actPathDisjunction.push_back(!reachVarExpressions[state]);
-                            smtSolver->add(storm::expressions::disjunction(actPathDisjunction));
+                            addForNonTarget(state, storm::expressions::disjunction(actPathDisjunction));
                         }
                     }
-                } else {
+                }
+                if (encodeAsTarget(state)) {
                     if (lookaheadConstraintsRequired) {
                         if (options.pathVariableType == MemlessSearchPathVariables::BooleanRanking) {
                             for (uint64_t j = 1; j < k; ++j) {
-                                smtSolver->add(pathVarExpressions[state][j]);
+                                addForTarget(state, pathVarExpressions[state][j]);
                             }
                         } else {
-                            smtSolver->add(pathVarExpressions[state][0] == expressionManager->integer(0));
+                            addForTarget(state, pathVarExpressions[state][0] == expressionManager->integer(0));
                             //assert(false);
                         }
                     }
-                    smtSolver->add(reachVars[state]);
-                    rowindex += pomdp.getNumberOfChoices(state);
+                    addForTarget(state, reachVarExpressions[state]);
                 }
             }
 
@@ -361,9 +406,9 @@ namespace storm {
             obs = 0;
             for(auto const& statesForObservation : statesPerObservation) {
                 for(auto const& state : statesForObservation) {
-                    if (!targetStates.get(state)) {
-                        smtSolver->add(!continuationVars[state] || schedulerVariableExpressions[obs] > 0);
-                        smtSolver->add(!reachVarExpressions[state] || !followVarExpressions[obs] || schedulerVariableExpressions[obs] > 0);
+                    if (encodeAsNonTarget(state)) {
+                        addForNonTarget(state, !continuationVars[state] || schedulerVariableExpressions[obs] > 0);
+                        addForNonTarget(state, !reachVarExpressions[state] || !followVarExpressions[obs] || schedulerVariableExpressions[obs] > 0);
                     }
                 }
                 ++obs;
@@ -373,9 +418,43 @@ namespace storm {
             for (uint64_t obs = 0; obs < pomdp.getNrObservations(); ++obs) {
                 smtSolver->add(storm::expressions::implies(switchVarExpressions[obs], storm::expressions::disjunction(reachVarExpressionsPerObservation[obs])));
             }
+
+            if (options.incrementalSolving) {
+                encodedK = k;
+                encodedWithLookahead = lookaheadConstraintsRequired;
+                fixTargetStates();
+            }
             return lookaheadConstraintsRequired;
         }
 
+        template <typename ValueType>
+        void IterativePolicySearch<ValueType>::fixTargetStates() {
+            // Drop everything that was added on top of the encoding and (re)fix the guards for the current targets.
+            if (openScopes > 0) {
+                smtSolver->pop(openScopes);
+                openScopes = 0;
+            }
+            pushScope();
+            for (uint64_t state = 0; state < pomdp.getNumberOfStates(); ++state) {
+                if (!surelyReachSinkStates.get(state)) {
+                    smtSolver->add(targetStates.get(state) ? targetVarExpressions[state] : !targetVarExpressions[state]);
+                }
+            }
+        }
+
+        template <typename ValueType>
+        void IterativePolicySearch<ValueType>::pushScope() {
+            smtSolver->push();
+            ++openScopes;
+        }
+
+        template <typename ValueType>
+        void IterativePolicySearch<ValueType>::popScope() {
+            assert(openScopes > 0);
+            smtSolver->pop();
+            --openScopes;
+        }
+
         template<typename ValueType>
         uint64_t IterativePolicySearch<ValueType>::getOffsetFromObservation(uint64_t state, uint64_t observation) const {
             if(!useFindOffset) {
@@ -398,6 +477,13 @@ namespace storm {
             STORM_LOG_DEBUG("Surely reach sink states: " << surelyReachSinkStates);
             STORM_LOG_DEBUG("Target states " << targetStates);
             STORM_LOG_DEBUG("Questionmark states " << (~surelyReachSinkStates & ~targetStates));
+            if (options.graphPruning) {
+                stats.graphSearchTime.start();
+                storm::analysis::QualitativeAnalysisOnGraphs<ValueType> graphanalysis(pomdp);
+                targetStates = graphanalysis.analyseProb1Max(~surelyReachSinkStates, targetStates);
+                STORM_LOG_DEBUG("Target states after graph based pruning " << targetStates);
+                stats.graphSearchTime.stop();
+            }
             stats.initializeSolverTimer.start();
             // TODO: When do we need to reinitialize? When the solver has been reset.
             bool lookaheadConstraintsRequired = initialize(k);
@@ -518,7 +604,7 @@ namespace storm {
 
             }
 
-            smtSolver->push();
+            pushScope();
             for (uint64_t obs = 0; obs < pomdp.getNrObservations(); ++obs) {
                 auto constant = expressionManager->integer(schedulerForObs[obs]);
                 smtSolver->add(schedulerVariableExpressions[obs] <= constant);
@@ -546,6 +632,8 @@ namespace storm {
             bool foundWhatWeLookFor = false;
             while(true) {
                 stats.incrementOuterIterations();
+                uint64_t checksBeforeIteration = stats.getChecks();
+                uint64_t smtTimeBeforeIteration = stats.smtCheckTimer.getTimeInMilliseconds();
                 // TODO consider what we really want to store about the schedulers.
                 scheduler.reset(pomdp.getNrObservations(), maximalNrActions);
                 observations.clear();
@@ -694,7 +782,7 @@ namespace storm {
                     break;
                 }
                 //smtSolver->unsetTimeout();
-                smtSolver->pop();
+                popScope();
 
                 if(options.computeDebugOutput()) {
                     printCoveredStates(~coveredStates);
@@ -847,7 +935,7 @@ namespace storm {
                 }
                 finalSchedulers.push_back(scheduler);
 
-                smtSolver->push();
+                pushScope();
 
                 for (uint64_t obs = 0; obs < pomdp.getNrObservations(); ++obs) {
                     if(winningRegion.observationIsWinning(obs)) {
@@ -868,6 +956,14 @@ namespace storm {
                 }
                 stats.updateNewStrategySolverTime.stop();
 
+                uint64_t winningObservations = 0;
+                for (uint64_t obs = 0; obs < pomdp.getNrObservations(); ++obs) {
+                    if (winningRegion.observationIsWinning(obs)) {
+                        ++winningObservations;
+                    }
+                }
+                stats.recordIteration(stats.getChecks() - checksBeforeIteration, stats.smtCheckTimer.getTimeInMilliseconds() - smtTimeBeforeIteration, coveredStates.getNumberOfSetBits(), winningObservations);
+
                 STORM_LOG_INFO("... after iteration " << stats.getIterations() << " so far " << stats.getChecks() << " checks." );
             }
             if(options.validateResult) {
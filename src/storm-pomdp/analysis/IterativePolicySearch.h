@@ -1,5 +1,6 @@
 #include <vector>
 #include <sstream>
+#include <boost/optional.hpp>
 #include "storm/storage/expressions/Expressions.h"
 #include "storm/solver/SmtSolver.h"
 #include "storm/models/sparse/Pomdp.h"
@@ -66,6 +67,10 @@ namespace pomdp {
         uint64_t restartAfterNIterations = 250;
         uint64_t extensionCallTimeout = 0u;
         uint64_t localIterationMaximum = 600;
+        // Keep the encoding in the solver across restarts, target states are fixed via guard literals.
+        bool incrementalSolving = false;
+        // Extend the target states by a graph-based analysis before (re)starting the search.
+        bool graphPruning = false;
 
     private:
         std::string exportSATcalls = "";
@@ -156,10 +161,27 @@ namespace pomdp {
                 void incrementGraphBasedWinningObservations() {
                     graphBasedAnalysisWinOb++;
                 }
+
+                struct IterationRecord {
+                    uint64_t iteration;
+                    uint64_t smtChecks;
+                    uint64_t smtTimeInMilliseconds;
+                    uint64_t coveredStates;
+                    uint64_t winningObservations;
+                };
+
+                void recordIteration(uint64_t smtChecks, uint64_t smtTimeInMilliseconds, uint64_t coveredStates, uint64_t winningObservations) {
+                    iterationRecords.push_back({outerIterations, smtChecks, smtTimeInMilliseconds, coveredStates, winningObservations});
+                }
+
+                std::vector<IterationRecord> const& getIterationRecords() const {
+                    return iterationRecords;
+                }
         private:
                 uint64_t satCalls = 0;
                 uint64_t outerIterations = 0;
                 uint64_t graphBasedAnalysisWinOb = 0;
+                std::vector<IterationRecord> iterationRecords;
         };
 
         IterativePolicySearch(storm::models::sparse::Pomdp<ValueType> const& pomdp,
@@ -210,14 +232,19 @@ namespace pomdp {
             STORM_LOG_INFO("Reset solver to restart with current winning region");
             schedulerForObs.clear();
             finalSchedulers.clear();
-            smtSolver->reset();
-
-
+            if (!options.incrementalSolving) {
+                smtSolver->reset();
+                openScopes = 0;
+            }
+            // In the incremental mode, the scopes on top of the encoding are dropped when the solver is initialized again.
         }
         void printScheduler(std::vector<InternalObservationScheduler> const& );
         void printCoveredStates(storm::storage::BitVector const& remaining) const;
 
         bool initialize(uint64_t k);
+        void fixTargetStates();
+        void pushScope();
+        void popScope();
 
         bool smtCheck(uint64_t iteration, std::set<storm::expressions::Expression> const& assumptions = {});
 
@@ -251,6 +278,13 @@ namespace pomdp {
         std::vector<storm::expressions::Expression> continuationVarExpressions;
         std::vector<std::vector<storm::expressions::Variable>> pathVars;
         std::vector<std::vector<storm::expressions::Expression>> pathVarExpressions;
+        std::vector<storm::expressions::Variable> targetVars;
+        std::vector<storm::expressions::Expression> targetVarExpressions;
+
+        // The lookahead for which the encoding currently in the solver has been created (incremental mode only).
+        boost::optional<uint64_t> encodedK;
+        bool encodedWithLookahead = false;
+        uint64_t openScopes = 0;
 
         std::vector<InternalObservationScheduler> finalSchedulers;
         std::vector<uint64_t> schedulerForObs;
@@ -1,5 +1,11 @@
 #include "storm/abstraction/jani/AutomatonAbstractor.h"
 
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+
 #include "storm/abstraction/BottomStateResult.h"
 #include "storm/abstraction/AbstractionInformation.h"
 #include "storm/abstraction/GameBddResult.h"
@@ -68,7 +74,47 @@ namespace storm {
             
             template <storm::dd::DdType DdType, typename ValueType>
             GameBddResult<DdType> AutomatonAbstractor<DdType, ValueType>::abstract() {
-                // First, we retrieve the abstractions of all commands.
+                // Enumerate the solutions for all edges that need to be re-abstracted. Since this only involves
+                // the SMT solvers of the individual edges, it can be done concurrently. As the solvers share one expression
+                // manager in which translating an assertion may declare auxiliary variables, the edges synchronize on
+                // a common mutex for that. The DDs are then built sequentially below, because the DD managers must not
+                // be accessed from multiple threads.
+                uint64_t numberOfThreads = std::min<uint64_t>(storm::settings::getModule<AbstractionSettings>().getNumberOfThreads(), edges.size());
+                if (numberOfThreads > 1) {
+                    std::atomic<uint64_t> nextEdge(0);
+                    std::mutex exceptionMutex;
+                    std::shared_timed_mutex managerMutex;
+                    std::exception_ptr exception;
+                    
+                    auto worker = [this,&nextEdge,&exceptionMutex,&managerMutex,&exception] () {
+                        for (uint64_t index = nextEdge++; index < edges.size(); index = nextEdge++) {
+                            try {
+                                edges[index].enumerateSolutions(&managerMutex);
+                            } catch (...) {
+                                std::lock_guard<std::mutex> lock(exceptionMutex);
+                                if (!exception) {
+                                    exception = std::current_exception();
+                                }
+                                nextEdge = edges.size();
+                            }
+                        }
+                    };
+                    
+                    std::vector<std::thread> threads;
+                    for (uint64_t thread = 1; thread < numberOfThreads; ++thread) {
+                        threads.emplace_back(worker);
+                    }
+                    worker();
+                    for (auto& thread : threads) {
+                        thread.join();
+                    }
+                    
+                    if (exception) {
+                        std::rethrow_exception(exception);
+                    }
+                }
+                
+                // Then, we retrieve the abstractions of all edges.
                 std::vector<GameBddResult<DdType>> edgeDdsAndUsedOptionVariableCounts;
                 uint_fast64_t maximalNumberOfUsedOptionVariables = 0;
                 for (auto& edge : edges) {
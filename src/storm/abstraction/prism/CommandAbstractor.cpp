@@ -1,6 +1,7 @@
 #include "storm/abstraction/prism/CommandAbstractor.h"
 
 #include <chrono>
+#include <mutex>
 
 #include <boost/iterator/transform_iterator.hpp>
 
@@ -68,6 +69,9 @@ namespace storm {
                 }
                 forceRecomputation |= relevantPredicatesChanged;
                 
+                // Solutions that were enumerated wrt. the old predicates can no longer be used.
+                enumerationResult = boost::none;
+                
                 // Refine bottom state abstractor. Note that this does not trigger a recomputation yet.
                 bottomStateAbstractor.refine(predicates);
             }
@@ -92,19 +96,43 @@ namespace storm {
                 return assignedVariables;
             }
             
+            template <storm::dd::DdType DdType, typename ValueType>
+            void CommandAbstractor<DdType, ValueType>::enumerateSolutions(std::shared_timed_mutex* managerMutex) {
+                if (!forceRecomputation || enumerationResult) {
+                    return;
+                }
+                
+                if (useDecomposition) {
+                    enumerateSolutionsWithDecomposition(managerMutex);
+                } else {
+                    enumerateSolutionsWithoutDecomposition(managerMutex);
+                }
+            }
+            
             template <storm::dd::DdType DdType, typename ValueType>
             void CommandAbstractor<DdType, ValueType>::recomputeCachedBdd() {
+                auto start = std::chrono::high_resolution_clock::now();
+                
+                // Only enumerate the solutions if this was not done beforehand (e.g. concurrently with other commands).
+                enumerateSolutions();
+                STORM_LOG_ASSERT(enumerationResult, "Expected enumerated solutions.");
+                
                 if (useDecomposition) {
                     recomputeCachedBddWithDecomposition();
                 } else {
                     recomputeCachedBddWithoutDecomposition();
                 }
+                
+                auto end = std::chrono::high_resolution_clock::now();
+                STORM_LOG_TRACE("Enumerated " << enumerationResult.get().numberOfSolutions << " solutions and built BDD in " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms.");
+                
+                enumerationResult = boost::none;
+                forceRecomputation = false;
             }
             
             template <storm::dd::DdType DdType, typename ValueType>
-            void CommandAbstractor<DdType, ValueType>::recomputeCachedBddWithDecomposition() {
-                STORM_LOG_TRACE("Recomputing BDD for command " << command.get() << " [with index " << command.get().getGlobalIndex() << "] using the decomposition.");
-                auto start = std::chrono::high_resolution_clock::now();
+            void CommandAbstractor<DdType, ValueType>::enumerateSolutionsWithDecomposition(std::shared_timed_mutex* managerMutex) {
+                STORM_LOG_TRACE("Enumerating solutions for command " << command.get() << " [with index " << command.get().getGlobalIndex() << "] using the decomposition.");
                 
                 // compute a decomposition of the command
                 //  * start with all relevant blocks: blocks of assignment variables and variables in the rhs of assignments
@@ -229,9 +257,11 @@ namespace storm {
                 
                 std::set<storm::expressions::Variable> variablesContainedInGuard = command.get().getGuardExpression().getVariables();
                 
+                EnumerationResult result;
+                
                 // Check whether we need to enumerate the guard. This is the case if the blocks related by the guard
                 // are not contained within a single block of our decomposition.
-                bool enumerateAbstractGuard = true;
+                result.enumerateAbstractGuard = true;
                 std::set<uint64_t> guardBlocks = localExpressionInformation.getBlockIndicesOfVariables(variablesContainedInGuard);
                 for (auto const& block : relevantBlockPartition) {
                     bool allContained = true;
@@ -242,56 +272,64 @@ namespace storm {
                         }
                     }
                     if (allContained) {
-                        enumerateAbstractGuard = false;
+                        result.enumerateAbstractGuard = false;
                     }
                 }
                 
                 uint64_t numberOfSolutions = 0;
-                uint64_t numberOfTotalSolutions = 0;
                 
                 // If we need to enumerate the guard, do it only once now.
-                if (enumerateAbstractGuard) {
+                if (result.enumerateAbstractGuard) {
                     std::set<uint64_t> relatedGuardPredicates = localExpressionInformation.getRelatedExpressions(variablesContainedInGuard);
                     std::vector<storm::expressions::Variable> guardDecisionVariables;
-                    std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> guardVariablesAndPredicates;
                     for (auto const& element : relevantPredicatesAndVariables.first) {
                         if (relatedGuardPredicates.find(element.second) != relatedGuardPredicates.end()) {
                             guardDecisionVariables.push_back(element.first);
-                            guardVariablesAndPredicates.push_back(element);
+                            result.guardBlock.sourceVariablesAndPredicates.push_back(element);
                         }
                     }
-                    abstractGuard = this->getAbstractionInformation().getDdManager().getBddZero();
-                    smtSolver->allSat(guardDecisionVariables, [this,&guardVariablesAndPredicates,&numberOfSolutions] (storm::solver::SmtSolver::ModelReference const& model) {
-                        abstractGuard |= getSourceStateBdd(model, guardVariablesAndPredicates);
+                    
+                    // Rather than going through a BDD, we directly collect the satisfying cubes of the guard, so they
+                    // can be added as an assertion without touching any DDs.
+                    std::vector<storm::expressions::Expression> guardCubes;
+                    std::shared_lock<std::shared_timed_mutex> guardReadLock;
+                    if (managerMutex) {
+                        guardReadLock = std::shared_lock<std::shared_timed_mutex>(*managerMutex);
+                    }
+                    smtSolver->allSat(guardDecisionVariables, [this,&result,&guardCubes,&numberOfSolutions] (storm::solver::SmtSolver::ModelReference const& model) {
+                        storm::storage::BitVector values = getPredicateValues(model, result.guardBlock.sourceVariablesAndPredicates);
+                        
+                        std::vector<storm::expressions::Expression> literals;
+                        for (uint64_t variableIndex = 0; variableIndex < result.guardBlock.sourceVariablesAndPredicates.size(); ++variableIndex) {
+                            storm::expressions::Variable const& variable = result.guardBlock.sourceVariablesAndPredicates[variableIndex].first;
+                            literals.push_back(values.get(variableIndex) ? variable.getExpression() : !variable.getExpression());
+                        }
+                        guardCubes.push_back(literals.empty() ? this->getAbstractionInformation().getExpressionManager().boolean(true) : storm::expressions::conjunction(literals));
+                        
+                        result.guardBlock.solutions.emplace_back(std::move(values), std::vector<storm::storage::BitVector>());
                         ++numberOfSolutions;
                         return true;
                     });
                     STORM_LOG_TRACE("Enumerated " << numberOfSolutions << " solutions for abstract guard.");
+                    result.numberOfSolutions += numberOfSolutions;
+                    if (guardReadLock) {
+                        guardReadLock.unlock();
+                    }
                     
                     // Now that we have the abstract guard, we can add it as an assertion to the solver before enumerating
-                    // the other solutions.
-                    
-                    // Create a new backtracking point before adding the guard.
+                    // the other solutions. We create a new backtracking point before adding the guard.
+                    // Translating the assertion may declare auxiliary variables in the shared manager, so it must not
+                    // happen while other threads read from it.
                     smtSolver->push();
-                    
-                    // Create the guard constraint.
-                    std::pair<std::vector<storm::expressions::Expression>, std::unordered_map<uint_fast64_t, storm::expressions::Variable>> result = abstractGuard.toExpression(this->getAbstractionInformation().getExpressionManager());
-                    
-                    // Then add it to the solver.
-                    for (auto const& expression : result.first) {
-                        smtSolver->add(expression);
-                    }
-                    
-                    // Finally associate the level variables with the predicates.
-                    for (auto const& indexVariablePair : result.second) {
-                        smtSolver->add(storm::expressions::iff(indexVariablePair.second, this->getAbstractionInformation().getPredicateForDdVariableIndex(indexVariablePair.first)));
+                    std::unique_lock<std::shared_timed_mutex> writeLock;
+                    if (managerMutex) {
+                        writeLock = std::unique_lock<std::shared_timed_mutex>(*managerMutex);
                     }
+                    smtSolver->add(guardCubes.empty() ? this->getAbstractionInformation().getExpressionManager().boolean(false) : storm::expressions::disjunction(guardCubes));
                 }
                 
                 // Then enumerate the solutions for each of the blocks of the decomposition.
-                uint64_t usedNondeterminismVariables = 0;
                 uint64_t blockCounter = 0;
-                std::vector<storm::dd::Bdd<DdType>> blockBdds;
                 for (auto const& block : relevantBlockPartition) {
                     std::set<uint64_t> relevantPredicates;
                     for (auto const& innerBlock : block) {
@@ -303,18 +341,19 @@ namespace storm {
                         continue;
                     }
                     
+                    result.blocks.emplace_back();
+                    SolutionBlock& solutionBlock = result.blocks.back();
+                    
                     std::vector<storm::expressions::Variable> transitionDecisionVariables;
-                    std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> sourceVariablesAndPredicates;
                     for (auto const& element : relevantPredicatesAndVariables.first) {
                         if (relevantPredicates.find(element.second) != relevantPredicates.end()) {
                             transitionDecisionVariables.push_back(element.first);
-                            sourceVariablesAndPredicates.push_back(element);
+                            solutionBlock.sourceVariablesAndPredicates.push_back(element);
                         }
                     }
                     
-                    std::vector<std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>>> destinationVariablesAndPredicates;
                     for (uint64_t updateIndex = 0; updateIndex < command.get().getNumberOfUpdates(); ++updateIndex) {
-                        destinationVariablesAndPredicates.emplace_back();
+                        solutionBlock.destinationVariablesAndPredicates.emplace_back();
                         for (auto const& assignment : command.get().getUpdate(updateIndex).getAssignments()) {
                             uint64_t assignmentVariableBlockIndex = localExpressionInformation.getBlockIndexOfVariable(assignment.getVariable());
                             
@@ -322,7 +361,7 @@ namespace storm {
                                 std::set<uint64_t> const& assignmentVariableBlock = localExpressionInformation.getExpressionBlock(assignmentVariableBlockIndex);
                                 for (auto const& element : relevantPredicatesAndVariables.second[updateIndex]) {
                                     if (assignmentVariableBlock.find(element.second) != assignmentVariableBlock.end()) {
-                                        destinationVariablesAndPredicates.back().push_back(element);
+                                        solutionBlock.destinationVariablesAndPredicates.back().push_back(element);
                                         transitionDecisionVariables.push_back(element.first);
                                     }
                                 }
@@ -330,15 +369,50 @@ namespace storm {
                         }
                     }
                     
-                    std::unordered_map<storm::dd::Bdd<DdType>, std::vector<storm::dd::Bdd<DdType>>> sourceToDistributionsMap;
                     numberOfSolutions = 0;
-                    smtSolver->allSat(transitionDecisionVariables, [&sourceToDistributionsMap,this,&numberOfSolutions,&sourceVariablesAndPredicates,&destinationVariablesAndPredicates] (storm::solver::SmtSolver::ModelReference const& model) {
-                        sourceToDistributionsMap[getSourceStateBdd(model, sourceVariablesAndPredicates)].push_back(getDistributionBdd(model, destinationVariablesAndPredicates));
+                    std::shared_lock<std::shared_timed_mutex> readLock;
+                    if (managerMutex) {
+                        readLock = std::shared_lock<std::shared_timed_mutex>(*managerMutex);
+                    }
+                    smtSolver->allSat(transitionDecisionVariables, [this,&solutionBlock,&numberOfSolutions] (storm::solver::SmtSolver::ModelReference const& model) {
+                        solutionBlock.solutions.emplace_back(getPredicateValues(model, solutionBlock.sourceVariablesAndPredicates), getPredicateValues(model, solutionBlock.destinationVariablesAndPredicates));
                         ++numberOfSolutions;
                         return true;
                     });
                     STORM_LOG_TRACE("Enumerated " << numberOfSolutions << " solutions for block " << blockCounter << ".");
-                    numberOfTotalSolutions += numberOfSolutions;
+                    result.numberOfSolutions += numberOfSolutions;
+                    ++blockCounter;
+                }
+                
+                if (result.enumerateAbstractGuard) {
+                    smtSolver->pop();
+                }
+                
+                enumerationResult = std::move(result);
+            }
+            
+            template <storm::dd::DdType DdType, typename ValueType>
+            void CommandAbstractor<DdType, ValueType>::recomputeCachedBddWithDecomposition() {
+                STORM_LOG_TRACE("Recomputing BDD for command " << command.get() << " [with index " << command.get().getGlobalIndex() << "] using the decomposition.");
+                EnumerationResult const& result = enumerationResult.get();
+                
+                // If we enumerated the guard, build its BDD now.
+                if (result.enumerateAbstractGuard) {
+                    abstractGuard = this->getAbstractionInformation().getDdManager().getBddZero();
+                    for (auto const& solution : result.guardBlock.solutions) {
+                        abstractGuard |= getSourceStateBdd(solution.first, result.guardBlock.sourceVariablesAndPredicates);
+                    }
+                }
+                
+                // Then build the BDDs for each of the blocks of the decomposition.
+                uint64_t usedNondeterminismVariables = 0;
+                uint64_t blockCounter = 0;
+                std::vector<storm::dd::Bdd<DdType>> blockBdds;
+                for (auto const& solutionBlock : result.blocks) {
+                    std::unordered_map<storm::dd::Bdd<DdType>, std::vector<storm::dd::Bdd<DdType>>> sourceToDistributionsMap;
+                    for (auto const& solution : solutionBlock.solutions) {
+                        sourceToDistributionsMap[getSourceStateBdd(solution.first, solutionBlock.sourceVariablesAndPredicates)].push_back(getDistributionBdd(solution.second, solutionBlock.destinationVariablesAndPredicates));
+                    }
                     
                     // Now we search for the maximal number of choices of player 2 to determine how many DD variables we
                     // need to encode the nondeterminism.
@@ -375,10 +449,6 @@ namespace storm {
                     ++blockCounter;
                 }
                 
-                if (enumerateAbstractGuard) {
-                    smtSolver->pop();
-                }
-                
                 // multiply the results
                 storm::dd::Bdd<DdType> resultBdd = getAbstractionInformation().getDdManager().getBddOne();
                 uint64_t blockIndex = 0;
@@ -388,7 +458,7 @@ namespace storm {
                 }
                 
                 // If we did not explicitly enumerate the guard, we can construct it from the result BDD.
-                if (!enumerateAbstractGuard) {
+                if (!result.enumerateAbstractGuard) {
                     std::set<storm::expressions::Variable> allVariables(getAbstractionInformation().getSuccessorVariables());
                     auto player2Variables = getAbstractionInformation().getPlayer2VariableSet(usedNondeterminismVariables);
                     allVariables.insert(player2Variables.begin(), player2Variables.end());
@@ -412,26 +482,41 @@ namespace storm {
                 
                 // Cache the result.
                 cachedDd = GameBddResult<DdType>(resultBdd, usedNondeterminismVariables);
+            }
+            
+            template <storm::dd::DdType DdType, typename ValueType>
+            void CommandAbstractor<DdType, ValueType>::enumerateSolutionsWithoutDecomposition(std::shared_timed_mutex* managerMutex) {
+                STORM_LOG_TRACE("Enumerating solutions for command " << command.get());
                 
-                auto end = std::chrono::high_resolution_clock::now();
+                EnumerationResult result;
+                result.blocks.emplace_back();
+                SolutionBlock& solutionBlock = result.blocks.back();
+                solutionBlock.sourceVariablesAndPredicates = relevantPredicatesAndVariables.first;
+                solutionBlock.destinationVariablesAndPredicates = relevantPredicatesAndVariables.second;
                 
-                STORM_LOG_TRACE("Enumerated " << numberOfTotalSolutions << " solutions in " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms.");
-                forceRecomputation = false;
+                std::shared_lock<std::shared_timed_mutex> readLock;
+                if (managerMutex) {
+                    readLock = std::shared_lock<std::shared_timed_mutex>(*managerMutex);
+                }
+                smtSolver->allSat(decisionVariables, [this,&solutionBlock] (storm::solver::SmtSolver::ModelReference const& model) {
+                    solutionBlock.solutions.emplace_back(getPredicateValues(model, solutionBlock.sourceVariablesAndPredicates), getPredicateValues(model, solutionBlock.destinationVariablesAndPredicates));
+                    return true;
+                });
+                result.numberOfSolutions = solutionBlock.solutions.size();
+                
+                enumerationResult = std::move(result);
             }
             
             template <storm::dd::DdType DdType, typename ValueType>
             void CommandAbstractor<DdType, ValueType>::recomputeCachedBddWithoutDecomposition() {
                 STORM_LOG_TRACE("Recomputing BDD for command " << command.get());
-                auto start = std::chrono::high_resolution_clock::now();
+                SolutionBlock const& solutionBlock = enumerationResult.get().blocks.front();
                 
                 // Create a mapping from source state DDs to their distributions.
                 std::unordered_map<storm::dd::Bdd<DdType>, std::vector<storm::dd::Bdd<DdType>>> sourceToDistributionsMap;
-                uint64_t numberOfSolutions = 0;
-                smtSolver->allSat(decisionVariables, [&sourceToDistributionsMap,this,&numberOfSolutions] (storm::solver::SmtSolver::ModelReference const& model) {
-                    sourceToDistributionsMap[getSourceStateBdd(model, relevantPredicatesAndVariables.first)].push_back(getDistributionBdd(model, relevantPredicatesAndVariables.second));
-                    ++numberOfSolutions;
-                    return true;
-                });
+                for (auto const& solution : solutionBlock.solutions) {
+                    sourceToDistributionsMap[getSourceStateBdd(solution.first, solutionBlock.sourceVariablesAndPredicates)].push_back(getDistributionBdd(solution.second, solutionBlock.destinationVariablesAndPredicates));
+                }
                 
                 // Now we search for the maximal number of choices of player 2 to determine how many DD variables we
                 // need to encode the nondeterminism.
@@ -474,10 +559,6 @@ namespace storm {
                 
                 // Cache the result.
                 cachedDd = GameBddResult<DdType>(resultBdd, numberOfVariablesNeeded);
-                auto end = std::chrono::high_resolution_clock::now();
-                
-                STORM_LOG_TRACE("Enumerated " << numberOfSolutions << " solutions in " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms.");
-                forceRecomputation = false;
             }
             
             template <storm::dd::DdType DdType, typename ValueType>
@@ -578,14 +659,35 @@ namespace storm {
             }
             
             template <storm::dd::DdType DdType, typename ValueType>
-            storm::dd::Bdd<DdType> CommandAbstractor<DdType, ValueType>::getSourceStateBdd(storm::solver::SmtSolver::ModelReference const& model, std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> const& variablePredicates) const {
+            storm::storage::BitVector CommandAbstractor<DdType, ValueType>::getPredicateValues(storm::solver::SmtSolver::ModelReference const& model, std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> const& variablePredicates) const {
+                storm::storage::BitVector result(variablePredicates.size());
+                for (uint64_t index = 0; index < variablePredicates.size(); ++index) {
+                    if (model.getBooleanValue(variablePredicates[index].first)) {
+                        result.set(index);
+                    }
+                }
+                return result;
+            }
+            
+            template <storm::dd::DdType DdType, typename ValueType>
+            std::vector<storm::storage::BitVector> CommandAbstractor<DdType, ValueType>::getPredicateValues(storm::solver::SmtSolver::ModelReference const& model, std::vector<std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>>> const& variablePredicates) const {
+                std::vector<storm::storage::BitVector> result;
+                result.reserve(variablePredicates.size());
+                for (auto const& updateVariablePredicates : variablePredicates) {
+                    result.push_back(getPredicateValues(model, updateVariablePredicates));
+                }
+                return result;
+            }
+            
+            template <storm::dd::DdType DdType, typename ValueType>
+            storm::dd::Bdd<DdType> CommandAbstractor<DdType, ValueType>::getSourceStateBdd(storm::storage::BitVector const& values, std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> const& variablePredicates) const {
                 storm::dd::Bdd<DdType> result = this->getAbstractionInformation().getDdManager().getBddOne();
-                for (auto variableIndexPairIt = variablePredicates.rbegin(), variableIndexPairIte = variablePredicates.rend(); variableIndexPairIt != variableIndexPairIte; ++variableIndexPairIt) {
-                    auto const& variableIndexPair = *variableIndexPairIt;
-                    if (model.getBooleanValue(variableIndexPair.first)) {
-                        result &= this->getAbstractionInformation().encodePredicateAsSource(variableIndexPair.second);
+                for (uint64_t index = variablePredicates.size(); index > 0; --index) {
+                    uint64_t predicateIndex = variablePredicates[index - 1].second;
+                    if (values.get(index - 1)) {
+                        result &= this->getAbstractionInformation().encodePredicateAsSource(predicateIndex);
                     } else {
-                        result &= !this->getAbstractionInformation().encodePredicateAsSource(variableIndexPair.second);
+                        result &= !this->getAbstractionInformation().encodePredicateAsSource(predicateIndex);
                     }
                 }
                 
@@ -594,19 +696,19 @@ namespace storm {
             }
             
             template <storm::dd::DdType DdType, typename ValueType>
-            storm::dd::Bdd<DdType> CommandAbstractor<DdType, ValueType>::getDistributionBdd(storm::solver::SmtSolver::ModelReference const& model, std::vector<std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>>> const& variablePredicates) const {
+            storm::dd::Bdd<DdType> CommandAbstractor<DdType, ValueType>::getDistributionBdd(std::vector<storm::storage::BitVector> const& values, std::vector<std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>>> const& variablePredicates) const {
                 storm::dd::Bdd<DdType> result = this->getAbstractionInformation().getDdManager().getBddZero();
                 
                 for (uint_fast64_t updateIndex = 0; updateIndex < command.get().getNumberOfUpdates(); ++updateIndex) {
                     storm::dd::Bdd<DdType> updateBdd = this->getAbstractionInformation().getDdManager().getBddOne();
                     
                     // Translate block variables for this update into a successor block.
-                    for (auto variableIndexPairIt = variablePredicates[updateIndex].rbegin(), variableIndexPairIte = variablePredicates[updateIndex].rend(); variableIndexPairIt != variableIndexPairIte; ++variableIndexPairIt) {
-                        auto const& variableIndexPair = *variableIndexPairIt;
-                        if (model.getBooleanValue(variableIndexPair.first)) {
-                            updateBdd &= this->getAbstractionInformation().encodePredicateAsSuccessor(variableIndexPair.second);
+                    for (uint64_t index = variablePredicates[updateIndex].size(); index > 0; --index) {
+                        uint64_t predicateIndex = variablePredicates[updateIndex][index - 1].second;
+                        if (values[updateIndex].get(index - 1)) {
+                            updateBdd &= this->getAbstractionInformation().encodePredicateAsSuccessor(predicateIndex);
                         } else {
-                            updateBdd &= !this->getAbstractionInformation().encodePredicateAsSuccessor(variableIndexPair.second);
+                            updateBdd &= !this->getAbstractionInformation().encodePredicateAsSuccessor(predicateIndex);
                         }
                     }
 
@@ -4,6 +4,9 @@
 #include <vector>
 #include <set>
 #include <map>
+#include <shared_mutex>
+
+#include <boost/optional.hpp>
 
 #include "storm/abstraction/LocalExpressionInformation.h"
 #include "storm/abstraction/StateSetAbstractor.h"
@@ -14,6 +17,8 @@
 #include "storm/storage/dd/DdType.h"
 #include "storm/storage/expressions/Expression.h"
 
+#include "storm/storage/BitVector.h"
+
 #include "storm/solver/SmtSolver.h"
 
 namespace storm {
@@ -94,6 +99,18 @@ namespace storm {
                  */
                 GameBddResult<DdType> abstract();
                 
+                /*!
+                 * Enumerates the solutions of the SMT problem underlying the abstraction of the command (if it needs to
+                 * be recomputed) and stores them for the next call to <code>abstract</code>. As this neither touches
+                 * any DDs nor modifies the abstraction information, it may be called concurrently for different
+                 * commands.
+                 *
+                 * @param managerMutex If given, translating expressions for the solver (which may declare auxiliary
+                 * variables in the shared expression manager) is done under an exclusive lock and reading solutions
+                 * under a shared lock of this mutex.
+                 */
+                void enumerateSolutions(std::shared_timed_mutex* managerMutex = nullptr);
+                
                 /*!
                  * Retrieves the transitions to bottom states of this command.
                  *
@@ -120,6 +137,37 @@ namespace storm {
                 void notifyGuardIsPredicate();
                 
             private:
+                // A set of source and successor predicates together with the solutions enumerated for them.
+                struct SolutionBlock {
+                    // The variables (and predicates) relevant for the source states.
+                    std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> sourceVariablesAndPredicates;
+                    
+                    // The variables (and predicates) relevant for the successor states of each update.
+                    std::vector<std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>>> destinationVariablesAndPredicates;
+                    
+                    // The solutions given by the values of the source variables and of the successor variables per update.
+                    std::vector<std::pair<storm::storage::BitVector, std::vector<storm::storage::BitVector>>> solutions;
+                };
+                
+                // The solutions enumerated for the command, from which the BDD is then built.
+                struct EnumerationResult {
+                    EnumerationResult() : enumerateAbstractGuard(false), numberOfSolutions(0) {
+                        // Intentionally left empty.
+                    }
+                    
+                    // Whether the abstract guard was enumerated separately (only used with the decomposition).
+                    bool enumerateAbstractGuard;
+                    
+                    // The solutions of the abstract guard (if it was enumerated).
+                    SolutionBlock guardBlock;
+                    
+                    // The solutions for each block (of the decomposition).
+                    std::vector<SolutionBlock> blocks;
+                    
+                    // The total number of enumerated solutions.
+                    uint64_t numberOfSolutions;
+                };
+                
                 /*!
                  * Determines the relevant predicates for source as well as successor states wrt. to the given assignments
                  * (that, for example, form an update).
@@ -154,20 +202,38 @@ namespace storm {
                 void addMissingPredicates(std::pair<std::set<uint_fast64_t>, std::vector<std::set<uint_fast64_t>>> const& newRelevantPredicates);
                 
                 /*!
-                 * Translates the given model to a source state DD.
+                 * Retrieves the truth values that the given model assigns to the given variables.
+                 *
+                 * @param model The model to evaluate.
+                 * @param variablePredicates The variables (and their predicates) whose values to retrieve.
+                 * @return A bit vector whose i-th bit is set iff the i-th variable is true in the model.
+                 */
+                storm::storage::BitVector getPredicateValues(storm::solver::SmtSolver::ModelReference const& model, std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> const& variablePredicates) const;
+                
+                /*!
+                 * Retrieves the truth values that the given model assigns to the given variables of each update.
                  *
-                 * @param model The model to translate.
+                 * @param model The model to evaluate.
+                 * @param variablePredicates The variables (and their predicates) of each update whose values to retrieve.
+                 * @return The values for each of the updates.
+                 */
+                std::vector<storm::storage::BitVector> getPredicateValues(storm::solver::SmtSolver::ModelReference const& model, std::vector<std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>>> const& variablePredicates) const;
+                
+                /*!
+                 * Translates the given predicate values to a source state DD.
+                 *
+                 * @param values The values of the predicates.
                  * @return The source state encoded as a DD.
                  */
-                storm::dd::Bdd<DdType> getSourceStateBdd(storm::solver::SmtSolver::ModelReference const& model, std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> const& variablePredicates) const;
+                storm::dd::Bdd<DdType> getSourceStateBdd(storm::storage::BitVector const& values, std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>> const& variablePredicates) const;
 
                 /*!
-                 * Translates the given model to a distribution over successor states.
+                 * Translates the given predicate values to a distribution over successor states.
                  *
-                 * @param model The model to translate.
+                 * @param values The values of the predicates for each of the updates.
                  * @return The source state encoded as a DD.
                  */
-                storm::dd::Bdd<DdType> getDistributionBdd(storm::solver::SmtSolver::ModelReference const& model, std::vector<std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>>> const& variablePredicates) const;
+                storm::dd::Bdd<DdType> getDistributionBdd(std::vector<storm::storage::BitVector> const& values, std::vector<std::vector<std::pair<storm::expressions::Variable, uint_fast64_t>>> const& variablePredicates) const;
                 
                 /*!
                  * Recomputes the cached BDD. This needs to be triggered if any relevant predicates change.
@@ -175,12 +241,22 @@ namespace storm {
                 void recomputeCachedBdd();
                 
                 /*!
-                 * Recomputes the cached BDD without using the decomposition.
+                 * Enumerates the solutions without using the decomposition.
+                 */
+                void enumerateSolutionsWithoutDecomposition(std::shared_timed_mutex* managerMutex);
+                
+                /*!
+                 * Enumerates the solutions using the decomposition.
+                 */
+                void enumerateSolutionsWithDecomposition(std::shared_timed_mutex* managerMutex);
+                
+                /*!
+                 * Recomputes the cached BDD from the enumerated solutions without using the decomposition.
                  */
                 void recomputeCachedBddWithoutDecomposition();
                 
                 /*!
-                 * Recomputes the cached BDD using th decomposition.
+                 * Recomputes the cached BDD from the enumerated solutions using the decomposition.
                  */
                 void recomputeCachedBddWithDecomposition();
 
@@ -257,6 +333,9 @@ namespace storm {
                 // A flag remembering whether we need to force recomputation of the BDD.
                 bool forceRecomputation;
                 
+                // If set, the solutions that were enumerated to recompute the BDD.
+                boost::optional<EnumerationResult> enumerationResult;
+                
                 // The abstract guard of the command. This is only used if the guard is not a predicate, because it can
                 // then be used to constrain the bottom state abstractor.
                 storm::dd::Bdd<DdType> abstractGuard;
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/models/sparse/Model.h"
+#include "storm/simulator/ImportanceSplittingSimulator.h"
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+    namespace api {
+        
+        //
+        // Estimating (rare) reachability probabilities by importance splitting
+        //
+        struct ImportanceSplittingOptions {
+            // The number of trajectories started on each level.
+            uint64_t effortPerLevel = 1000;
+            // The number of independent runs the confidence interval is computed from.
+            uint64_t numberOfRuns = 10;
+            // The number of steps after which a trajectory that did not reach the next level is abandoned.
+            uint64_t maximalPathLength = 10000;
+            // The number of threads executing the runs (0 means one per available core).
+            uint64_t numberOfThreads = 1;
+            uint64_t seed = 0;
+            double confidenceLevel = 0.95;
+            // The importance of each state. If not given, it is derived from the graph distance to the target states.
+            boost::optional<std::vector<uint64_t>> importanceFunction;
+        };
+        
+        template<typename ValueType>
+        storm::simulator::RareEventEstimate estimateReachabilityProbabilityWithImportanceSplitting(storm::models::sparse::Model<ValueType> const& model, storm::storage::BitVector const& targetStates, ImportanceSplittingOptions const& options = ImportanceSplittingOptions()) {
+            storm::simulator::ImportanceSplittingSimulator<ValueType> simulator(model, targetStates);
+            if (options.importanceFunction) {
+                simulator.setImportanceFunction(options.importanceFunction.get());
+            }
+            simulator.setEffortPerLevel(options.effortPerLevel);
+            simulator.setNumberOfRuns(options.numberOfRuns);
+            simulator.setMaximalPathLength(options.maximalPathLength);
+            simulator.setNumberOfThreads(options.numberOfThreads);
+            simulator.setSeed(options.seed);
+            return simulator.estimateReachabilityProbability(options.confidenceLevel);
+        }
+        
+        template<typename ValueType>
+        storm::simulator::RareEventEstimate estimateReachabilityProbabilityWithImportanceSplitting(storm::models::sparse::Model<ValueType> const& model, std::string const& targetLabel, ImportanceSplittingOptions const& options = ImportanceSplittingOptions()) {
+            return estimateReachabilityProbabilityWithImportanceSplitting(model, model.getStates(targetLabel), options);
+        }
+        
+    }
+}
@@ -6,3 +6,4 @@
 #include "storm/api/transformation.h"
 #include "storm/api/verification.h"
 #include "storm/api/export.h"
+#include "storm/api/simulation.h"
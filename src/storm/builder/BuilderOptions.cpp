@@ -39,7 +39,7 @@ namespace storm {
         }
         
 
-        BuilderOptions::BuilderOptions(bool buildAllRewardModels, bool buildAllLabels) : buildAllRewardModels(buildAllRewardModels), buildAllLabels(buildAllLabels), applyMaximalProgressAssumption(false), buildChoiceLabels(false), buildStateValuations(false), buildChoiceOrigins(false), scaleAndLiftTransitionRewards(true), explorationChecks(false), inferObservationsFromActions(false), addOverlappingGuardsLabel(false), addOutOfBoundsState(false), reservedBitsForUnboundedVariables(32), showProgress(false), showProgressDelay(0) {
+        BuilderOptions::BuilderOptions(bool buildAllRewardModels, bool buildAllLabels) : buildAllRewardModels(buildAllRewardModels), buildAllLabels(buildAllLabels), applyMaximalProgressAssumption(false), buildChoiceLabels(false), buildStateValuations(false), buildChoiceOrigins(false), scaleAndLiftTransitionRewards(true), explorationChecks(false), inferObservationsFromActions(false), addOverlappingGuardsLabel(false), addOutOfBoundsState(false), symmetryReduction(false), guardCaching(false), reservedBitsForUnboundedVariables(32), showProgress(false), showProgressDelay(0) {
             // Intentionally left empty.
         }
         
@@ -167,6 +167,14 @@ namespace storm {
             return addOverlappingGuardsLabel;
         }
 
+        bool BuilderOptions::isSymmetryReductionSet() const {
+            return symmetryReduction;
+        }
+
+        bool BuilderOptions::isGuardCachingSet() const {
+            return guardCaching;
+        }
+
         BuilderOptions& BuilderOptions::setBuildAllRewardModels(bool newValue) {
             buildAllRewardModels = newValue;
             return *this;
@@ -263,6 +271,16 @@ namespace storm {
             return *this;
         }
 
+        BuilderOptions& BuilderOptions::setSymmetryReduction(bool newValue) {
+            symmetryReduction = newValue;
+            return *this;
+        }
+
+        BuilderOptions& BuilderOptions::setGuardCaching(bool newValue) {
+            guardCaching = newValue;
+            return *this;
+        }
+
         BuilderOptions& BuilderOptions::substituteExpressions(std::function<storm::expressions::Expression(storm::expressions::Expression const&)> const& substitutionFunction) {
             for (auto& e : expressionLabels) {
                 e.second = substitutionFunction(e.second);
@@ -116,6 +116,8 @@ namespace storm {
             bool isAddOutOfBoundsStateSet() const;
             uint64_t getReservedBitsForUnboundedVariables() const;
             bool isAddOverlappingGuardLabelSet() const;
+            bool isSymmetryReductionSet() const;
+            bool isGuardCachingSet() const;
             uint64_t getShowProgressDelay() const;
 
             /**
@@ -197,6 +199,18 @@ namespace storm {
              */
             BuilderOptions& setAddOverlappingGuardsLabel(bool newValue = true);
 
+            /**
+             * Should states that only differ by a permutation of fully symmetric (renamed) modules be merged
+             * @param newValue the new value (default true)
+             */
+            BuilderOptions& setSymmetryReduction(bool newValue = true);
+
+            /**
+             * Should the enabled commands of a module be cached w.r.t. the values of the variables its guards depend on
+             * @param newValue the new value (default true)
+             */
+            BuilderOptions& setGuardCaching(bool newValue = true);
+
             /**
              * Sets the number of bits that will be reserved for unbounded integer variables.
              */
@@ -256,6 +270,12 @@ namespace storm {
             /// A flag indicating that the an additional state for out of bounds should be created.
             bool addOutOfBoundsState;
 
+            /// A flag indicating that states are canonicalized w.r.t. symmetric module replications.
+            bool symmetryReduction;
+
+            /// A flag indicating that guard evaluations are cached per module.
+            bool guardCaching;
+
             /// Indicates the number of bits that are reserved for the storage of unbounded integer variables.
             uint64_t reservedBitsForUnboundedVariables;
 
@@ -483,7 +483,7 @@ namespace storm {
         
         template <storm::dd::DdType Type, typename ValueType>
         struct ComposerResult {
-            ComposerResult(storm::dd::Add<Type, ValueType> const& transitions, std::map<storm::expressions::Variable, storm::dd::Add<Type, ValueType>> const& transientLocationAssignments, std::map<storm::expressions::Variable, storm::dd::Add<Type, ValueType>> const& transientEdgeAssignments, storm::dd::Bdd<Type> const& illegalFragment, uint64_t numberOfNondeterminismVariables = 0) : transitions(transitions), transientLocationAssignments(transientLocationAssignments), transientEdgeAssignments(transientEdgeAssignments), illegalFragment(illegalFragment), numberOfNondeterminismVariables(numberOfNondeterminismVariables) {
+            ComposerResult(storm::dd::Add<Type, ValueType> const& transitions, std::map<storm::expressions::Variable, storm::dd::Add<Type, ValueType>> const& transientLocationAssignments, std::map<storm::expressions::Variable, storm::dd::Add<Type, ValueType>> const& transientEdgeAssignments, storm::dd::Bdd<Type> const& illegalFragment, uint64_t numberOfNondeterminismVariables = 0, std::vector<storm::dd::Bdd<Type>> const& transitionParts = {}) : transitions(transitions), transientLocationAssignments(transientLocationAssignments), transientEdgeAssignments(transientEdgeAssignments), illegalFragment(illegalFragment), numberOfNondeterminismVariables(numberOfNondeterminismVariables), transitionParts(transitionParts) {
                 // Intentionally left empty.
             }
             
@@ -492,6 +492,9 @@ namespace storm {
             std::map<storm::expressions::Variable, storm::dd::Add<Type, ValueType>> transientEdgeAssignments;
             storm::dd::Bdd<Type> illegalFragment;
             uint64_t numberOfNondeterminismVariables;
+            
+            // The transition relations of the individual actions (only built for the partitioned reachability analysis).
+            std::vector<storm::dd::Bdd<Type>> transitionParts;
         };
         
         // A class that is responsible for performing the actual composition. This
@@ -850,14 +853,19 @@ namespace storm {
                 
                 // The local nondeterminism variables used by this action DD, given as the lowest and highest variable index.
                 std::pair<uint64_t, uint64_t> localNondeterminismVariables;
+                
+                // The transition relations of the action DDs before they were combined. They are not multiplied with the
+                // identities of the variables they leave unchanged.
+                std::vector<storm::dd::Bdd<Type>> transitionParts;
             };
             
-            CombinedEdgesSystemComposer(storm::jani::Model const& model, storm::jani::CompositionInformation const& actionInformation, CompositionVariables<Type, ValueType> const& variables, std::vector<storm::expressions::Variable> const& transientVariables, bool applyMaximumProgress) : SystemComposer<Type, ValueType>(model, variables, transientVariables), actionInformation(actionInformation), applyMaximumProgress(applyMaximumProgress) {
+            CombinedEdgesSystemComposer(storm::jani::Model const& model, storm::jani::CompositionInformation const& actionInformation, CompositionVariables<Type, ValueType> const& variables, std::vector<storm::expressions::Variable> const& transientVariables, bool applyMaximumProgress, bool buildTransitionParts) : SystemComposer<Type, ValueType>(model, variables, transientVariables), actionInformation(actionInformation), applyMaximumProgress(applyMaximumProgress), buildTransitionParts(buildTransitionParts) {
                 // Intentionally left empty.
             }
         
             storm::jani::CompositionInformation const& actionInformation;
             bool applyMaximumProgress;
+            bool buildTransitionParts;
 
             ComposerResult<Type, ValueType> compose() override {
                 STORM_LOG_THROW(this->model.hasStandardCompliantComposition(), storm::exceptions::WrongFormatException, "Model builder only supports non-nested parallel compositions.");
@@ -1084,6 +1092,12 @@ namespace storm {
 
                 // Finally, combine (potentially) multiple action DDs.
                 for (auto const& actionDds : actions) {
+                    if (buildTransitionParts) {
+                        for (ActionDd const& actionDd : actionDds.second) {
+                            addTransitionPart(result.transitionParts, actionDd);
+                        }
+                    }
+                    
                     ActionDd combinedAction;
                     if (actionDds.first == silentMarkovianActionIdentification) {
                         // For the Markovian transitions, we can simply add the actions.
@@ -1829,8 +1843,23 @@ namespace storm {
                 action.transitions *= missingIdentities;
             }
             
+            void addTransitionPart(std::vector<storm::dd::Bdd<Type>>& parts, ActionDd const& action) const {
+                storm::dd::Bdd<Type> part = action.transitions.notZero().existsAbstract(this->variables.allNondeterminismVariables);
+                if (!part.isZero()) {
+                    parts.push_back(part);
+                }
+            }
+            
             ComposerResult<Type, ValueType> buildSystemFromAutomaton(AutomatonDd& automaton) {
                 STORM_LOG_TRACE("Building system from final automaton.");
+                
+                // If the system is not a parallel composition, there were no action DDs to collect, so we use one part
+                // per action of the automaton.
+                if (buildTransitionParts && automaton.transitionParts.empty()) {
+                    for (auto const& action : automaton.actions) {
+                        addTransitionPart(automaton.transitionParts, action.second);
+                    }
+                }
 
                 auto modelType = this->model.getModelType();
                 
@@ -1869,7 +1898,7 @@ namespace storm {
                         result += extendedTransitions;
                     }
                     
-                    return ComposerResult<Type, ValueType>(result, automaton.transientLocationAssignments, transientEdgeAssignments, illegalFragment, numberOfUsedNondeterminismVariables);
+                    return ComposerResult<Type, ValueType>(result, automaton.transientLocationAssignments, transientEdgeAssignments, illegalFragment, numberOfUsedNondeterminismVariables, automaton.transitionParts);
                 } else if (modelType == storm::jani::ModelType::DTMC || modelType == storm::jani::ModelType::CTMC) {
                     // Simply add all actions, but make sure to include the missing global variable identities.
 
@@ -1886,7 +1915,7 @@ namespace storm {
                         result += action.second.transitions;
                     }
 
-                    return ComposerResult<Type, ValueType>(result, automaton.transientLocationAssignments, transientEdgeAssignments, illegalFragment, 0);
+                    return ComposerResult<Type, ValueType>(result, automaton.transientLocationAssignments, transientEdgeAssignments, illegalFragment, 0, automaton.transitionParts);
                 } else {
                     STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Model type '" << this->model.getModelType() << "' not supported.");
                 }
@@ -2122,6 +2151,17 @@ namespace storm {
             return result;
         }
         
+        template <storm::dd::DdType Type, typename ValueType>
+        std::vector<std::pair<std::string, storm::dd::DdManagerStatistics>> const& DdJaniModelBuilder<Type, ValueType>::getDdStatistics() const {
+            return ddStatistics;
+        }
+        
+        template <storm::dd::DdType Type, typename ValueType>
+        void DdJaniModelBuilder<Type, ValueType>::recordDdStatistics(std::string const& phase, storm::dd::DdManager<Type> const& manager) {
+            ddStatistics.emplace_back(phase, manager.getStatistics());
+            STORM_LOG_INFO("DD statistics after " << phase << ":" << std::endl << ddStatistics.back().second);
+        }
+        
         template <storm::dd::DdType Type, typename ValueType>
         std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> DdJaniModelBuilder<Type, ValueType>::build(storm::jani::Model const& model, Options const& options) {
             if (!std::is_same<ValueType, storm::RationalFunction>::value && model.hasUndefinedConstants()) {
@@ -2175,8 +2215,11 @@ namespace storm {
             
             // Create a builder to compose and build the model.
             bool applyMaximumProgress = options.applyMaximumProgressAssumption && model.getModelType() == storm::jani::ModelType::MA;
-            CombinedEdgesSystemComposer<Type, ValueType> composer(preparedModel, actionInformation, variables, rewardVariables, applyMaximumProgress);
+            storm::utility::dd::ReachabilityMethod reachabilityMethod = storm::settings::getModule<storm::settings::modules::BuildSettings>().getSymbolicReachabilityMethod();
+            CombinedEdgesSystemComposer<Type, ValueType> composer(preparedModel, actionInformation, variables, rewardVariables, applyMaximumProgress, reachabilityMethod != storm::utility::dd::ReachabilityMethod::Monolithic);
+            ddStatistics.clear();
             ComposerResult<Type, ValueType> system = composer.compose();
+            recordDdStatistics("translating the automata", *variables.manager);
 
             // Postprocess the variables in place.
             postprocessVariables(preparedModel.getModelType(), system, variables);
@@ -2201,7 +2244,17 @@ namespace storm {
             if (preparedModel.getModelType() == storm::jani::ModelType::MDP || preparedModel.getModelType() == storm::jani::ModelType::LTS || preparedModel.getModelType() == storm::jani::ModelType::MA) {
                 transitionMatrixBdd = transitionMatrixBdd.existsAbstract(variables.allNondeterminismVariables);
             }
-            modelComponents.reachableStates = storm::utility::dd::computeReachableStates(modelComponents.initialStates, transitionMatrixBdd, variables.rowMetaVariables, variables.columnMetaVariables).first;
+            std::vector<storm::dd::Bdd<Type>> transitionParts;
+            if (reachabilityMethod == storm::utility::dd::ReachabilityMethod::Monolithic) {
+                modelComponents.reachableStates = storm::utility::dd::computeReachableStates(modelComponents.initialStates, transitionMatrixBdd, variables.rowMetaVariables, variables.columnMetaVariables).first;
+            } else {
+                // Use the transition relations of the individual actions that the composer kept aside.
+                transitionParts = std::move(system.transitionParts);
+                for (auto& part : transitionParts) {
+                    part &= !terminalStates;
+                }
+                modelComponents.reachableStates = storm::utility::dd::computeReachableStates(modelComponents.initialStates, transitionParts, variables.rowColumnMetaVariablePairs, reachabilityMethod).first;
+            }
             
             // Check that the reachable fragment does not overlap with the illegal fragment.
             storm::dd::Bdd<Type> reachableIllegalFragment = modelComponents.reachableStates && system.illegalFragment;
@@ -2210,6 +2263,7 @@ namespace storm {
             // Cut transitions to reachable states.
             storm::dd::Add<Type, ValueType> reachableStatesAdd = modelComponents.reachableStates.template toAdd<ValueType>();
             modelComponents.transitionMatrix = system.transitions * reachableStatesAdd;
+            recordDdStatistics("reachability analysis", *variables.manager);
 
             // Fix deadlocks if existing.
             modelComponents.deadlockStates = fixDeadlocks(preparedModel.getModelType(), modelComponents.transitionMatrix, transitionMatrixBdd, modelComponents.reachableStates, variables);
@@ -2219,9 +2273,21 @@ namespace storm {
             
             // Build the reward models.
             modelComponents.rewardModels = buildRewardModels(reachableStatesAdd, modelComponents.transitionMatrix, preparedModel.getModelType(), variables, system, rewardVariables);
+            recordDdStatistics("building the reward models", *variables.manager);
             
             // Finally, create the model.
-            return createModel(preparedModel.getModelType(), variables, modelComponents);
+            std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> result = createModel(preparedModel.getModelType(), variables, modelComponents);
+            
+            // Keep the parts of the transition relation, so the qualitative analyses can use them as well. As the
+            // parts are collected before the maximum progress assumption removes transitions, they are only kept without it.
+            if (!transitionParts.empty() && !applyMaximumProgress) {
+                for (auto& part : transitionParts) {
+                    part &= modelComponents.reachableStates;
+                }
+                result->setTransitionParts(transitionParts, reachabilityMethod);
+            }
+            
+            return result;
         }
         
         template class DdJaniModelBuilder<storm::dd::DdType::CUDD, double>;
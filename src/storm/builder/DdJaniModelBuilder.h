@@ -3,6 +3,7 @@
 #include <boost/optional.hpp>
 
 #include "storm/storage/dd/DdType.h"
+#include "storm/storage/dd/DdManagerStatistics.h"
 #include "storm/storage/jani/Property.h"
 
 #include "storm/logic/Formula.h"
@@ -10,6 +11,11 @@
 
 
 namespace storm {
+    namespace dd {
+        template <storm::dd::DdType Type>
+        class DdManager;
+    }
+    
     namespace models {
         namespace symbolic {
             template <storm::dd::DdType Type, typename ValueType>
@@ -129,6 +135,22 @@ namespace storm {
              * @return A pointer to the resulting model.
              */
             std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> build(storm::jani::Model const& model, Options const& options = Options());
+            
+            /*!
+             * Retrieves the resource usage of the DD library after each phase of the last call to <code>build</code>.
+             *
+             * @return The phases (in the order in which they were completed) together with the DD statistics.
+             */
+            std::vector<std::pair<std::string, storm::dd::DdManagerStatistics>> const& getDdStatistics() const;
+            
+        private:
+            /*!
+             * Stores (and logs) the current DD statistics of the given manager as the ones after the given phase.
+             */
+            void recordDdStatistics(std::string const& phase, storm::dd::DdManager<Type> const& manager);
+            
+            // The DD statistics after each phase of the last call to build.
+            std::vector<std::pair<std::string, storm::dd::DdManagerStatistics>> ddStatistics;
         };
         
     }
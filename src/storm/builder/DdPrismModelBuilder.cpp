@@ -263,7 +263,7 @@ namespace storm {
         template <storm::dd::DdType Type, typename ValueType>
         class ModuleComposer : public storm::prism::CompositionVisitor {
         public:
-            ModuleComposer(typename DdPrismModelBuilder<Type, ValueType>::GenerationInformation& generationInfo) : generationInfo(generationInfo) {
+            ModuleComposer(typename DdPrismModelBuilder<Type, ValueType>::GenerationInformation& generationInfo, bool buildTransitionParts) : generationInfo(generationInfo), buildTransitionParts(buildTransitionParts) {
                 // Intentionally left empty.
             }
             
@@ -292,6 +292,7 @@ namespace storm {
                 std::map<uint_fast64_t, uint_fast64_t> const& synchronizingActionToOffsetMap = boost::any_cast<std::map<uint_fast64_t, uint_fast64_t> const&>(data);
                 
                 typename DdPrismModelBuilder<Type, ValueType>::ModuleDecisionDiagram result = DdPrismModelBuilder<Type, ValueType>::createModuleDecisionDiagram(generationInfo, generationInfo.program.getModule(composition.getModuleName()), synchronizingActionToOffsetMap);
+                addTransitionPart(result.independentActionParts, result.independentAction);
                 
                 return result;
             }
@@ -415,6 +416,20 @@ namespace storm {
             }
 
         private:
+            /*!
+             * Adds the transition relation of the given action to the given parts (if parts are to be built). Unlike
+             * the composed independent action, it is not multiplied with the identities of the other modules.
+             */
+            void addTransitionPart(std::vector<storm::dd::Bdd<Type>>& parts, typename DdPrismModelBuilder<Type, ValueType>::ActionDecisionDiagram const& action) const {
+                if (!buildTransitionParts) {
+                    return;
+                }
+                storm::dd::Bdd<Type> part = action.transitionsDd.notZero().existsAbstract(generationInfo.allNondeterminismVariables);
+                if (!part.isZero()) {
+                    parts.push_back(part);
+                }
+            }
+            
             /*!
              * Hides the actions of the given module according to the given set. As a result, the module is modified in
              * place.
@@ -425,6 +440,7 @@ namespace storm {
                 for (auto const& actionIndex : actionIndicesToHide) {
                     auto it = sub.synchronizingActionToDecisionDiagramMap.find(actionIndex);
                     if (it != sub.synchronizingActionToDecisionDiagramMap.end()) {
+                        addTransitionPart(sub.independentActionParts, it->second);
                         sub.independentAction = DdPrismModelBuilder<Type, ValueType>::combineUnsynchronizedActions(generationInfo, sub.independentAction, it->second);
                         sub.numberOfUsedNondeterminismVariables = std::max(sub.numberOfUsedNondeterminismVariables, sub.independentAction.numberOfUsedNondeterminismVariables);
                         sub.synchronizingActionToDecisionDiagramMap.erase(it);
@@ -466,7 +482,9 @@ namespace storm {
                     }
                 }
                 
-                return typename DdPrismModelBuilder<Type, ValueType>::ModuleDecisionDiagram(sub.independentAction, actionIndexToDdMap, sub.identity, sub.numberOfUsedNondeterminismVariables);
+                typename DdPrismModelBuilder<Type, ValueType>::ModuleDecisionDiagram result(sub.independentAction, actionIndexToDdMap, sub.identity, sub.numberOfUsedNondeterminismVariables);
+                result.independentActionParts = std::move(sub.independentActionParts);
+                return result;
             }
             
             /*!
@@ -480,6 +498,7 @@ namespace storm {
                 uint_fast64_t numberOfUsedNondeterminismVariables = right.independentAction.numberOfUsedNondeterminismVariables;
                 left.independentAction = DdPrismModelBuilder<Type, ValueType>::combineUnsynchronizedActions(generationInfo, left.independentAction, right.independentAction, left.identity, right.identity);
                 numberOfUsedNondeterminismVariables = std::max(numberOfUsedNondeterminismVariables, left.independentAction.numberOfUsedNondeterminismVariables);
+                left.independentActionParts.insert(left.independentActionParts.end(), right.independentActionParts.begin(), right.independentActionParts.end());
 
                 // Create an empty action for the case where one of the modules does not have a certain action.
                 typename DdPrismModelBuilder<Type, ValueType>::ActionDecisionDiagram emptyAction(*generationInfo.manager);
@@ -537,6 +556,9 @@ namespace storm {
             }
             
             typename DdPrismModelBuilder<Type, ValueType>::GenerationInformation& generationInfo;
+            
+            // A flag indicating whether the transition relations of the independent actions are to be kept separately.
+            bool buildTransitionParts;
         };
         
         template <storm::dd::DdType Type, typename ValueType>
@@ -1132,7 +1154,7 @@ namespace storm {
         
         template <storm::dd::DdType Type, typename ValueType>
         typename DdPrismModelBuilder<Type, ValueType>::SystemResult DdPrismModelBuilder<Type, ValueType>::createSystemDecisionDiagram(GenerationInformation& generationInfo) {
-            ModuleComposer<Type, ValueType> composer(generationInfo);
+            ModuleComposer<Type, ValueType> composer(generationInfo, storm::settings::getModule<storm::settings::modules::BuildSettings>().getSymbolicReachabilityMethod() != storm::utility::dd::ReachabilityMethod::Monolithic);
             ModuleDecisionDiagram system = composer.compose(generationInfo.program.specifiesSystemComposition() ? generationInfo.program.getSystemCompositionConstruct().getSystemComposition() : *generationInfo.program.getDefaultSystemComposition());
 
             storm::dd::Add<Type, ValueType> result = createSystemFromModule(generationInfo, system);
@@ -1294,6 +1316,17 @@ namespace storm {
             return storm::models::symbolic::StandardRewardModel<Type, ValueType>(stateRewards, stateActionRewards, transitionRewards);
         }
         
+        template <storm::dd::DdType Type, typename ValueType>
+        std::vector<std::pair<std::string, storm::dd::DdManagerStatistics>> const& DdPrismModelBuilder<Type, ValueType>::getDdStatistics() const {
+            return ddStatistics;
+        }
+        
+        template <storm::dd::DdType Type, typename ValueType>
+        void DdPrismModelBuilder<Type, ValueType>::recordDdStatistics(std::string const& phase, storm::dd::DdManager<Type> const& manager) {
+            ddStatistics.emplace_back(phase, manager.getStatistics());
+            STORM_LOG_INFO("DD statistics after " << phase << ":" << std::endl << ddStatistics.back().second);
+        }
+        
         template <storm::dd::DdType Type, typename ValueType>
         std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> DdPrismModelBuilder<Type, ValueType>::build(storm::prism::Program const& program, Options const& options) {
             if (!std::is_same<ValueType, storm::RationalFunction>::value && program.hasUndefinedConstants()) {
@@ -1318,7 +1351,10 @@ namespace storm {
             // In particular, this creates the meta variables used to encode the model.
             GenerationInformation generationInfo(program);
             
+            ddStatistics.clear();
+            
             SystemResult system = createSystemDecisionDiagram(generationInfo);
+            recordDdStatistics("translating the modules", *generationInfo.manager);
             storm::dd::Add<Type, ValueType> transitionMatrix = system.allTransitionsDd;
             
             ModuleDecisionDiagram const& globalModule = system.globalModule;
@@ -1348,12 +1384,29 @@ namespace storm {
                 transitionMatrixBdd = transitionMatrixBdd.existsAbstract(generationInfo.allNondeterminismVariables);
             }
             
-            storm::dd::Bdd<Type> reachableStates = storm::utility::dd::computeReachableStates<Type>(initialStates, transitionMatrixBdd, generationInfo.rowMetaVariables, generationInfo.columnMetaVariables).first;
+            storm::dd::Bdd<Type> reachableStates;
+            std::vector<storm::dd::Bdd<Type>> transitionParts;
+            storm::utility::dd::ReachabilityMethod reachabilityMethod = storm::settings::getModule<storm::settings::modules::BuildSettings>().getSymbolicReachabilityMethod();
+            if (reachabilityMethod == storm::utility::dd::ReachabilityMethod::Monolithic) {
+                reachableStates = storm::utility::dd::computeReachableStates<Type>(initialStates, transitionMatrixBdd, generationInfo.rowMetaVariables, generationInfo.columnMetaVariables).first;
+            } else {
+                // Use one part per independent action of a module and one per synchronizing action of the composed system.
+                // The parts are not multiplied with the identities of the variables they do not change.
+                transitionParts = globalModule.independentActionParts;
+                for (auto const& synchronizingAction : globalModule.synchronizingActionToDecisionDiagramMap) {
+                    transitionParts.push_back(synchronizingAction.second.transitionsDd.notZero().existsAbstract(generationInfo.allNondeterminismVariables));
+                }
+                for (auto& part : transitionParts) {
+                    part &= !terminalStatesBdd;
+                }
+                reachableStates = storm::utility::dd::computeReachableStates<Type>(initialStates, transitionParts, generationInfo.rowColumnMetaVariablePairs, reachabilityMethod).first;
+            }
             storm::dd::Add<Type, ValueType> reachableStatesAdd = reachableStates.template toAdd<ValueType>();
             transitionMatrix *= reachableStatesAdd;
             if (system.stateActionDd) {
                 system.stateActionDd.get() *= reachableStatesAdd;
             }
+            recordDdStatistics("reachability analysis", *generationInfo.manager);
             
             // Detect deadlocks and 1) fix them if requested 2) throw an error otherwise.
             storm::dd::Bdd<Type> statesWithTransition = transitionMatrixBdd.existsAbstract(generationInfo.columnMetaVariables);
@@ -1422,6 +1475,7 @@ namespace storm {
             }
             
             std::unordered_map<std::string, storm::models::symbolic::StandardRewardModel<Type, ValueType>> rewardModels = createRewardModelDecisionDiagrams(selectedRewardModels, system, generationInfo, globalModule, reachableStatesAdd, transitionMatrix);
+            recordDdStatistics("building the reward models", *generationInfo.manager);
             
             // Build the labels that can be accessed as a shortcut.
             std::map<std::string, storm::expressions::Expression> labelToExpressionMapping;
@@ -1444,6 +1498,14 @@ namespace storm {
                 result->addParameters(generationInfo.parameters);
             }
             
+            // Keep the parts of the transition relation, so the qualitative analyses can use them as well.
+            if (!transitionParts.empty()) {
+                for (auto& part : transitionParts) {
+                    part &= reachableStates;
+                }
+                result->setTransitionParts(transitionParts, reachabilityMethod);
+            }
+            
             return result;
         }
         
@@ -11,6 +11,7 @@
 
 #include "storm/logic/Formulas.h"
 #include "storm/adapters/AddExpressionAdapter.h"
+#include "storm/storage/dd/DdManagerStatistics.h"
 #include "storm/utility/macros.h"
 
 namespace storm {
@@ -104,6 +105,13 @@ namespace storm {
              */
             std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> build(storm::prism::Program const& program, Options const& options = Options());
             
+            /*!
+             * Retrieves the resource usage of the DD library after each phase of the last call to <code>build</code>.
+             *
+             * @return The phases (in the order in which they were completed) together with the DD statistics.
+             */
+            std::vector<std::pair<std::string, storm::dd::DdManagerStatistics>> const& getDdStatistics() const;
+            
         private:
             // This structure can store the decision diagrams representing a particular action.
             struct UpdateDecisionDiagram {
@@ -190,6 +198,11 @@ namespace storm {
                 // The decision diagram for the independent action.
                 ActionDecisionDiagram independentAction;
                 
+                // The transition relations of the (hidden) actions that were merged into the independent action. They
+                // are only built for the partitioned reachability analysis and do not depend on the successor values of
+                // variables they leave unchanged.
+                std::vector<storm::dd::Bdd<Type>> independentActionParts;
+                
                 // A mapping from synchronizing action indices to the decision diagram.
                 std::map<uint_fast64_t, ActionDecisionDiagram> synchronizingActionToDecisionDiagramMap;
                 
@@ -249,6 +262,14 @@ namespace storm {
             static SystemResult createSystemDecisionDiagram(GenerationInformation& generationInfo);
             
             static storm::dd::Bdd<Type> createInitialStatesDecisionDiagram(GenerationInformation& generationInfo);
+            
+            /*!
+             * Stores (and logs) the current DD statistics of the given manager as the ones after the given phase.
+             */
+            void recordDdStatistics(std::string const& phase, storm::dd::DdManager<Type> const& manager);
+            
+            // The DD statistics after each phase of the last call to build.
+            std::vector<std::pair<std::string, storm::dd::DdManagerStatistics>> ddStatistics;
         };
         
     } // namespace adapters
@@ -9,6 +9,7 @@
 #include "storm/exceptions/AbortException.h"
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/exceptions/IllegalArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
 
 #include "storm/generator/PrismNextStateGenerator.h"
 #include "storm/generator/JaniNextStateGenerator.h"
@@ -41,18 +42,59 @@ namespace storm {
         template<typename StateType>
         StateType ExplicitStateLookup<StateType>::lookup(std::map<storm::expressions::Variable, storm::expressions::Expression> const& stateDescription) const {
             auto cs = storm::generator::createCompressedState(this->varInfo, stateDescription, true);
+            if (quotientMask) {
+                cs &= quotientMask.get();
+            }
             STORM_LOG_THROW(stateToId.contains(cs), storm::exceptions::IllegalArgumentException, "State unknown.");
             return this->stateToId.getValue(cs);
         }
 
         template <typename ValueType, typename RewardModelType, typename StateType>
         ExplicitModelBuilder<ValueType, RewardModelType, StateType>::Options::Options() : explorationOrder(storm::settings::getModule<storm::settings::modules::BuildSettings>().getExplorationOrder()) {
-            // Intentionally left empty.
+            auto const& buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
+            if (buildSettings.isQuotientVariablesSet()) {
+                std::vector<std::string> variableNames = buildSettings.getQuotientVariables();
+                quotientVariables.insert(variableNames.begin(), variableNames.end());
+            }
+            treeCompression = buildSettings.isTreeCompressionSet();
         }
         
         template <typename ValueType, typename RewardModelType, typename StateType>
-        ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilder(std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> const& generator, Options const& options) : generator(generator), options(options), stateStorage(generator->getStateSize()) {
-            // Intentionally left empty.
+        ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilder(std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> const& generator, Options const& options) : generator(generator), options(options), stateStorage(generator->getStateSize(), options.treeCompression) {
+            if (options.treeCompression) {
+                // The tree-compressed storage only keeps the stored (masked) states and retrieves the states to explore
+                // from it in the order of their indices.
+                STORM_LOG_THROW(options.quotientVariables.empty(), storm::exceptions::NotSupportedException, "Tree compression of the states cannot be combined with merging states w.r.t. variables.");
+                STORM_LOG_THROW(options.explorationOrder == ExplorationOrder::Bfs, storm::exceptions::NotSupportedException, "Tree compression of the states requires breadth-first exploration.");
+                STORM_LOG_THROW(!generator->isPartiallyObservable(), storm::exceptions::NotSupportedException, "Tree compression of the states is not supported for partially observable models.");
+            }
+            if (!options.quotientVariables.empty()) {
+                // Labels, rewards and observations are computed from the merged states, so they must not depend on
+                // the variables that are to be ignored.
+                for (auto const& variable : generator->getVariablesOfLabelsRewardsAndObservations()) {
+                    STORM_LOG_THROW(options.quotientVariables.count(variable.getName()) == 0, storm::exceptions::IllegalArgumentException, "Unable to merge states with respect to variable '" << variable.getName() << "', because a label, reward model or observation refers to it.");
+                }
+                
+                // Determine the bits that encode the variables that are to be ignored.
+                std::set<std::string> remainingVariables = options.quotientVariables;
+                storm::storage::BitVector ignoredBits(generator->getStateSize());
+                for (auto const& booleanVariable : generator->getVariableInformation().booleanVariables) {
+                    if (remainingVariables.erase(booleanVariable.getName()) > 0) {
+                        STORM_LOG_THROW(!generator->isPartiallyObservable() || !booleanVariable.observable, storm::exceptions::IllegalArgumentException, "Unable to merge states with respect to observable variable '" << booleanVariable.getName() << "'.");
+                        ignoredBits.set(booleanVariable.bitOffset);
+                    }
+                }
+                for (auto const& integerVariable : generator->getVariableInformation().integerVariables) {
+                    if (remainingVariables.erase(integerVariable.getName()) > 0) {
+                        STORM_LOG_THROW(!generator->isPartiallyObservable() || !integerVariable.observable, storm::exceptions::IllegalArgumentException, "Unable to merge states with respect to observable variable '" << integerVariable.getName() << "'.");
+                        for (uint_fast64_t bit = integerVariable.bitOffset; bit < integerVariable.bitOffset + integerVariable.bitWidth; ++bit) {
+                            ignoredBits.set(bit);
+                        }
+                    }
+                }
+                STORM_LOG_THROW(remainingVariables.empty(), storm::exceptions::IllegalArgumentException, "Unable to merge states with respect to unknown variable '" << *remainingVariables.begin() << "'.");
+                quotientMask = ~ignoredBits;
+            }
         }
         
         template <typename ValueType, typename RewardModelType, typename StateType>
@@ -91,19 +133,35 @@ namespace storm {
         StateType ExplicitModelBuilder<ValueType, RewardModelType, StateType>::getOrAddStateIndex(CompressedState const& state) {
             StateType newIndex = static_cast<StateType>(stateStorage.getNumberOfStates());
             
-            // Check, if the state was already registered.
-            std::pair<StateType, std::size_t> actualIndexBucketPair = stateStorage.stateToId.findOrAddAndGetBucket(state, newIndex);
+            // If the generator exploits symmetries, the state is replaced by its canonical representative, which is
+            // then both stored and explored.
+            CompressedState canonicalState;
+            if (generator->requiresStateCanonicalization()) {
+                canonicalState = state;
+                generator->canonicalizeState(canonicalState);
+            }
+            CompressedState const& representative = generator->requiresStateCanonicalization() ? canonicalState : state;
+            
+            // If the states are stored tree-compressed, the new states need not be remembered separately, because
+            // they are explored in the order of their indices, which is the order in which they were added.
+            if (stateStorage.stateTree) {
+                return static_cast<StateType>(stateStorage.stateTree->findOrAdd(representative).first);
+            }
+            
+            // Check, if the state was already registered. If states are merged, only the representative that was
+            // found first is explored, but all merged states are registered under their common (masked) key.
+            std::pair<StateType, std::size_t> actualIndexBucketPair = quotientMask ? stateStorage.stateToId.findOrAddAndGetBucket(representative & quotientMask.get(), newIndex) : stateStorage.stateToId.findOrAddAndGetBucket(representative, newIndex);
             
             StateType actualIndex = actualIndexBucketPair.first;
             
             if (actualIndex == newIndex) {
                 if (options.explorationOrder == ExplorationOrder::Dfs) {
-                    statesToExplore.emplace_front(state, actualIndex);
+                    statesToExplore.emplace_front(representative, actualIndex);
 
                     // Reserve one slot for the new state in the remapping.
                     stateRemapping.get().push_back(storm::utility::zero<StateType>());
                 } else if (options.explorationOrder == ExplorationOrder::Bfs) {
-                    statesToExplore.emplace_back(state, actualIndex);
+                    statesToExplore.emplace_back(representative, actualIndex);
                 } else {
                     STORM_LOG_ASSERT(false, "Invalid exploration order.");
                 }
@@ -114,7 +172,8 @@ namespace storm {
 
         template <typename ValueType, typename RewardModelType, typename StateType>
         ExplicitStateLookup<StateType> ExplicitModelBuilder<ValueType, RewardModelType, StateType>::exportExplicitStateLookup() const {
-            return ExplicitStateLookup<StateType>(this->generator->getVariableInformation(), this->stateStorage.stateToId);
+            STORM_LOG_THROW(!this->stateStorage.stateTree, storm::exceptions::NotSupportedException, "Exporting the state lookup is not supported for tree-compressed states.");
+            return ExplicitStateLookup<StateType>(this->generator->getVariableInformation(), this->stateStorage.stateToId, quotientMask);
         }
 
         template <typename ValueType, typename RewardModelType, typename StateType>
@@ -150,11 +209,19 @@ namespace storm {
             uint64_t numberOfExploredStatesSinceLastMessage = 0;
             
             // Perform a search through the model.
-            while (!statesToExplore.empty()) {
+            while (stateStorage.stateTree ? numberOfExploredStates < stateStorage.getNumberOfStates() : !statesToExplore.empty()) {
                 // Get the first state in the queue.
-                CompressedState currentState = statesToExplore.front().first;
-                StateType currentIndex = statesToExplore.front().second;
-                statesToExplore.pop_front();
+                CompressedState currentState;
+                StateType currentIndex;
+                if (stateStorage.stateTree) {
+                    // The states are explored in the order of their indices, so we can reconstruct the next state.
+                    currentIndex = static_cast<StateType>(numberOfExploredStates);
+                    currentState = stateStorage.stateTree->getBitVector(currentIndex);
+                } else {
+                    currentState = statesToExplore.front().first;
+                    currentIndex = statesToExplore.front().second;
+                    statesToExplore.pop_front();
+                }
                 
                 // If the exploration order differs from breadth-first, we remember that this row group was actually
                 // filled with the transitions of a different state.
@@ -281,6 +348,10 @@ namespace storm {
                 }
             }
             
+            if (stateStorage.stateTree) {
+                STORM_LOG_INFO("Stored " << stateStorage.getNumberOfStates() << " states using " << stateStorage.stateTree->getNumberOfNodes() << " tree nodes (" << stateStorage.stateTree->getSizeInMemory() / 1024 << " KB).");
+            }
+            
             if (markovianStates) {
                 // Since we now know the correct size, cut the bit vector to the correct length.
                 markovianStates->resize(currentRowGroup, false);
@@ -5,6 +5,7 @@
 #include <utility>
 #include <vector>
 #include <deque>
+#include <set>
 #include <cstdint>
 #include <boost/functional/hash.hpp>
 #include <boost/container/flat_map.hpp>
@@ -49,7 +50,7 @@ namespace storm {
         class ExplicitStateLookup {
         public:
             ExplicitStateLookup(VariableInformation const& varInfo,
-                                storm::storage::BitVectorHashMap<StateType> const& stateToId ) : varInfo(varInfo), stateToId(stateToId) {
+                                storm::storage::BitVectorHashMap<StateType> const& stateToId, boost::optional<storm::storage::BitVector> const& quotientMask = boost::none) : varInfo(varInfo), stateToId(stateToId), quotientMask(quotientMask) {
                 // intentionally left empty.
             }
 
@@ -58,6 +59,7 @@ namespace storm {
         private:
             VariableInformation varInfo;
             storm::storage::BitVectorHashMap<StateType>  stateToId;
+            boost::optional<storm::storage::BitVector> quotientMask;
         };
         
         template<typename ValueType, typename RewardModelType = storm::models::sparse::StandardRewardModel<ValueType>, typename StateType = uint32_t>
@@ -72,6 +74,17 @@ namespace storm {
                 
                 // The order in which to explore the model.
                 ExplorationOrder explorationOrder;
+                
+                // The names of the variables whose values are ignored when identifying states. States that only
+                // differ in these variables are merged during the exploration, i.e. the first one that is found
+                // represents all of them. This is only sound if the variables affect neither the transitions, nor
+                // the rewards, nor the labels, i.e. if merging the states yields a bisimulation quotient. Building
+                // fails if a label, reward model or observation refers to one of these variables.
+                std::set<std::string> quotientVariables;
+                
+                // If set, the reachable states are stored in a tree-compressed table instead of a hash map. This
+                // requires breadth-first exploration, as the states to explore are then retrieved from the table.
+                bool treeCompression;
             };
             
             /*!
@@ -162,6 +175,9 @@ namespace storm {
             /// An optional mapping from state indices to the row groups in which they actually reside. This needs to be
             /// built in case the exploration order is not BFS.
             boost::optional<std::vector<uint_fast64_t>> stateRemapping;
+            
+            /// If states are merged during the exploration, this mask clears the bits of the ignored variables.
+            boost::optional<storm::storage::BitVector> quotientMask;
 
         };
         
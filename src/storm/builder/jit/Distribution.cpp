@@ -47,14 +47,14 @@ namespace storm {
             
             template <typename IndexType, typename ValueType>
             void Distribution<IndexType, ValueType>::add(DistributionEntry<IndexType, ValueType> const& entry) {
+                compressed &= storage.empty() || storage.back().getState() < entry.getState();
                 storage.push_back(entry);
-                compressed &= storage.back().getState() < entry.getState();
             }
 
             template <typename IndexType, typename ValueType>
             void Distribution<IndexType, ValueType>::add(IndexType const& index, ValueType const& value) {
+                compressed &= storage.empty() || storage.back().getState() < index;
                 storage.emplace_back(index, value);
-                compressed &= storage.back().getState() < index;
             }
 
             template <typename IndexType, typename ValueType>
@@ -11,9 +11,11 @@ namespace storm {
         auto const& tbSettings = storm::settings::getModule<storm::settings::modules::TimeBoundedSolverSettings>();
         maMethod = tbSettings.getMaMethod();
         maMethodSetFromDefault = tbSettings.isMaMethodSetFromDefaultValue();
+        ctmcMethod = tbSettings.getCtmcMethod();
         precision = storm::utility::convertNumber<storm::RationalNumber>(tbSettings.getPrecision());
         relative = tbSettings.isRelativePrecision();
         unifPlusKappa = storm::utility::convertNumber<storm::RationalNumber>(tbSettings.getUnifPlusKappa());
+        steadyStateDetection = tbSettings.isSteadyStateDetectionSet();
     }
     
     TimeBoundedSolverEnvironment::~TimeBoundedSolverEnvironment() {
@@ -33,6 +35,14 @@ namespace storm {
         maMethodSetFromDefault = isSetFromDefault;
     }
     
+    storm::solver::CtmcTransientMethod const& TimeBoundedSolverEnvironment::getCtmcMethod() const {
+        return ctmcMethod;
+    }
+    
+    void TimeBoundedSolverEnvironment::setCtmcMethod(storm::solver::CtmcTransientMethod value) {
+        ctmcMethod = value;
+    }
+    
     storm::RationalNumber const& TimeBoundedSolverEnvironment::getPrecision() const {
         return precision;
     }
@@ -56,5 +66,13 @@ namespace storm {
     void TimeBoundedSolverEnvironment::setUnifPlusKappa(storm::RationalNumber value) {
         unifPlusKappa = value;
     }
+    
+    bool const& TimeBoundedSolverEnvironment::isSteadyStateDetectionEnabled() const {
+        return steadyStateDetection;
+    }
+    
+    void TimeBoundedSolverEnvironment::setSteadyStateDetection(bool value) {
+        steadyStateDetection = value;
+    }
 
 }
@@ -14,6 +14,9 @@ namespace storm {
         storm::solver::MaBoundedReachabilityMethod const& getMaMethod() const;
         bool const& isMaMethodSetFromDefault() const;
         void setMaMethod(storm::solver::MaBoundedReachabilityMethod value, bool isSetFromDefault = false);
+        
+        storm::solver::CtmcTransientMethod const& getCtmcMethod() const;
+        void setCtmcMethod(storm::solver::CtmcTransientMethod value);
 
         storm::RationalNumber const& getPrecision() const;
         void setPrecision(storm::RationalNumber value);
@@ -23,14 +26,21 @@ namespace storm {
         storm::RationalNumber const& getUnifPlusKappa() const;
         void setUnifPlusKappa(storm::RationalNumber value);
 
+        bool const& isSteadyStateDetectionEnabled() const;
+        void setSteadyStateDetection(bool value);
+
     private:
         storm::solver::MaBoundedReachabilityMethod maMethod;
         bool maMethodSetFromDefault;
         
+        storm::solver::CtmcTransientMethod ctmcMethod;
+        
         storm::RationalNumber precision;
         bool relative;
         
         storm::RationalNumber unifPlusKappa;
+        
+        bool steadyStateDetection;
     };
 }
 
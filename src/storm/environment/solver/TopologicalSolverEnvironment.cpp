@@ -15,6 +15,8 @@ namespace storm {
         
         underlyingMinMaxMethod = topologicalSettings.getUnderlyingMinMaxMethod();
         underlyingMinMaxMethodSetFromDefault = topologicalSettings.isUnderlyingMinMaxMethodSetFromDefaultValue();
+        
+        directSccSize = topologicalSettings.getDirectSccSize();
     }
 
     TopologicalSolverEnvironment::~TopologicalSolverEnvironment() {
@@ -49,6 +51,14 @@ namespace storm {
         underlyingMinMaxMethod = value;
     }
     
+    uint64_t const& TopologicalSolverEnvironment::getDirectSccSize() const {
+        return directSccSize;
+    }
+    
+    void TopologicalSolverEnvironment::setDirectSccSize(uint64_t value) {
+        directSccSize = value;
+    }
+    
 
 
 }
@@ -1094,6 +1094,49 @@ namespace storm {
             return rewardModelInformation[index];
         }
         
+        template<typename ValueType, typename StateType>
+        std::set<storm::expressions::Variable> JaniNextStateGenerator<ValueType, StateType>::getVariablesOfLabelsRewardsAndObservations() const {
+            std::set<storm::expressions::Variable> variables;
+            for (auto const& variable : model.getGlobalVariables().getTransientVariables()) {
+                if (variable.isBooleanVariable() && (this->options.isBuildAllLabelsSet() || this->options.getLabelNames().find(variable.getName()) != this->options.getLabelNames().end())) {
+                    variables.insert(variable.getExpressionVariable());
+                }
+            }
+            for (auto const& rewardExpression : rewardExpressions) {
+                std::set<storm::expressions::Variable> rewardVariables = rewardExpression.second.getVariables();
+                variables.insert(rewardVariables.begin(), rewardVariables.end());
+            }
+            
+            // Labels and rewards refer to transient variables, so we also need the variables of the expressions that
+            // are assigned to them.
+            std::set<storm::expressions::Variable> result;
+            auto addAssignedVariables = [&] (storm::jani::OrderedAssignments const& assignments) {
+                for (auto const& assignment : assignments) {
+                    if (variables.find(assignment.getExpressionVariable()) != variables.end()) {
+                        std::set<storm::expressions::Variable> assignedVariables = assignment.getAssignedExpression().getVariables();
+                        result.insert(assignedVariables.begin(), assignedVariables.end());
+                    }
+                }
+            };
+            for (auto const& automaton : model.getAutomata()) {
+                for (auto const& location : automaton.getLocations()) {
+                    addAssignedVariables(location.getAssignments());
+                }
+                for (auto const& edge : automaton.getEdges()) {
+                    addAssignedVariables(edge.getAssignments());
+                    for (auto const& destination : edge.getDestinations()) {
+                        addAssignedVariables(destination.getOrderedAssignments());
+                    }
+                }
+            }
+            for (auto const& variable : variables) {
+                if (!model.getGlobalVariables().hasVariable(variable) || !model.getGlobalVariables().getVariable(variable).isTransient()) {
+                    result.insert(variable);
+                }
+            }
+            return result;
+        }
+        
         template<typename ValueType, typename StateType>
         storm::models::sparse::StateLabeling JaniNextStateGenerator<ValueType, StateType>::label(storm::storage::sparse::StateStorage<StateType> const& stateStorage, std::vector<StateType> const& initialStateIndices, std::vector<StateType> const& deadlockStateIndices) {
             // As in JANI we can use transient boolean variable assignments in locations to identify states, we need to
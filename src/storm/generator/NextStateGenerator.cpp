@@ -112,17 +112,16 @@ namespace storm {
                 result.addLabel(label.first);
             }
             
-            auto const& states = stateStorage.stateToId;
-            for (auto const& stateIndexPair : states) {
-                unpackStateIntoEvaluator(stateIndexPair.first, variableInformation, *this->evaluator);
+            stateStorage.forEachState([&] (storm::storage::BitVector const& state, StateType index) {
+                unpackStateIntoEvaluator(state, variableInformation, *this->evaluator);
                 
                 for (auto const& label : labelsAndExpressions) {
                     // Add label to state, if the corresponding expression is true.
                     if (evaluator->asBool(label.second)) {
-                        result.addLabelToState(label.first, stateIndexPair.second);
+                        result.addLabelToState(label.first, index);
                     }
                 }
-            }
+            });
             
             if (!result.containsLabel("init")) {
                 // Also label the initial state with the special label "init".
@@ -146,10 +145,10 @@ namespace storm {
                 }
             }
 
-            if (this->options.isAddOutOfBoundsStateSet() && stateStorage.stateToId.contains(outOfBoundsState)) {
+            if (this->options.isAddOutOfBoundsStateSet() && stateStorage.containsState(outOfBoundsState)) {
                 STORM_LOG_THROW(!result.containsLabel("out_of_bounds"),storm::exceptions::WrongFormatException, "Label 'out_of_bounds' is reserved when adding out of bounds states.");
                 result.addLabel("out_of_bounds");
-                result.addLabelToState("out_of_bounds", stateStorage.stateToId.getValue(outOfBoundsState));
+                result.addLabelToState("out_of_bounds", stateStorage.getStateIndex(outOfBoundsState));
             }
             
             return result;
@@ -224,6 +223,16 @@ namespace storm {
             // Nothing to be done.
         }
 
+        template<typename ValueType, typename StateType>
+        bool NextStateGenerator<ValueType, StateType>::requiresStateCanonicalization() const {
+            return false;
+        }
+
+        template<typename ValueType, typename StateType>
+        void NextStateGenerator<ValueType, StateType>::canonicalizeState(CompressedState&) const {
+            // Intentionally left empty.
+        }
+
         template class NextStateGenerator<double>;
 
 #ifdef STORM_HAVE_CARL
@@ -1,6 +1,7 @@
 #ifndef STORM_GENERATOR_NEXTSTATEGENERATOR_H_
 #define STORM_GENERATOR_NEXTSTATEGENERATOR_H_
 
+#include <set>
 #include <vector>
 #include <cstdint>
 
@@ -68,6 +69,12 @@ namespace storm {
             virtual std::size_t getNumberOfRewardModels() const = 0;
             virtual storm::builder::RewardModelInformation getRewardModelInformation(uint64_t const& index) const = 0;
             
+            /*!
+             * Retrieves the (non-transient) variables that the labels, the reward models and the observation labels
+             * built by this generator depend on.
+             */
+            virtual std::set<storm::expressions::Variable> getVariablesOfLabelsRewardsAndObservations() const = 0;
+            
             std::string stateToString(CompressedState const& state) const;
 
             uint32_t observabilityClass(CompressedState const& state) const;
@@ -86,6 +93,20 @@ namespace storm {
              * @param remapping The remapping to apply.
              */
             void remapStateIds(std::function<StateType(StateType const&)> const& remapping);
+
+            /*!
+             * Retrieves whether states have to be brought into a canonical form (see canonicalizeState) before they
+             * are stored.
+             */
+            virtual bool requiresStateCanonicalization() const;
+
+            /*!
+             * Replaces the given state by the representative of all states that are known to behave equivalently, e.g.,
+             * because they only differ by a permutation of symmetric components.
+             *
+             * @param state The state to canonicalize.
+             */
+            virtual void canonicalizeState(CompressedState& state) const;
             
         protected:
             /*!
@@ -1,5 +1,8 @@
 #include "storm/generator/PrismNextStateGenerator.h"
 
+#include <algorithm>
+#include <sstream>
+
 #include <boost/container/flat_map.hpp>
 #include <boost/any.hpp>
 
@@ -80,6 +83,14 @@ namespace storm {
                     }
                 }
             }
+            
+            if (this->options.isSymmetryReductionSet()) {
+                detectSymmetricModules();
+            }
+            
+            if (this->options.isGuardCachingSet()) {
+                initializeGuardCache();
+            }
         }
 
         template<typename ValueType, typename StateType>
@@ -119,6 +130,365 @@ namespace storm {
 #endif
         }
         
+        namespace detail {
+            /*!
+             * Retrieves a string representation of the given expression that does not depend on the order of the
+             * operands of commutative operators. Nested applications of associative operators are flattened.
+             */
+            std::string getCanonicalExpressionString(storm::expressions::Expression const& expression) {
+                if (!expression.isFunctionApplication()) {
+                    return expression.toString();
+                }
+                
+                storm::expressions::OperatorType operatorType = expression.getOperator();
+                bool isAssociative = operatorType == storm::expressions::OperatorType::And || operatorType == storm::expressions::OperatorType::Or || operatorType == storm::expressions::OperatorType::Plus || operatorType == storm::expressions::OperatorType::Times || operatorType == storm::expressions::OperatorType::Min || operatorType == storm::expressions::OperatorType::Max;
+                bool isCommutative = isAssociative || operatorType == storm::expressions::OperatorType::Equal || operatorType == storm::expressions::OperatorType::NotEqual || operatorType == storm::expressions::OperatorType::Iff || operatorType == storm::expressions::OperatorType::Xor;
+                
+                std::vector<std::string> operands;
+                if (isAssociative) {
+                    std::vector<storm::expressions::Expression> stack = {expression};
+                    while (!stack.empty()) {
+                        storm::expressions::Expression current = stack.back();
+                        stack.pop_back();
+                        if (current.isFunctionApplication() && current.getOperator() == operatorType) {
+                            for (uint_fast64_t operandIndex = 0; operandIndex < current.getArity(); ++operandIndex) {
+                                stack.push_back(current.getOperand(operandIndex));
+                            }
+                        } else {
+                            operands.push_back(getCanonicalExpressionString(current));
+                        }
+                    }
+                } else {
+                    for (uint_fast64_t operandIndex = 0; operandIndex < expression.getArity(); ++operandIndex) {
+                        operands.push_back(getCanonicalExpressionString(expression.getOperand(operandIndex)));
+                    }
+                }
+                if (isCommutative) {
+                    std::sort(operands.begin(), operands.end());
+                }
+                
+                std::stringstream stream;
+                stream << operatorType << "(";
+                bool first = true;
+                for (auto const& operand : operands) {
+                    if (!first) {
+                        stream << ",";
+                    }
+                    first = false;
+                    stream << operand;
+                }
+                stream << ")";
+                return stream.str();
+            }
+        }
+        
+        template<typename ValueType, typename StateType>
+        void PrismNextStateGenerator<ValueType, StateType>::detectSymmetricModules() {
+            if (program.getModelType() == storm::prism::Program::ModelType::POMDP) {
+                STORM_LOG_WARN("Symmetry reduction is not supported for POMDPs and is therefore not applied.");
+                return;
+            }
+            
+            // Gather the expressions whose value must not change when permuting the members of a group.
+            std::vector<storm::expressions::Expression> invariantExpressions = {program.getInitialStatesExpression()};
+            if (this->options.isBuildAllLabelsSet()) {
+                for (auto const& label : program.getLabels()) {
+                    invariantExpressions.push_back(label.getStatePredicateExpression());
+                }
+            } else {
+                for (auto const& labelName : this->options.getLabelNames()) {
+                    if (program.hasLabel(labelName)) {
+                        invariantExpressions.push_back(program.getLabelExpression(labelName));
+                    }
+                }
+            }
+            for (auto const& expressionLabel : this->options.getExpressionLabels()) {
+                invariantExpressions.push_back(expressionLabel.second);
+            }
+            for (auto const& expressionAndBool : this->terminalStates) {
+                invariantExpressions.push_back(expressionAndBool.first);
+            }
+            bool hasTransitionRewards = false;
+            for (auto const& rewardModel : rewardModels) {
+                for (auto const& stateReward : rewardModel.get().getStateRewards()) {
+                    invariantExpressions.push_back(stateReward.getStatePredicateExpression());
+                    invariantExpressions.push_back(stateReward.getRewardValueExpression());
+                }
+                for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
+                    invariantExpressions.push_back(stateActionReward.getStatePredicateExpression());
+                    invariantExpressions.push_back(stateActionReward.getRewardValueExpression());
+                }
+                hasTransitionRewards |= rewardModel.get().hasTransitionRewards();
+            }
+            std::vector<std::string> canonicalInvariantExpressions;
+            for (auto const& expression : invariantExpressions) {
+                canonicalInvariantExpressions.push_back(detail::getCanonicalExpressionString(expression));
+            }
+            
+            // Retrieve the bits of all variables.
+            std::map<std::string, std::tuple<uint64_t, uint64_t, int_fast64_t, int_fast64_t>> variableNameToBits;
+            for (auto const& booleanVariable : this->variableInformation.booleanVariables) {
+                variableNameToBits[booleanVariable.getName()] = std::make_tuple(booleanVariable.bitOffset, 1, 0, 1);
+            }
+            for (auto const& integerVariable : this->variableInformation.integerVariables) {
+                variableNameToBits[integerVariable.getName()] = std::make_tuple(integerVariable.bitOffset, integerVariable.bitWidth, integerVariable.lowerBound, integerVariable.upperBound);
+            }
+            
+            // Group the modules by the module they were renamed from.
+            std::map<std::string, std::vector<uint64_t>> baseModuleToRenamedModules;
+            for (uint64_t moduleIndex = 0; moduleIndex < program.getNumberOfModules(); ++moduleIndex) {
+                storm::prism::Module const& module = program.getModule(moduleIndex);
+                if (module.isRenamedFromModule()) {
+                    baseModuleToRenamedModules[module.getBaseModule()].push_back(moduleIndex);
+                }
+            }
+            
+            for (auto const& baseAndRenamedModules : baseModuleToRenamedModules) {
+                STORM_LOG_THROW(program.hasModule(baseAndRenamedModules.first), storm::exceptions::WrongFormatException, "Unknown base module '" << baseAndRenamedModules.first << "'.");
+                storm::prism::Module const& baseModule = program.getModule(baseAndRenamedModules.first);
+                std::vector<std::string> baseVariableNames;
+                for (auto const& booleanVariable : baseModule.getBooleanVariables()) {
+                    baseVariableNames.push_back(booleanVariable.getName());
+                }
+                for (auto const& integerVariable : baseModule.getIntegerVariables()) {
+                    baseVariableNames.push_back(integerVariable.getName());
+                }
+                
+                std::vector<storm::prism::Module const*> members = {&baseModule};
+                for (auto const& moduleIndex : baseAndRenamedModules.second) {
+                    members.push_back(&program.getModule(moduleIndex));
+                }
+                
+                bool isSymmetric = !hasTransitionRewards && baseModule.getNumberOfClockVariables() == 0;
+                STORM_LOG_WARN_COND(isSymmetric, "Not applying symmetry reduction to module '" << baseModule.getName() << "' and its renamings, because transition rewards or clocks are present.");
+                
+                // Determine the variables of each member in the order of the variables of the base module.
+                std::vector<std::vector<std::string>> memberVariableNames = {baseVariableNames};
+                for (uint64_t memberIndex = 1; isSymmetric && memberIndex < members.size(); ++memberIndex) {
+                    std::map<std::string, std::string> const& renaming = members[memberIndex]->getRenaming();
+                    std::vector<std::string> variableNames;
+                    for (auto const& baseVariableName : baseVariableNames) {
+                        auto renamingIt = renaming.find(baseVariableName);
+                        if (renamingIt == renaming.end()) {
+                            break;
+                        }
+                        variableNames.push_back(renamingIt->second);
+                    }
+                    // We require that exactly the local variables are renamed, i.e., the members share all other
+                    // identifiers (in particular the action names).
+                    if (variableNames.size() != baseVariableNames.size() || renaming.size() != baseVariableNames.size()) {
+                        STORM_LOG_WARN("Not applying symmetry reduction to module '" << baseModule.getName() << "' and its renamings, because module '" << members[memberIndex]->getName() << "' renames identifiers other than the local variables.");
+                        isSymmetric = false;
+                    }
+                    memberVariableNames.push_back(std::move(variableNames));
+                }
+                if (!isSymmetric) {
+                    continue;
+                }
+                
+                // The variables of corresponding members need to be encoded in the same way.
+                for (uint64_t memberIndex = 1; isSymmetric && memberIndex < members.size(); ++memberIndex) {
+                    for (uint64_t variableIndex = 0; variableIndex < baseVariableNames.size(); ++variableIndex) {
+                        auto const& baseBits = variableNameToBits.at(baseVariableNames[variableIndex]);
+                        auto const& memberBits = variableNameToBits.at(memberVariableNames[memberIndex][variableIndex]);
+                        if (std::get<1>(baseBits) != std::get<1>(memberBits) || std::get<2>(baseBits) != std::get<2>(memberBits) || std::get<3>(baseBits) != std::get<3>(memberBits)) {
+                            STORM_LOG_WARN("Not applying symmetry reduction to module '" << baseModule.getName() << "' and its renamings, because the ranges of variables '" << baseVariableNames[variableIndex] << "' and '" << memberVariableNames[memberIndex][variableIndex] << "' differ.");
+                            isSymmetric = false;
+                            break;
+                        }
+                    }
+                }
+                if (!isSymmetric) {
+                    continue;
+                }
+                
+                // The local variables of the members must only be accessed by the member itself.
+                std::vector<std::set<storm::expressions::Variable>> memberLocalVariables;
+                std::set<storm::expressions::Variable> allLocalVariables;
+                for (auto const& variableNames : memberVariableNames) {
+                    std::set<storm::expressions::Variable> localVariables;
+                    for (auto const& variableName : variableNames) {
+                        localVariables.insert(program.getManager().getVariable(variableName));
+                    }
+                    allLocalVariables.insert(localVariables.begin(), localVariables.end());
+                    memberLocalVariables.push_back(std::move(localVariables));
+                }
+                for (uint64_t moduleIndex = 0; isSymmetric && moduleIndex < program.getNumberOfModules(); ++moduleIndex) {
+                    storm::prism::Module const& module = program.getModule(moduleIndex);
+                    auto memberIt = std::find(members.begin(), members.end(), &module);
+                    std::set<storm::expressions::Variable> forbiddenVariables = allLocalVariables;
+                    if (memberIt != members.end()) {
+                        for (auto const& variable : memberLocalVariables[std::distance(members.begin(), memberIt)]) {
+                            forbiddenVariables.erase(variable);
+                        }
+                    }
+                    
+                    for (auto const& command : module.getCommands()) {
+                        bool accessesForbiddenVariable = command.getGuardExpression().containsVariable(forbiddenVariables);
+                        for (auto const& update : command.getUpdates()) {
+                            accessesForbiddenVariable |= update.getLikelihoodExpression().containsVariable(forbiddenVariables);
+                            for (auto const& assignment : update.getAssignments()) {
+                                accessesForbiddenVariable |= forbiddenVariables.count(assignment.getVariable()) > 0 || assignment.getExpression().containsVariable(forbiddenVariables);
+                            }
+                        }
+                        if (accessesForbiddenVariable) {
+                            STORM_LOG_WARN("Not applying symmetry reduction to module '" << baseModule.getName() << "' and its renamings, because module '" << module.getName() << "' accesses local variables of the group.");
+                            isSymmetric = false;
+                            break;
+                        }
+                    }
+                }
+                if (!isSymmetric) {
+                    continue;
+                }
+                
+                // Finally, swapping the base module with any other member (these transpositions generate all
+                // permutations of the members) must leave the relevant expressions unchanged.
+                for (uint64_t memberIndex = 1; isSymmetric && memberIndex < members.size(); ++memberIndex) {
+                    std::map<storm::expressions::Variable, storm::expressions::Expression> swap;
+                    for (uint64_t variableIndex = 0; variableIndex < baseVariableNames.size(); ++variableIndex) {
+                        storm::expressions::Variable const& baseVariable = program.getManager().getVariable(baseVariableNames[variableIndex]);
+                        storm::expressions::Variable const& memberVariable = program.getManager().getVariable(memberVariableNames[memberIndex][variableIndex]);
+                        swap.emplace(baseVariable, memberVariable.getExpression());
+                        swap.emplace(memberVariable, baseVariable.getExpression());
+                    }
+                    for (uint64_t expressionIndex = 0; expressionIndex < invariantExpressions.size(); ++expressionIndex) {
+                        if (detail::getCanonicalExpressionString(invariantExpressions[expressionIndex].substitute(swap)) != canonicalInvariantExpressions[expressionIndex]) {
+                            STORM_LOG_WARN("Not applying symmetry reduction to module '" << baseModule.getName() << "' and its renamings, because expression '" << invariantExpressions[expressionIndex] << "' is not symmetric w.r.t. modules '" << baseModule.getName() << "' and '" << members[memberIndex]->getName() << "'.");
+                            isSymmetric = false;
+                            break;
+                        }
+                    }
+                }
+                if (!isSymmetric) {
+                    continue;
+                }
+                
+                std::vector<std::vector<std::pair<uint64_t, uint64_t>>> group;
+                for (auto const& variableNames : memberVariableNames) {
+                    std::vector<std::pair<uint64_t, uint64_t>> blocks;
+                    for (auto const& variableName : variableNames) {
+                        auto const& bits = variableNameToBits.at(variableName);
+                        blocks.emplace_back(std::get<0>(bits), std::get<1>(bits));
+                    }
+                    group.push_back(std::move(blocks));
+                }
+                STORM_LOG_INFO("Applying symmetry reduction to the " << group.size() << " modules renamed from module '" << baseModule.getName() << "'.");
+                symmetricModuleBlocks.push_back(std::move(group));
+            }
+            STORM_LOG_WARN_COND(!symmetricModuleBlocks.empty(), "Symmetry reduction was requested, but no symmetric modules were found.");
+        }
+        
+        template<typename ValueType, typename StateType>
+        void PrismNextStateGenerator<ValueType, StateType>::initializeGuardCache() {
+            std::map<storm::expressions::Variable, std::pair<uint64_t, uint64_t>> variableToBits;
+            for (auto const& booleanVariable : this->variableInformation.booleanVariables) {
+                variableToBits[booleanVariable.variable] = std::make_pair(booleanVariable.bitOffset, 1ull);
+            }
+            for (auto const& integerVariable : this->variableInformation.integerVariables) {
+                variableToBits[integerVariable.variable] = std::make_pair(integerVariable.bitOffset, integerVariable.bitWidth);
+            }
+            
+            uint64_t numberOfCachedModules = 0;
+            guardDependencies.resize(program.getNumberOfModules());
+            for (uint64_t moduleIndex = 0; moduleIndex < program.getNumberOfModules(); ++moduleIndex) {
+                storm::prism::Module const& module = program.getModule(moduleIndex);
+                
+                // Gather the variables that are read by the guards of the module.
+                std::set<storm::expressions::Variable> guardVariables;
+                for (auto const& command : module.getCommands()) {
+                    std::set<storm::expressions::Variable> commandVariables = command.getGuardExpression().getVariables();
+                    guardVariables.insert(commandVariables.begin(), commandVariables.end());
+                }
+                
+                // The values of the variables need to fit into a single key.
+                std::vector<std::pair<uint64_t, uint64_t>> bits;
+                uint64_t totalWidth = 0;
+                bool cacheable = true;
+                for (auto const& variable : guardVariables) {
+                    auto bitsIt = variableToBits.find(variable);
+                    if (bitsIt == variableToBits.end()) {
+                        cacheable = false;
+                        break;
+                    }
+                    bits.push_back(bitsIt->second);
+                    totalWidth += bitsIt->second.second;
+                }
+                if (cacheable && totalWidth < 64) {
+                    guardDependencies[moduleIndex] = std::move(bits);
+                    ++numberOfCachedModules;
+                } else {
+                    STORM_LOG_INFO("Not caching the enabled commands of module '" << module.getName() << "' as its guards depend on too many bits.");
+                }
+            }
+            enabledCommandsCache.resize(program.getNumberOfModules());
+            currentEnabledCommands.resize(program.getNumberOfModules(), nullptr);
+            STORM_LOG_DEBUG("Caching the enabled commands of " << numberOfCachedModules << " out of " << program.getNumberOfModules() << " modules.");
+        }
+        
+        template<typename ValueType, typename StateType>
+        bool PrismNextStateGenerator<ValueType, StateType>::isCommandEnabled(uint64_t moduleIndex, uint64_t commandIndex) {
+            if (guardDependencies.empty() || !guardDependencies[moduleIndex]) {
+                return this->evaluator->asBool(program.getModule(moduleIndex).getCommand(commandIndex).getGuardExpression());
+            }
+            
+            storm::storage::BitVector const*& enabledCommands = currentEnabledCommands[moduleIndex];
+            if (enabledCommands == nullptr) {
+                uint64_t key = 0;
+                for (auto const& offsetWidthPair : guardDependencies[moduleIndex].get()) {
+                    key = (key << offsetWidthPair.second) | this->state->getAsInt(offsetWidthPair.first, offsetWidthPair.second);
+                }
+                
+                auto insertionResult = enabledCommandsCache[moduleIndex].emplace(key, storm::storage::BitVector());
+                if (insertionResult.second) {
+                    // The valuation has not been seen before, so we evaluate all guards of the module.
+                    storm::prism::Module const& module = program.getModule(moduleIndex);
+                    storm::storage::BitVector& newEnabledCommands = insertionResult.first->second;
+                    newEnabledCommands = storm::storage::BitVector(module.getNumberOfCommands());
+                    for (uint64_t index = 0; index < module.getNumberOfCommands(); ++index) {
+                        if (this->evaluator->asBool(module.getCommand(index).getGuardExpression())) {
+                            newEnabledCommands.set(index);
+                        }
+                    }
+                }
+                enabledCommands = &insertionResult.first->second;
+            }
+            return enabledCommands->get(commandIndex);
+        }
+        
+        template<typename ValueType, typename StateType>
+        bool PrismNextStateGenerator<ValueType, StateType>::requiresStateCanonicalization() const {
+            return !symmetricModuleBlocks.empty();
+        }
+        
+        template<typename ValueType, typename StateType>
+        void PrismNextStateGenerator<ValueType, StateType>::canonicalizeState(CompressedState& state) const {
+            for (auto const& group : symmetricModuleBlocks) {
+                // Read the local state of each member.
+                std::vector<std::vector<uint64_t>> localStates;
+                localStates.reserve(group.size());
+                for (auto const& blocks : group) {
+                    std::vector<uint64_t> localState;
+                    localState.reserve(blocks.size());
+                    for (auto const& block : blocks) {
+                        localState.push_back(state.getAsInt(block.first, block.second));
+                    }
+                    localStates.push_back(std::move(localState));
+                }
+                
+                // Sorting the local states yields the representative of all permutations of the members.
+                if (!std::is_sorted(localStates.begin(), localStates.end())) {
+                    std::sort(localStates.begin(), localStates.end());
+                    for (uint64_t memberIndex = 0; memberIndex < group.size(); ++memberIndex) {
+                        for (uint64_t blockIndex = 0; blockIndex < group[memberIndex].size(); ++blockIndex) {
+                            auto const& block = group[memberIndex][blockIndex];
+                            state.setFromInt(block.first, block.second, localStates[memberIndex][blockIndex]);
+                        }
+                    }
+                }
+            }
+        }
+        
         template<typename ValueType, typename StateType>
         ModelType PrismNextStateGenerator<ValueType, StateType>::getModelType() const {
             switch (program.getModelType()) {
@@ -286,19 +656,22 @@ namespace storm {
 
             // Get all choices for the state.
             result.setExpanded();
+            std::fill(currentEnabledCommands.begin(), currentEnabledCommands.end(), nullptr);
             
-            std::vector<Choice<ValueType>> allChoices;
+            // The choices are collected in a buffer that keeps its capacity across states.
+            std::vector<Choice<ValueType>>& allChoices = choiceBuffer;
+            allChoices.clear();
             if (this->getOptions().isApplyMaximalProgressAssumptionSet()) {
                 // First explore only edges without a rate
-                allChoices = getUnlabeledChoices(*this->state, stateToIdCallback, CommandFilter::Probabilistic);
+                addUnlabeledChoices(allChoices, *this->state, stateToIdCallback, CommandFilter::Probabilistic);
                 addLabeledChoices(allChoices, *this->state, stateToIdCallback, CommandFilter::Probabilistic);
                 if (allChoices.empty()) {
                     // Expand the Markovian edges if there are no probabilistic ones.
-                    allChoices = getUnlabeledChoices(*this->state, stateToIdCallback, CommandFilter::Markovian);
+                    addUnlabeledChoices(allChoices, *this->state, stateToIdCallback, CommandFilter::Markovian);
                     addLabeledChoices(allChoices, *this->state, stateToIdCallback, CommandFilter::Markovian);
                 }
             } else {
-                allChoices = getUnlabeledChoices(*this->state, stateToIdCallback);
+                addUnlabeledChoices(allChoices, *this->state, stateToIdCallback);
                 addLabeledChoices(allChoices, *this->state, stateToIdCallback);
             }
             
@@ -322,13 +695,15 @@ namespace storm {
                 // this is equal to the number of choices, which is why we initialize it like this here.
                 ValueType totalExitRate = this->isDiscreteTimeModel() ? static_cast<ValueType>(totalNumberOfChoices) : storm::utility::zero<ValueType>();
                 
-                // Iterate over all choices and combine the probabilities/rates into one choice.
+                // Iterate over all choices and combine the probabilities/rates into one choice. The targets are first
+                // collected in the distribution buffer, so they only need to be sorted and merged once.
+                distributionBuffer.clear();
                 for (auto const& choice : allChoices) {
                     for (auto const& stateProbabilityPair : choice) {
                         if (this->isDiscreteTimeModel()) {
-                            globalChoice.addProbability(stateProbabilityPair.first, stateProbabilityPair.second / totalNumberOfChoices);
+                            distributionBuffer.add(stateProbabilityPair.first, stateProbabilityPair.second / totalNumberOfChoices);
                         } else {
-                            globalChoice.addProbability(stateProbabilityPair.first, stateProbabilityPair.second);
+                            distributionBuffer.add(stateProbabilityPair.first, stateProbabilityPair.second);
                         }
                     }
                     
@@ -344,6 +719,11 @@ namespace storm {
                         globalChoice.addOriginData(choice.getOriginData());
                     }
                 }
+                distributionBuffer.compress();
+                globalChoice.reserve(std::distance(distributionBuffer.begin(), distributionBuffer.end()));
+                for (auto const& stateProbability : distributionBuffer) {
+                    globalChoice.addProbability(stateProbability.getState(), stateProbability.getValue());
+                }
                 
                 // Now construct the state-action reward for all selected reward models.
                 for (auto const& rewardModel : rewardModels) {
@@ -372,6 +752,7 @@ namespace storm {
             for (auto& choice : allChoices) {
                 result.addChoice(std::move(choice));
             }
+            allChoices.clear();
 
             this->postprocess(result);
             
@@ -425,9 +806,10 @@ namespace storm {
         }
         
         struct ActiveCommandData {
-            ActiveCommandData(storm::prism::Module const* modulePtr, std::set<uint_fast64_t> const* commandIndicesPtr, typename std::set<uint_fast64_t>::const_iterator currentCommandIndexIt) : modulePtr(modulePtr), commandIndicesPtr(commandIndicesPtr), currentCommandIndexIt(currentCommandIndexIt) {
+            ActiveCommandData(uint_fast64_t moduleIndex, storm::prism::Module const* modulePtr, std::set<uint_fast64_t> const* commandIndicesPtr, typename std::set<uint_fast64_t>::const_iterator currentCommandIndexIt) : moduleIndex(moduleIndex), modulePtr(modulePtr), commandIndicesPtr(commandIndicesPtr), currentCommandIndexIt(currentCommandIndexIt) {
                 // Intentionally left empty
             }
+            uint_fast64_t moduleIndex;
             storm::prism::Module const* modulePtr;
             std::set<uint_fast64_t> const* commandIndicesPtr;
             typename std::set<uint_fast64_t>::const_iterator currentCommandIndexIt;
@@ -469,10 +851,10 @@ namespace storm {
                             continue;
                         }
                     }
-                    if (this->evaluator->asBool(command.getGuardExpression())) {
+                    if (isCommandEnabled(i, *commandIndexIt)) {
                         // Found the first enabled command for this module.
                         hasOneEnabledCommand = true;
-                        activeCommands.emplace_back(&module, &commandIndices, commandIndexIt);
+                        activeCommands.emplace_back(i, &module, &commandIndices, commandIndexIt);
                         break;
                     }
                 }
@@ -503,7 +885,7 @@ namespace storm {
                             continue;
                         }
                     }
-                    if (this->evaluator->asBool(command.getGuardExpression())) {
+                    if (isCommandEnabled(activeCommand.moduleIndex, *commandIndexIt)) {
                         commands.push_back(command);
                     }
                 }
@@ -516,9 +898,7 @@ namespace storm {
         }
         
         template<typename ValueType, typename StateType>
-        std::vector<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::getUnlabeledChoices(CompressedState const& state, StateToIdCallback stateToIdCallback, CommandFilter const& commandFilter) {
-            std::vector<Choice<ValueType>> result;
-            
+        void PrismNextStateGenerator<ValueType, StateType>::addUnlabeledChoices(std::vector<Choice<ValueType>>& choices, CompressedState const& state, StateToIdCallback stateToIdCallback, CommandFilter const& commandFilter) {
             // Iterate over all modules.
             for (uint_fast64_t i = 0; i < program.getNumberOfModules(); ++i) {
                 storm::prism::Module const& module = program.getModule(i);
@@ -538,12 +918,12 @@ namespace storm {
                     }
 
                     // Skip the command, if it is not enabled.
-                    if (!this->evaluator->asBool(command.getGuardExpression())) {
+                    if (!isCommandEnabled(i, j)) {
                         continue;
                     }
                     
-                    result.push_back(Choice<ValueType>(command.getActionIndex(), command.isMarkovian()));
-                    Choice<ValueType>& choice = result.back();
+                    choices.push_back(Choice<ValueType>(command.getActionIndex(), command.isMarkovian()));
+                    Choice<ValueType>& choice = choices.back();
                     
                     // Remember the choice origin only if we were asked to.
                     if (this->options.isBuildChoiceOriginsSet()) {
@@ -553,6 +933,7 @@ namespace storm {
                     
                     // Iterate over all updates of the current command.
                     ValueType probabilitySum = storm::utility::zero<ValueType>();
+                    distributionBuffer.clear();
                     for (uint_fast64_t k = 0; k < command.getNumberOfUpdates(); ++k) {
                         storm::prism::Update const& update = command.getUpdate(k);
 
@@ -562,14 +943,21 @@ namespace storm {
                             // seen, we also add it to the set of states that have yet to be explored.
                             StateType stateIndex = stateToIdCallback(applyUpdate(state, update));
                             
-                            // Update the choice by adding the probability/target state to it.
-                            choice.addProbability(stateIndex, probability);
+                            // Remember the probability/target state, it is added to the choice once all updates are processed.
+                            distributionBuffer.add(stateIndex, probability);
                             if (this->options.isExplorationChecksSet()) {
                                 probabilitySum += probability;
                             }
                         }
                     }
                     
+                    // Sort and merge the targets and add them to the choice in ascending order.
+                    distributionBuffer.compress();
+                    choice.reserve(std::distance(distributionBuffer.begin(), distributionBuffer.end()));
+                    for (auto const& stateProbability : distributionBuffer) {
+                        choice.addProbability(stateProbability.getState(), stateProbability.getValue());
+                    }
+                    
                     // Create the state-action reward for the newly created choice.
                     for (auto const& rewardModel : rewardModels) {
                         ValueType stateActionRewardValue = storm::utility::zero<ValueType>();
@@ -589,8 +977,6 @@ namespace storm {
                     }
                 }
             }
-            
-            return result;
         }
 
         template<typename ValueType, typename StateType>
@@ -628,7 +1014,7 @@ namespace storm {
                         iteratorList[i] = activeCommandList[i].cbegin();
                     }
 
-                    storm::builder::jit::Distribution<StateType, ValueType> distribution;
+                    storm::builder::jit::Distribution<StateType, ValueType>& distribution = distributionBuffer;
 
                     // As long as there is one feasible combination of commands, keep on expanding it.
                     bool done = false;
@@ -742,6 +1128,42 @@ namespace storm {
             return rewardModels.size();
         }
         
+        template<typename ValueType, typename StateType>
+        std::set<storm::expressions::Variable> PrismNextStateGenerator<ValueType, StateType>::getVariablesOfLabelsRewardsAndObservations() const {
+            std::set<storm::expressions::Variable> result;
+            auto addVariables = [&result] (storm::expressions::Expression const& expression) {
+                std::set<storm::expressions::Variable> variables = expression.getVariables();
+                result.insert(variables.begin(), variables.end());
+            };
+            
+            for (auto const& label : program.getLabels()) {
+                if (this->options.isBuildAllLabelsSet() || this->options.getLabelNames().find(label.getName()) != this->options.getLabelNames().end()) {
+                    addVariables(label.getStatePredicateExpression());
+                }
+            }
+            for (auto const& rewardModel : rewardModels) {
+                for (auto const& stateReward : rewardModel.get().getStateRewards()) {
+                    addVariables(stateReward.getStatePredicateExpression());
+                    addVariables(stateReward.getRewardValueExpression());
+                }
+                for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
+                    addVariables(stateActionReward.getStatePredicateExpression());
+                    addVariables(stateActionReward.getRewardValueExpression());
+                }
+                for (auto const& transitionReward : rewardModel.get().getTransitionRewards()) {
+                    addVariables(transitionReward.getSourceStatePredicateExpression());
+                    addVariables(transitionReward.getTargetStatePredicateExpression());
+                    addVariables(transitionReward.getRewardValueExpression());
+                }
+            }
+            if (this->isPartiallyObservable()) {
+                for (auto const& observationLabel : program.getObservationLabels()) {
+                    addVariables(observationLabel.getStatePredicateExpression());
+                }
+            }
+            return result;
+        }
+        
         template<typename ValueType, typename StateType>
         storm::builder::RewardModelInformation PrismNextStateGenerator<ValueType, StateType>::getRewardModelInformation(uint64_t const& index) const {
             storm::prism::RewardModel const& rewardModel = rewardModels[index].get();
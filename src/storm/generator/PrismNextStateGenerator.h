@@ -1,19 +1,15 @@
 #ifndef STORM_GENERATOR_PRISMNEXTSTATEGENERATOR_H_
 #define STORM_GENERATOR_PRISMNEXTSTATEGENERATOR_H_
 
+#include <unordered_map>
+
 #include "storm/generator/NextStateGenerator.h"
 
+#include "storm/builder/jit/Distribution.h"
 #include "storm/storage/prism/Program.h"
 #include "storm/storage/BoostTypes.h"
 
 namespace storm {
-    namespace builder {
-        namespace jit {
-            template <typename StateType, typename ValueType>
-            class Distribution;
-        }
-    }
-    
     namespace generator {
         
         template<typename ValueType, typename StateType = uint32_t>
@@ -41,15 +37,27 @@ namespace storm {
             virtual StateBehavior<ValueType, StateType> expand(StateToIdCallback const& stateToIdCallback) override;
 
             virtual std::size_t getNumberOfRewardModels() const override;
+            virtual std::set<storm::expressions::Variable> getVariablesOfLabelsRewardsAndObservations() const override;
             virtual storm::builder::RewardModelInformation getRewardModelInformation(uint64_t const& index) const override;
             
             virtual storm::models::sparse::StateLabeling label(storm::storage::sparse::StateStorage<StateType> const& stateStorage, std::vector<StateType> const& initialStateIndices = {}, std::vector<StateType> const& deadlockStateIndices = {}) override;
 
             virtual std::shared_ptr<storm::storage::sparse::ChoiceOrigins> generateChoiceOrigins(std::vector<boost::any>& dataForChoiceOrigins) const override;
 
+            virtual bool requiresStateCanonicalization() const override;
+            virtual void canonicalizeState(CompressedState& state) const override;
+
         private:
             void checkValid() const;
 
+            /*!
+             * Detects groups of modules that are obtained from the same module by renaming its local variables and
+             * whose permutation changes neither the initial states nor the labels, terminal states and rewards that
+             * are to be built. For each such group, the bits of the module-local variables are recorded, such that
+             * states can be canonicalized by sorting the blocks of the group members.
+             */
+            void detectSymmetricModules();
+
             /*!
              * A delegate constructor that is used to preprocess the program before the constructor of the superclass is
              * being called. The last argument is only present to distinguish the signature of this constructor from the
@@ -66,6 +74,23 @@ namespace storm {
              */
             CompressedState applyUpdate(CompressedState const& state, storm::prism::Update const& update);
             
+            /*!
+             * Determines for each module the bits of the state that are read by the guards of its commands, so that
+             * the enabled commands can be cached w.r.t. their values.
+             */
+            void initializeGuardCache();
+            
+            /*!
+             * Retrieves whether the given command of the given module is enabled in the state that is currently loaded
+             * into the evaluator. If guard caching is enabled, all guards of the module are evaluated at once and the
+             * result is reused for all states that agree on the variables read by the guards.
+             *
+             * @param moduleIndex The index of the module.
+             * @param commandIndex The index of the command within the module.
+             * @return True iff the guard of the command is satisfied.
+             */
+            bool isCommandEnabled(uint64_t moduleIndex, uint64_t commandIndex);
+            
             /*!
              * Retrieves all commands that are labeled with the given label and enabled in the given state, grouped by
              * modules.
@@ -87,10 +112,10 @@ namespace storm {
             /*!
              * Retrieves all unlabeled choices possible from the given state.
              *
+             * @param choices The new choices are inserted in this vector
              * @param state The state for which to retrieve the unlabeled choices.
-             * @return The unlabeled choices of the state.
              */
-            std::vector<Choice<ValueType>> getUnlabeledChoices(CompressedState const& state, StateToIdCallback stateToIdCallback, CommandFilter const& commandFilter = CommandFilter::All);
+            void addUnlabeledChoices(std::vector<Choice<ValueType>>& choices, CompressedState const& state, StateToIdCallback stateToIdCallback, CommandFilter const& commandFilter = CommandFilter::All);
             
             /*!
              * Retrieves all labeled choices possible from the given state.
@@ -120,6 +145,26 @@ namespace storm {
             
             // A flag that stores whether at least one of the selected reward models has state-action rewards.
             bool hasStateActionRewards;
+
+            // Scratch buffers that are reused across calls to expand, so that exploring a state does not need to
+            // allocate them anew. The distribution buffer collects the targets of a choice in arbitrary order before
+            // they are sorted and merged in one go.
+            std::vector<Choice<ValueType>> choiceBuffer;
+            storm::builder::jit::Distribution<StateType, ValueType> distributionBuffer;
+
+            // For each group of symmetric modules and each of its members, the offsets and widths of the bits that
+            // store the local variables of the member (in the order of the variables of the base module).
+            std::vector<std::vector<std::vector<std::pair<uint64_t, uint64_t>>>> symmetricModuleBlocks;
+            
+            // For each module, the offsets and widths of the bits that are read by the guards of its commands. If the
+            // enabled commands of a module are not cached, the corresponding entry is not set.
+            std::vector<boost::optional<std::vector<std::pair<uint64_t, uint64_t>>>> guardDependencies;
+            
+            // For each module, a mapping from the values of the bits read by its guards to its enabled commands.
+            std::vector<std::unordered_map<uint64_t, storm::storage::BitVector>> enabledCommandsCache;
+            
+            // For each module, the enabled commands in the state that is currently expanded (if already looked up).
+            std::vector<storm::storage::BitVector const*> currentEnabledCommands;
         };
         
     }
@@ -79,7 +79,7 @@ namespace storm {
                 auto flattenStart = std::chrono::high_resolution_clock::now();
                 // Flatten the modules if there is more than one.
                 if (originalProgram.getNumberOfModules() > 1) {
-                    preprocessedModel = originalProgram.substituteFormulas().flattenModules(this->smtSolverFactory);
+                    preprocessedModel = originalProgram.substituteFormulas().flattenModules(this->smtSolverFactory, storm::settings::getModule<storm::settings::modules::AbstractionSettings>().getNumberOfThreads());
                 } else {
                     preprocessedModel = originalProgram;
                 }
@@ -14,6 +14,7 @@
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/adapters/eigen.h"
 #include "storm/environment/solver/LongRunAverageSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 #include "storm/environment/solver/TimeBoundedSolverEnvironment.h"
@@ -30,6 +31,7 @@
 #include "storm/exceptions/FormatUnsupportedBySolverException.h"
 #include "storm/exceptions/UncheckedRequirementException.h"
 #include "storm/exceptions/NotSupportedException.h"
+#include "storm/exceptions/NotConvergedException.h"
 
 namespace storm {
     namespace modelchecker {
@@ -582,7 +584,7 @@ namespace storm {
             }
 
             template<typename ValueType, bool useMixedPoissonProbabilities, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
-            std::vector<ValueType> SparseCtmcCslHelper::computeTransientProbabilities(Environment const& env, storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector, ValueType timeBound, ValueType uniformizationRate, std::vector<ValueType> values, ValueType epsilon) {
+            std::vector<ValueType> SparseCtmcCslHelper::computeTransientProbabilities(Environment const& env, storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector, ValueType timeBound, ValueType uniformizationRate, std::vector<ValueType> values, ValueType epsilon, uint64_t* numberOfIterations) {
                 STORM_LOG_WARN_COND(epsilon > storm::utility::convertNumber<ValueType>(1e-20), "Very low truncation error " << epsilon << " requested. Numerical inaccuracies are possible.");
                 ValueType lambda = timeBound * uniformizationRate;
                 
@@ -591,8 +593,46 @@ namespace storm {
                     return values;
                 }
                 
+                if (env.solver().timeBounded().getCtmcMethod() == storm::solver::CtmcTransientMethod::Krylov) {
+                    return computeTransientProbabilitiesKrylov<ValueType, useMixedPoissonProbabilities>(env, uniformizedMatrix, addVector, timeBound, uniformizationRate, values, epsilon);
+                }
+                
+                // For stiff models, the number of iterations is dominated by the fast states, while the iterated vector
+                // often converges much earlier. If requested, we stop as soon as the remaining iterations cannot change
+                // the result by more than half of the tolerated error. The differences of consecutive iterates evolve
+                // as d_{k+1} = A * d_k, so if A does not expand them in some norm, every later iterate v_j deviates from
+                // v_k by at most (j - k) * ||d_k||. The iteration runs backwards (row sums at most one, maximum norm) or
+                // forwards on the transposed matrix (column sums at most one, 1-norm, which bounds the maximum norm).
+                bool detectSteadyState = !useMixedPoissonProbabilities && env.solver().timeBounded().isSteadyStateDetectionEnabled();
+                bool useOneNorm = false;
+                if (detectSteadyState) {
+                    ValueType maximalRowSum = storm::utility::zero<ValueType>();
+                    std::vector<ValueType> columnSums(uniformizedMatrix.getColumnCount(), storm::utility::zero<ValueType>());
+                    for (uint64_t row = 0; row < uniformizedMatrix.getRowCount(); ++row) {
+                        ValueType rowSum = storm::utility::zero<ValueType>();
+                        for (auto const& entry : uniformizedMatrix.getRow(row)) {
+                            rowSum += storm::utility::abs(entry.getValue());
+                            columnSums[entry.getColumn()] += storm::utility::abs(entry.getValue());
+                        }
+                        maximalRowSum = std::max(maximalRowSum, rowSum);
+                    }
+                    ValueType const tolerance = storm::utility::convertNumber<ValueType>(1e-12);
+                    if (maximalRowSum > storm::utility::one<ValueType>() + tolerance) {
+                        useOneNorm = true;
+                        for (auto const& columnSum : columnSums) {
+                            if (columnSum > storm::utility::one<ValueType>() + tolerance) {
+                                STORM_LOG_INFO("Steady-state detection is disabled as the uniformized matrix is neither row- nor column-substochastic.");
+                                detectSteadyState = false;
+                                break;
+                            }
+                        }
+                    }
+                }
+                ValueType detectionEpsilon = epsilon / storm::utility::convertNumber<ValueType>(2.0);
+                ValueType truncationEpsilon = detectSteadyState ? detectionEpsilon : epsilon;
+                
                 // Use Fox-Glynn to get the truncation points and the weights.
-                storm::utility::numerical::FoxGlynnResult<ValueType> foxGlynnResult = storm::utility::numerical::foxGlynn(lambda, epsilon);
+                storm::utility::numerical::FoxGlynnResult<ValueType> foxGlynnResult = storm::utility::numerical::foxGlynn(lambda, truncationEpsilon);
                 STORM_LOG_DEBUG("Fox-Glynn cutoff points: left=" << foxGlynnResult.left << ", right=" << foxGlynnResult.right);
                 // foxGlynnResult.weights do not sum up to one. This is to enhance numerical stability.
                 
@@ -626,15 +666,62 @@ namespace storm {
                 }
                 
                 auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, uniformizedMatrix);
+                
+                // The total weight and the sum of all indices multiplied with their weight, from which we obtain the
+                // sum of (j - k) * w_j over all remaining indices j >= k.
+                ValueType accumulatedWeight = foxGlynnResult.left == 0 ? foxGlynnResult.weights.front() : storm::utility::zero<ValueType>();
+                ValueType totalWeightedIndex = storm::utility::zero<ValueType>();
+                ValueType accumulatedWeightedIndex = storm::utility::zero<ValueType>();
+                std::vector<ValueType> nextValues;
+                if (detectSteadyState) {
+                    nextValues.resize(values.size());
+                    for (uint64_t index = 0; index < foxGlynnResult.weights.size(); ++index) {
+                        totalWeightedIndex += storm::utility::convertNumber<ValueType>(foxGlynnResult.left + index) * foxGlynnResult.weights[index];
+                    }
+                }
+                
+                // Performs an iteration k and checks whether the error introduced by taking the resulting vector for all
+                // remaining iterations is small enough.
+                auto iterateAndCheck = [&] (uint64_t index) {
+                    multiplier->multiply(env, values, addVector, nextValues);
+                    ValueType differenceNorm = storm::utility::zero<ValueType>();
+                    for (uint64_t state = 0; state < values.size(); ++state) {
+                        ValueType difference = storm::utility::abs<ValueType>(nextValues[state] - values[state]);
+                        differenceNorm = useOneNorm ? differenceNorm + difference : std::max(differenceNorm, difference);
+                    }
+                    values.swap(nextValues);
+                    ValueType remainingWeight = foxGlynnResult.totalWeight - accumulatedWeight;
+                    ValueType remainingSteps = std::max(storm::utility::zero<ValueType>(), totalWeightedIndex - accumulatedWeightedIndex - storm::utility::convertNumber<ValueType>(index) * remainingWeight);
+                    return differenceNorm * remainingSteps <= detectionEpsilon * foxGlynnResult.totalWeight;
+                };
+                
+                uint64_t performedIterations = 0;
+                
                 if (!useMixedPoissonProbabilities && foxGlynnResult.left > 1) {
-                    // Perform the matrix-vector multiplications (without adding).
-                    multiplier->repeatedMultiply(env, values, addVector, foxGlynnResult.left - 1);
+                    if (detectSteadyState) {
+                        for (uint_fast64_t index = 1; index < foxGlynnResult.left; ++index) {
+                            ++performedIterations;
+                            if (iterateAndCheck(index)) {
+                                // All iterations between the truncation points yield (approximately) the current vector.
+                                STORM_LOG_INFO("Detected steady state after " << index << " of " << foxGlynnResult.right << " iterations.");
+                                if (numberOfIterations) {
+                                    *numberOfIterations = performedIterations;
+                                }
+                                return values;
+                            }
+                        }
+                    } else {
+                        // Perform the matrix-vector multiplications (without adding).
+                        multiplier->repeatedMultiply(env, values, addVector, foxGlynnResult.left - 1);
+                        performedIterations += foxGlynnResult.left - 1;
+                    }
                 } else if (useMixedPoissonProbabilities) {
                     std::function<ValueType(ValueType const&, ValueType const&)> addAndScale = [&uniformizationRate] (ValueType const& a, ValueType const& b) { return a + b / uniformizationRate; };
                     
                     // For the iterations below the left truncation point, we need to add and scale the result with the uniformization rate.
                     for (uint_fast64_t index = 1; index < startingIteration; ++index) {
                         multiplier->multiply(env, values, nullptr, values);
+                        ++performedIterations;
                         storm::utility::vector::applyPointwise(result, values, result, addAndScale);
                     }
                     // To make sure that the values obtained before the left truncation point have the same 'impact' on the total result as the values obtained
@@ -648,17 +735,246 @@ namespace storm {
                 ValueType weight = 0;
                 std::function<ValueType(ValueType const&, ValueType const&)> addAndScale = [&weight] (ValueType const& a, ValueType const& b) { return a + weight * b; };
                 for (uint_fast64_t index = startingIteration; index <= foxGlynnResult.right; ++index) {
-                    multiplier->multiply(env, values, addVector, values);
+                    ++performedIterations;
+                    if (detectSteadyState) {
+                        if (iterateAndCheck(index)) {
+                            // We account for the remaining iterations by adding the current vector with the remaining weight.
+                            STORM_LOG_INFO("Detected steady state after " << index << " of " << foxGlynnResult.right << " iterations.");
+                            weight = foxGlynnResult.totalWeight - accumulatedWeight;
+                            storm::utility::vector::applyPointwise(result, values, result, addAndScale);
+                            break;
+                        }
+                    } else {
+                        multiplier->multiply(env, values, addVector, values);
+                    }
                     
                     weight = foxGlynnResult.weights[index - foxGlynnResult.left];
+                    accumulatedWeight += weight;
+                    accumulatedWeightedIndex += storm::utility::convertNumber<ValueType>(index) * weight;
                     storm::utility::vector::applyPointwise(result, values, result, addAndScale);
                 }
+                if (numberOfIterations) {
+                    *numberOfIterations = performedIterations;
+                }
                 
                 // Finally, divide the result by the total weight
                 storm::utility::vector::scaleVectorInPlace<ValueType, ValueType>(result, storm::utility::one<ValueType>() / foxGlynnResult.totalWeight);
                 return result;
             }
             
+            template <typename MatrixType>
+            MatrixType computeMatrixExponential(MatrixType const& matrix) {
+                // Use the (6,6) Pade approximant together with scaling and squaring.
+                uint64_t const degree = 6;
+                auto norm = matrix.cwiseAbs().rowwise().sum().maxCoeff();
+                int64_t squarings = 0;
+                if (norm > 0.5) {
+                    squarings = std::max(static_cast<int64_t>(0), static_cast<int64_t>(std::floor(std::log2(norm))) + 2);
+                }
+                MatrixType scaled = matrix / std::pow(2.0, static_cast<double>(squarings));
+                
+                MatrixType identity = MatrixType::Identity(matrix.rows(), matrix.cols());
+                MatrixType power = identity;
+                MatrixType numerator = identity;
+                MatrixType denominator = identity;
+                double coefficient = 1.0;
+                for (uint64_t k = 1; k <= degree; ++k) {
+                    coefficient *= static_cast<double>(degree + 1 - k) / static_cast<double>(k * (2 * degree + 1 - k));
+                    power = power * scaled;
+                    numerator += coefficient * power;
+                    denominator += (k % 2 == 0 ? coefficient : -coefficient) * power;
+                }
+                MatrixType result = denominator.partialPivLu().solve(numerator);
+                for (int64_t i = 0; i < squarings; ++i) {
+                    result = result * result;
+                }
+                return result;
+            }
+            
+            template<typename ValueType, bool useMixedPoissonProbabilities, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+            std::vector<ValueType> SparseCtmcCslHelper::computeTransientProbabilitiesKrylov(Environment const& env, storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector, ValueType timeBound, ValueType uniformizationRate, std::vector<ValueType> const& values, ValueType epsilon) {
+                typedef Eigen::Matrix<ValueType, Eigen::Dynamic, Eigen::Dynamic> DenseMatrix;
+                uint64_t numberOfStates = uniformizedMatrix.getRowCount();
+                if (numberOfStates == 0) {
+                    return values;
+                }
+                
+                // We solve dx/dt = Qx + c with the generator Q = uniformizationRate * (P - I) of the uniformized matrix P
+                // and the constant inhomogeneity c. As in Expokit, c is handled by augmenting the system with an
+                // additional component that is constantly one.
+                std::vector<ValueType> inhomogeneity;
+                if (useMixedPoissonProbabilities) {
+                    // The values are integrated over time, i.e. the initial vector is zero and the values are the inhomogeneity.
+                    inhomogeneity = values;
+                } else if (addVector) {
+                    inhomogeneity = *addVector;
+                    storm::utility::vector::scaleVectorInPlace(inhomogeneity, uniformizationRate);
+                }
+                bool augmented = !inhomogeneity.empty();
+                uint64_t dimension = numberOfStates + (augmented ? 1 : 0);
+                
+                std::vector<ValueType> w(dimension, storm::utility::zero<ValueType>());
+                if (!useMixedPoissonProbabilities) {
+                    std::copy(values.begin(), values.end(), w.begin());
+                }
+                if (augmented) {
+                    w.back() = storm::utility::one<ValueType>();
+                }
+                
+                auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, uniformizedMatrix);
+                std::vector<ValueType> top(numberOfStates);
+                std::vector<ValueType> product(numberOfStates);
+                auto applyGenerator = [&] (std::vector<ValueType> const& in, std::vector<ValueType>& out) {
+                    std::copy(in.begin(), in.begin() + numberOfStates, top.begin());
+                    multiplier->multiply(env, top, nullptr, product);
+                    for (uint64_t state = 0; state < numberOfStates; ++state) {
+                        out[state] = uniformizationRate * (product[state] - top[state]);
+                        if (augmented) {
+                            out[state] += inhomogeneity[state] * in.back();
+                        }
+                    }
+                    if (augmented) {
+                        out.back() = storm::utility::zero<ValueType>();
+                    }
+                };
+                auto norm = [] (std::vector<ValueType> const& v) {
+                    ValueType sum = storm::utility::zero<ValueType>();
+                    for (auto const& element : v) {
+                        sum += element * element;
+                    }
+                    return std::sqrt(sum);
+                };
+                auto roundToTwoDigits = [] (ValueType value) {
+                    // Zero (and non-finite values) have no leading digits to round to.
+                    if (!(value > storm::utility::zero<ValueType>()) || std::isinf(value)) {
+                        return value;
+                    }
+                    ValueType s = std::pow(10.0, std::floor(std::log10(value)) - 1);
+                    return std::ceil(value / s) * s;
+                };
+                
+                // The error is controlled per time unit, so we distribute the allowed error over the time horizon.
+                ValueType tolerance = epsilon / timeBound;
+                
+                // The parameters are chosen as in Expokit.
+                uint64_t const krylovDimension = std::min(static_cast<uint64_t>(30), dimension);
+                uint64_t const maxRejections = 10;
+                ValueType const breakdownTolerance = 1e-7;
+                ValueType const gamma = 0.9;
+                ValueType const delta = 1.2;
+                
+                // Estimate the infinity norm of the (augmented) generator.
+                ValueType generatorNorm = 2 * uniformizationRate;
+                if (augmented) {
+                    ValueType maxInhomogeneity = storm::utility::zero<ValueType>();
+                    for (auto const& element : inhomogeneity) {
+                        maxInhomogeneity = std::max(maxInhomogeneity, std::abs(element));
+                    }
+                    generatorNorm += maxInhomogeneity;
+                }
+                
+                ValueType beta = norm(w);
+                if (storm::utility::isZero(beta)) {
+                    w.resize(numberOfStates);
+                    return w;
+                }
+                ValueType factor = std::pow((krylovDimension + 1) / std::exp(1.0), krylovDimension + 1) * std::sqrt(2 * std::acos(-1.0) * (krylovDimension + 1));
+                ValueType exponent = storm::utility::one<ValueType>() / krylovDimension;
+                ValueType nextStepSize = roundToTwoDigits((1 / generatorNorm) * std::pow((factor * tolerance) / (4 * beta * generatorNorm), exponent));
+                
+                std::vector<std::vector<ValueType>> basis(krylovDimension + 1, std::vector<ValueType>(dimension));
+                std::vector<ValueType> p(dimension);
+                ValueType currentTime = storm::utility::zero<ValueType>();
+                uint64_t steps = 0;
+                uint64_t matrixVectorProducts = 0;
+                while (currentTime < timeBound) {
+                    ++steps;
+                    ValueType stepSize = std::min(timeBound - currentTime, nextStepSize);
+                    STORM_LOG_THROW(stepSize > storm::utility::zero<ValueType>(), storm::exceptions::NotConvergedException, "The Krylov method failed to reach the requested precision; the time step became zero.");
+                    
+                    // Build an orthonormal basis of the Krylov subspace with the Arnoldi process.
+                    DenseMatrix hessenberg = DenseMatrix::Zero(krylovDimension + 2, krylovDimension + 2);
+                    for (uint64_t i = 0; i < dimension; ++i) {
+                        basis[0][i] = w[i] / beta;
+                    }
+                    uint64_t usedDimension = krylovDimension;
+                    uint64_t extension = 2;
+                    for (uint64_t j = 0; j < krylovDimension; ++j) {
+                        applyGenerator(basis[j], p);
+                        ++matrixVectorProducts;
+                        for (uint64_t i = 0; i <= j; ++i) {
+                            ValueType dotProduct = storm::utility::vector::dotProduct(basis[i], p);
+                            hessenberg(i, j) = dotProduct;
+                            storm::utility::vector::addScaledVector(p, basis[i], -dotProduct);
+                        }
+                        ValueType s = norm(p);
+                        if (s < breakdownTolerance) {
+                            // Happy breakdown: the subspace is invariant, so the remaining horizon can be done in one step.
+                            extension = 0;
+                            usedDimension = j + 1;
+                            stepSize = timeBound - currentTime;
+                            break;
+                        }
+                        hessenberg(j + 1, j) = s;
+                        for (uint64_t i = 0; i < dimension; ++i) {
+                            basis[j + 1][i] = p[i] / s;
+                        }
+                    }
+                    ValueType nextBasisNorm = storm::utility::zero<ValueType>();
+                    if (extension != 0) {
+                        hessenberg(krylovDimension + 1, krylovDimension) = storm::utility::one<ValueType>();
+                        applyGenerator(basis[krylovDimension], p);
+                        ++matrixVectorProducts;
+                        nextBasisNorm = norm(p);
+                    }
+                    
+                    // Compute the exponential of the projected matrix and reject the step as long as the error is too large.
+                    DenseMatrix exponential;
+                    ValueType localError = breakdownTolerance;
+                    for (uint64_t rejections = 0; ; ++rejections) {
+                        uint64_t size = usedDimension + extension;
+                        exponential = computeMatrixExponential<DenseMatrix>(stepSize * hessenberg.topLeftCorner(size, size));
+                        if (extension == 0) {
+                            break;
+                        }
+                        ValueType phi1 = std::abs(beta * exponential(krylovDimension, 0));
+                        ValueType phi2 = std::abs(beta * exponential(krylovDimension + 1, 0) * nextBasisNorm);
+                        if (phi1 > 10 * phi2) {
+                            localError = phi2;
+                            exponent = storm::utility::one<ValueType>() / krylovDimension;
+                        } else if (phi1 > phi2) {
+                            localError = (phi1 * phi2) / (phi1 - phi2);
+                            exponent = storm::utility::one<ValueType>() / krylovDimension;
+                        } else {
+                            localError = phi1;
+                            exponent = storm::utility::one<ValueType>() / (krylovDimension - 1);
+                        }
+                        if (localError <= delta * stepSize * tolerance) {
+                            break;
+                        }
+                        STORM_LOG_THROW(rejections < maxRejections, storm::exceptions::NotConvergedException, "The Krylov method failed to reach the requested precision; the time step became too small.");
+                        stepSize = roundToTwoDigits(gamma * stepSize * std::pow(stepSize * tolerance / localError, exponent));
+                    }
+                    
+                    // Update the vector.
+                    uint64_t resultDimension = usedDimension + (extension > 0 ? extension - 1 : 0);
+                    std::fill(w.begin(), w.end(), storm::utility::zero<ValueType>());
+                    for (uint64_t j = 0; j < resultDimension; ++j) {
+                        storm::utility::vector::addScaledVector(w, basis[j], beta * exponential(j, 0));
+                    }
+                    beta = norm(w);
+                    currentTime += stepSize;
+                    if (storm::utility::isZero(beta)) {
+                        break;
+                    }
+                    nextStepSize = roundToTwoDigits(gamma * stepSize * std::pow(stepSize * tolerance / std::max(localError, breakdownTolerance * tolerance), exponent));
+                }
+                STORM_LOG_INFO("Krylov method used " << steps << " steps and " << matrixVectorProducts << " matrix-vector multiplications.");
+                
+                w.resize(numberOfStates);
+                return w;
+            }
+            
             template <typename ValueType>
             storm::storage::SparseMatrix<ValueType> SparseCtmcCslHelper::computeProbabilityMatrix(storm::storage::SparseMatrix<ValueType> const& rateMatrix, std::vector<ValueType> const& exitRates) {
                 // Turn the rates into probabilities by scaling each row with the exit rate of the state.
@@ -710,7 +1026,7 @@ namespace storm {
             
             template storm::storage::SparseMatrix<double> SparseCtmcCslHelper::computeUniformizedMatrix(storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::BitVector const& maybeStates, double uniformizationRate, std::vector<double> const& exitRates);
             
-            template std::vector<double> SparseCtmcCslHelper::computeTransientProbabilities(Environment const& env, storm::storage::SparseMatrix<double> const& uniformizedMatrix, std::vector<double> const* addVector, double timeBound, double uniformizationRate, std::vector<double> values, double epsilon);
+            template std::vector<double> SparseCtmcCslHelper::computeTransientProbabilities(Environment const& env, storm::storage::SparseMatrix<double> const& uniformizedMatrix, std::vector<double> const* addVector, double timeBound, double uniformizationRate, std::vector<double> values, double epsilon, uint64_t* numberOfIterations);
 
 #ifdef STORM_HAVE_CARL
             template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<storm::RationalNumber> const& exitRates, bool qualitative, double lowerBound, double upperBound);
@@ -85,12 +85,33 @@ namespace storm {
                  * @param uniformizationRate The used uniformization rate.
                  * @param values A vector mapping each state to an initial probability.
                  * @param epsilon The precision used for computing the truncation points
+                 * @param numberOfIterations If given, the number of performed matrix-vector multiplications is stored here
+                 * (only if uniformization is used).
                  * @tparam useMixedPoissonProbabilities If set to true, instead of taking the poisson probabilities,  mixed
                  * poisson probabilities are used.
                  * @return The vector of transient probabilities.
                  */
                 template<typename ValueType, bool useMixedPoissonProbabilities = false, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
-                static std::vector<ValueType> computeTransientProbabilities(Environment const& env, storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector, ValueType timeBound, ValueType uniformizationRate, std::vector<ValueType> values, ValueType epsilon);
+                static std::vector<ValueType> computeTransientProbabilities(Environment const& env, storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector, ValueType timeBound, ValueType uniformizationRate, std::vector<ValueType> values, ValueType epsilon, uint64_t* numberOfIterations = nullptr);
+                
+                /*!
+                 * Computes the same vector as computeTransientProbabilities, but instead of uniformization, it uses a
+                 * Krylov subspace projection of the generator matrix to approximate the matrix exponential (in the
+                 * style of Expokit). The time horizon is split into steps whose size is adapted to the estimated local
+                 * error.
+                 *
+                 * @param uniformizedMatrix The uniformized transition matrix (from which the generator is obtained).
+                 * @param addVector A vector that is added in each step as a possible compensation for removing absorbing states
+                 * with a non-zero initial value. If this is not supposed to be used, it can be set to nullptr.
+                 * @param timeBound The time bound to use.
+                 * @param uniformizationRate The used uniformization rate.
+                 * @param values A vector mapping each state to an initial probability.
+                 * @param epsilon The tolerated (absolute) error.
+                 * @tparam useMixedPoissonProbabilities If set to true, the values are integrated over the time horizon.
+                 * @return The vector of transient probabilities.
+                 */
+                template<typename ValueType, bool useMixedPoissonProbabilities = false, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+                static std::vector<ValueType> computeTransientProbabilitiesKrylov(Environment const& env, storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector, ValueType timeBound, ValueType uniformizationRate, std::vector<ValueType> const& values, ValueType epsilon);
                 
                 /*!
                  * Converts the given rate-matrix into a time-abstract probability matrix.
@@ -181,6 +181,10 @@ namespace storm {
                     // Set the values for all maybe-states to 0.5 to indicate that their probability values are neither 0 nor 1.
                     storm::utility::vector::setVectorValues<ValueType>(result, maybeStates, storm::utility::convertNumber<ValueType>(0.5));
                 } else {
+                    if (goal.hasRelevantValues()) {
+                        // The values of maybe states that are not reachable from the relevant states do not influence the relevant values.
+                        storm::utility::graph::restrictToStatesReachableFromRelevantStates(transitionMatrix, goal.relevantValues(), maybeStates);
+                    }
                     if (!maybeStates.empty()) {
                         // In this case we have to compute the probabilities.
                         
@@ -440,6 +444,10 @@ namespace storm {
                     // are neither 0 nor infinity.
                     storm::utility::vector::setVectorValues<ValueType>(result, maybeStates, storm::utility::one<ValueType>());
                 } else {
+                    if (goal.hasRelevantValues()) {
+                        // The values of maybe states that are not reachable from the relevant states do not influence the relevant values.
+                        storm::utility::graph::restrictToStatesReachableFromRelevantStates(transitionMatrix, goal.relevantValues(), maybeStates);
+                    }
                     if (!maybeStates.empty()) {
                         // Check whether we need to convert the input to equation system format.
                         storm::solver::GeneralLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
@@ -611,6 +611,10 @@ namespace storm {
                     // Set the values for all maybe-states to 0.5 to indicate that their probability values are neither 0 nor 1.
                     storm::utility::vector::setVectorValues<ValueType>(result, qualitativeStateSets.maybeStates, storm::utility::convertNumber<ValueType>(0.5));
                 } else {
+                    if (!produceScheduler && goal.hasRelevantValues()) {
+                        // The values of maybe states that are not reachable from the relevant states (under any choice) do not influence the relevant values.
+                        storm::utility::graph::restrictToStatesReachableFromRelevantStates(transitionMatrix, goal.relevantValues(), qualitativeStateSets.maybeStates);
+                    }
                     if (!qualitativeStateSets.maybeStates.empty()) {
                         // In this case we have have to compute the remaining probabilities.
                         
@@ -1097,6 +1101,10 @@ namespace storm {
                     // are neither 0 nor infinity.
                     storm::utility::vector::setVectorValues<ValueType>(result, qualitativeStateSets.maybeStates, storm::utility::one<ValueType>());
                 } else {
+                    if (!produceScheduler && goal.hasRelevantValues()) {
+                        // The values of maybe states that are not reachable from the relevant states (under any choice) do not influence the relevant values.
+                        storm::utility::graph::restrictToStatesReachableFromRelevantStates(transitionMatrix, goal.relevantValues(), qualitativeStateSets.maybeStates);
+                    }
                     if (!qualitativeStateSets.maybeStates.empty()) {
                         // In this case we have to compute the reward values for the remaining states.
 
@@ -1308,6 +1316,11 @@ namespace storm {
                     goal.oneMinus();
                 }
                 
+                // The relevant values refer to the original model, so we translate them to the transformed model.
+                storm::storage::BitVector newRelevantValues(newFailState + 1);
+                newRelevantValues.set(numberOfStatesBeforeRelevantStates[initialState]);
+                goal.setRelevantValues(std::move(newRelevantValues));
+                
                 std::chrono::high_resolution_clock::time_point conditionalStart = std::chrono::high_resolution_clock::now();
                 std::vector<ValueType> goalProbabilities = std::move(computeUntilProbabilities(env, std::move(goal), newTransitionMatrix, newBackwardTransitions, storm::storage::BitVector(newFailState + 1, true), newGoalStates, false, false).values);
                 std::chrono::high_resolution_clock::time_point conditionalEnd = std::chrono::high_resolution_clock::now();
@@ -830,6 +830,13 @@ namespace storm {
                     epochSolutions[currentEpoch.get()] = std::move(solution);
                 }
                 
+                template<typename ValueType, bool SingleObjectiveMode>
+                void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::clearEpochSolutions() {
+                    epochSolutions.clear();
+                    // Make sure that the solvers for the next epoch model are set up again.
+                    currentEpoch = boost::none;
+                }
+                
                 template<typename ValueType, bool SingleObjectiveMode>
                 typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::SolutionType const& MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getStateSolution(Epoch const& epoch, uint64_t const& productState) {
                     auto epochSolutionIt = epochSolutions.find(epoch);
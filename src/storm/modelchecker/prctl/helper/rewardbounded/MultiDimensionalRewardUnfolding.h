@@ -76,6 +76,13 @@ namespace storm {
                     boost::optional<ValueType> getLowerObjectiveBound(uint64_t objectiveIndex = 0);
                     
                     void setSolutionForCurrentEpoch(std::vector<SolutionType>&& inStateSolutions);
+                    
+                    /*!
+                     * Discards the solutions of all epochs (e.g. to recompute them with a higher precision) while keeping
+                     * the product model.
+                     */
+                    void clearEpochSolutions();
+                    
                     SolutionType getInitialStateResult(Epoch const& epoch); // Assumes that the initial state is unique
                     SolutionType getInitialStateResult(Epoch const& epoch, uint64_t initialStateIndex);
                     
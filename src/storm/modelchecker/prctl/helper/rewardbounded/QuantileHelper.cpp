@@ -3,6 +3,7 @@
 #include <set>
 #include <vector>
 #include <memory>
+#include <future>
 #include <boost/optional.hpp>
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
@@ -17,6 +18,7 @@
 #include "storm/utility/vector.h"
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
+#include "storm/settings/modules/ModelCheckerSettings.h"
 
 #include "storm/logic/ProbabilityOperatorFormula.h"
 #include "storm/logic/BoundedUntilFormula.h"
@@ -30,7 +32,7 @@ namespace storm {
             namespace rewardbounded {
 
                 template<typename ModelType>
-                QuantileHelper<ModelType>::QuantileHelper(ModelType const& model, storm::logic::QuantileFormula const& quantileFormula) : model(model), quantileFormula(quantileFormula) {
+                QuantileHelper<ModelType>::QuantileHelper(ModelType const& model, storm::logic::QuantileFormula const& quantileFormula) : model(model), quantileFormula(quantileFormula), computingSubQueriesConcurrently(false) {
                     // Do all kinds of sanity check.
                     std::set<storm::expressions::Variable> quantileVariables;
                     for (auto const& quantileVariable : quantileFormula.getBoundVariables()) {
@@ -228,17 +230,43 @@ namespace storm {
                     return result;
                 }
 
+                template<typename ModelType>
+                uint64_t QuantileHelper<ModelType>::getNumberOfPrecisionRefinements() const {
+                    return numPrecisionRefinements;
+                }
+
                 template<typename ModelType>
                 std::pair<CostLimitClosure, std::vector<typename QuantileHelper<ModelType>::ValueType>> QuantileHelper<ModelType>::computeQuantile(Environment& env, storm::storage::BitVector const& consideredDimensions, bool complementaryQuery) {
                     STORM_LOG_ASSERT(consideredDimensions.isSubsetOf(getOpenDimensions()), "Considered dimensions for a quantile query should be a subset of the set of dimensions without a fixed bound.");
 
                     storm::storage::BitVector cacheKey = consideredDimensions;
                     cacheKey.resize(cacheKey.size() + 1, complementaryQuery);
-                    auto cacheIt = cachedSubQueryResults.find(cacheKey);
-                    if (cacheIt != cachedSubQueryResults.end()) {
-                        return cacheIt->second;
+                    std::promise<std::pair<CostLimitClosure, std::vector<ValueType>>> promise;
+                    {
+                        std::unique_lock<std::mutex> lock(mutex);
+                        auto cacheIt = cachedSubQueryResults.find(cacheKey);
+                        if (cacheIt != cachedSubQueryResults.end()) {
+                            // The result is either available or currently computed by another thread.
+                            std::shared_future<std::pair<CostLimitClosure, std::vector<ValueType>>> cachedResult = cacheIt->second;
+                            lock.unlock();
+                            return cachedResult.get();
+                        }
+                        cachedSubQueryResults.emplace(cacheKey, promise.get_future().share());
                     }
                     
+                    // A sub-query only depends on sub-queries with fewer dimensions, so waiting for other threads can not deadlock.
+                    try {
+                        auto result = computeUncachedQuantile(env, consideredDimensions, complementaryQuery);
+                        promise.set_value(result);
+                        return result;
+                    } catch (...) {
+                        promise.set_exception(std::current_exception());
+                        throw;
+                    }
+                }
+                
+                template<typename ModelType>
+                std::pair<CostLimitClosure, std::vector<typename QuantileHelper<ModelType>::ValueType>> QuantileHelper<ModelType>::computeUncachedQuantile(Environment& env, storm::storage::BitVector const& consideredDimensions, bool complementaryQuery) {
                     auto boundedUntilOp = transformBoundedUntilOperator(quantileFormula.getSubformula().asProbabilityOperatorFormula(), std::vector<BoundTransformation>(getDimension(), BoundTransformation::None), complementaryQuery);
                     std::set<storm::expressions::Variable> infinityVariables;
                     storm::storage::BitVector lowerBoundedDimensions(getDimension());
@@ -260,10 +288,17 @@ namespace storm {
                     bool onlyUpperCostBounds = lowerBoundedDimensions.empty();
                     bool onlyLowerCostBounds = lowerBoundedDimensions == consideredDimensions;
                     if (onlyUpperCostBounds || onlyLowerCostBounds) {
+                        bool subQueryComplement = complementaryQuery != ((onlyUpperCostBounds && hasLowerValueBound) || (onlyLowerCostBounds && !hasLowerValueBound));
+                        std::vector<storm::storage::BitVector> allSubQueryDimensions;
+                        for (auto const& k : consideredDimensions) {
+                            allSubQueryDimensions.push_back(consideredDimensions);
+                            allSubQueryDimensions.back().set(k, false);
+                        }
+                        computeSubQueriesConcurrently(env, allSubQueryDimensions, subQueryComplement);
+                        
                         for (auto const& k : consideredDimensions) {
                             storm::storage::BitVector subQueryDimensions = consideredDimensions;
                             subQueryDimensions.set(k, false);
-                            bool subQueryComplement = complementaryQuery != ((onlyUpperCostBounds && hasLowerValueBound) || (onlyLowerCostBounds && !hasLowerValueBound));
                             auto subQueryResult = computeQuantile(env, subQueryDimensions, subQueryComplement);
                             for (auto const& subQueryCostLimit : subQueryResult.first.getGenerator()) {
                                 CostLimits initPoint;
@@ -289,21 +324,60 @@ namespace storm {
                     
                     // Loop until the goal precision is reached.
                     STORM_LOG_DEBUG("Computing quantile for dimensions: " << consideredDimensions);
+                    // Initialize the reward unfolding. The product model is kept if the computation needs to be restarted.
+                    MultiDimensionalRewardUnfolding<ValueType, true> rewardUnfolding(model, boundedUntilOp, infinityVariables);
                     while (true) {
-                        // initialize reward unfolding and data that will be needed for each epoch
-                        MultiDimensionalRewardUnfolding<ValueType, true> rewardUnfolding(model, boundedUntilOp, infinityVariables);
                         if (computeQuantile(env, consideredDimensions, *boundedUntilOp, lowerBoundedDimensions, satCostLimits, unsatCostLimits, rewardUnfolding)) {
                             std::vector<ValueType> scalingFactors;
                             for (auto const& dim : consideredDimensions) {
                                 scalingFactors.push_back(rewardUnfolding.getDimension(dim).scalingFactor);
                             }
-                            std::pair<CostLimitClosure, std::vector<ValueType>> result(satCostLimits, scalingFactors);
-                            cachedSubQueryResults.emplace(cacheKey, result);
-                            return result;
+                            return std::pair<CostLimitClosure, std::vector<ValueType>>(satCostLimits, scalingFactors);
                         }
-                        STORM_LOG_WARN("Restarting quantile computation after " << swExploration << " seconds due to insufficient precision.");
+                        STORM_LOG_WARN("Restarting quantile computation for dimensions " << consideredDimensions << " due to insufficient precision.");
                         ++numPrecisionRefinements;
                         increasePrecision(env);
+                        // The epoch solutions obtained so far are too imprecise. However, the cost limits that have been
+                        // classified as (un)satisfied remain valid.
+                        rewardUnfolding.clearEpochSolutions();
+                    }
+                }
+                
+                template<typename ModelType>
+                void QuantileHelper<ModelType>::computeSubQueriesConcurrently(Environment const& env, std::vector<storm::storage::BitVector> const& subQueryDimensions, bool complementaryQuery) {
+                    auto const& modelCheckerSettings = storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>();
+                    // Nested sub-queries are computed sequentially by the threads that are already running.
+                    if (!modelCheckerSettings.isConcurrentQuantileSubQueriesSet() || computingSubQueriesConcurrently) {
+                        return;
+                    }
+                    uint64_t numberOfThreads = std::min<uint64_t>(modelCheckerSettings.getNumberOfConcurrentQuantileSubQueryThreads(), subQueryDimensions.size());
+                    if (numberOfThreads <= 1) {
+                        return;
+                    }
+                    STORM_LOG_DEBUG("Computing " << subQueryDimensions.size() << " sub-queries on " << numberOfThreads << " threads.");
+                    
+                    // Trigger the lazily computed parts of the model such that all threads can share it read-only.
+                    model.getTransitionMatrix().getRowGroupIndices();
+                    
+                    computingSubQueriesConcurrently = true;
+                    std::atomic<uint64_t> nextSubQuery(0);
+                    std::vector<std::future<void>> workers;
+                    for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+                        workers.push_back(std::async(std::launch::async, [&] () {
+                            // Each thread refines the precision of its own copy of the environment.
+                            Environment envCpy = env;
+                            for (uint64_t subQuery = nextSubQuery++; subQuery < subQueryDimensions.size(); subQuery = nextSubQuery++) {
+                                computeQuantile(envCpy, subQueryDimensions[subQuery], complementaryQuery);
+                            }
+                        }));
+                    }
+                    for (auto& worker : workers) {
+                        worker.wait();
+                    }
+                    computingSubQueriesConcurrently = false;
+                    // Rethrow exceptions that occurred in one of the threads.
+                    for (auto& worker : workers) {
+                        worker.get();
                     }
                 }
 
@@ -370,7 +444,14 @@ namespace storm {
                         rewardUnfolding.setEquationSystemFormatForEpochModel(storm::solver::GeneralLinearEquationSolverFactory<ValueType>().getEquationProblemFormat(env));
                     }
 
-                    swExploration.start();
+                    // The stopwatches are merged into the overall statistics at the end as sub-queries might be computed concurrently.
+                    storm::utility::Stopwatch explorationWatch(true), epochAnalysisWatch;
+                    auto addStatistics = [&] () {
+                        explorationWatch.stop();
+                        std::lock_guard<std::mutex> lock(mutex);
+                        swExploration.add(explorationWatch);
+                        swEpochAnalysis.add(epochAnalysisWatch);
+                    };
                     bool progress = true;
                     for (CostLimit candidateCostLimitSum(0); progress; ++candidateCostLimitSum.get()) {
                         CostLimits currentCandidate(satCostLimits.dimension(), CostLimit(0));
@@ -402,14 +483,14 @@ namespace storm {
                                 auto epochSequence = rewardUnfolding.getEpochComputationOrder(startEpoch, true);
                                 for (auto const& epoch : epochSequence) {
                                     ++numCheckedEpochs;
-                                    swEpochAnalysis.start();
+                                    epochAnalysisWatch.start();
                                     auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
                                     if (model.isNondeterministicModel()) {
                                         rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(env, boundedUntilOperator.getOptimalityType(), x, b, minMaxSolver, lowerBound, upperBound));
                                     } else {
                                         rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(env, x, b, linEqSolver, lowerBound, upperBound));
                                     }
-                                    swEpochAnalysis.stop();
+                                    epochAnalysisWatch.stop();
 
                                     CostLimits epochAsCostLimits;
                                     if (translateEpochToCostLimits(epoch, startEpoch, consideredDimensions, lowerBoundedDimensions, rewardUnfolding.getEpochManager(), epochAsCostLimits)) {
@@ -421,7 +502,7 @@ namespace storm {
                                             propertySatisfied =  boundedUntilOperator.getBound().isSatisfied(lowerUpperValue.first);
                                             if (propertySatisfied !=  boundedUntilOperator.getBound().isSatisfied(lowerUpperValue.second)) {
                                                 // unclear result due to insufficient precision.
-                                                swExploration.stop();
+                                                addStatistics();
                                                 return false;
                                             }
                                         } else {
@@ -440,7 +521,7 @@ namespace storm {
                             progress = !CostLimitClosure::unionFull(satCostLimits, unsatCostLimits);
                         }
                     }
-                    swExploration.stop();
+                    addStatistics();
                     return true;
                 }
                 
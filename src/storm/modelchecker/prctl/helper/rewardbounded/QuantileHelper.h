@@ -1,6 +1,9 @@
 #pragma once
 
+#include <atomic>
+#include <future>
 #include <map>
+#include <mutex>
 #include <boost/optional.hpp>
 
 #include "storm/logic/QuantileFormula.h"
@@ -25,10 +28,25 @@ namespace storm {
 
                     std::vector<std::vector<ValueType>> computeQuantile(Environment const& env);
 
+                    /*!
+                     * Retrieves how often the solver precision had to be increased during the last quantile computation.
+                     */
+                    uint64_t getNumberOfPrecisionRefinements() const;
+
                 private:
 
+                    /*!
+                     * Retrieves the result of the given sub-query. If the sub-query has not been requested before, it is computed.
+                     * If it is currently computed by another thread, this waits for that computation to finish.
+                     */
                     std::pair<CostLimitClosure, std::vector<ValueType>> computeQuantile(Environment& env, storm::storage::BitVector const& consideredDimensions, bool complementaryQuery);
+                    std::pair<CostLimitClosure, std::vector<ValueType>> computeUncachedQuantile(Environment& env, storm::storage::BitVector const& consideredDimensions, bool complementaryQuery);
                     bool computeQuantile(Environment& env, storm::storage::BitVector const& consideredDimensions, storm::logic::ProbabilityOperatorFormula const& boundedUntilOperator, storm::storage::BitVector const& lowerBoundedDimensions, CostLimitClosure& satCostLimits, CostLimitClosure& unsatCostLimits, MultiDimensionalRewardUnfolding<ValueType, true>& rewardUnfolding);
+                    
+                    /*!
+                     * Computes the given (independent) sub-queries concurrently (if enabled) and stores their results in the cache.
+                     */
+                    void computeSubQueriesConcurrently(Environment const& env, std::vector<storm::storage::BitVector> const& subQueryDimensions, bool complementaryQuery);
 
 
                     /*!
@@ -47,11 +65,16 @@ namespace storm {
 
                     ModelType const& model;
                     storm::logic::QuantileFormula const& quantileFormula;
-                    std::map<storm::storage::BitVector, std::pair<CostLimitClosure, std::vector<ValueType>>> cachedSubQueryResults;
+                    // The results of sub-queries that have been computed or are currently being computed.
+                    std::map<storm::storage::BitVector, std::shared_future<std::pair<CostLimitClosure, std::vector<ValueType>>>> cachedSubQueryResults;
+                    
+                    // Guards the cached results and the stopwatches while sub-queries are computed concurrently.
+                    std::mutex mutex;
+                    bool computingSubQueriesConcurrently;
                     
                     /// Statistics
-                    mutable uint64_t numCheckedEpochs;
-                    mutable uint64_t numPrecisionRefinements;
+                    mutable std::atomic<uint64_t> numCheckedEpochs;
+                    mutable std::atomic<uint64_t> numPrecisionRefinements;
                     mutable storm::utility::Stopwatch swEpochAnalysis;
                     mutable storm::utility::Stopwatch swExploration;
                 };
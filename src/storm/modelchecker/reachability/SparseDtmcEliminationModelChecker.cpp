@@ -499,6 +499,139 @@ namespace storm {
             return std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(result);
         }
         
+        template<typename SparseDtmcModelType>
+        std::vector<uint64_t> SparseDtmcEliminationModelChecker<SparseDtmcModelType>::computeUntilProbabilitiesAsStraightLineProgram(storm::storage::SparseMatrix<ValueType> const& probabilityMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& initialStates, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, storm::storage::StraightLineProgram<ValueType>& program) {
+            std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01 = storm::utility::graph::performProb01(backwardTransitions, phiStates, psiStates);
+            storm::storage::BitVector maybeStates = ~(statesWithProbability01.first | statesWithProbability01.second);
+            maybeStates &= storm::utility::graph::getReachableStates(probabilityMatrix, initialStates, maybeStates, statesWithProbability01.second);
+            
+            std::vector<ValueType> oneStepProbabilities = probabilityMatrix.getConstrainedRowSumVector(maybeStates, statesWithProbability01.second);
+            storm::storage::BitVector newInitialStates = initialStates % maybeStates;
+            storm::storage::SparseMatrix<ValueType> submatrix = probabilityMatrix.getSubmatrix(false, maybeStates, maybeStates);
+            storm::storage::SparseMatrix<ValueType> submatrixTransposed = submatrix.transpose();
+            
+            // Determine the order in which the states are eliminated. The initial states are eliminated last, so their
+            // values can be obtained by back substitution afterwards.
+            std::vector<storm::storage::sparse::state_type> eliminationOrder;
+            {
+                storm::storage::FlexibleSparseMatrix<ValueType> flexibleMatrix(submatrix);
+                storm::storage::FlexibleSparseMatrix<ValueType> flexibleBackwardTransitions(submatrixTransposed);
+                storm::settings::modules::EliminationSettings::EliminationOrder order = storm::settings::getModule<storm::settings::modules::EliminationSettings>().getEliminationOrder();
+                boost::optional<std::vector<uint_fast64_t>> distanceBasedPriorities;
+                if (eliminationOrderNeedsDistances(order)) {
+                    distanceBasedPriorities = getDistanceBasedPriorities(submatrix, submatrixTransposed, newInitialStates, oneStepProbabilities, eliminationOrderNeedsForwardDistances(order), eliminationOrderNeedsReversedDistances(order));
+                }
+                std::shared_ptr<StatePriorityQueue> statePriorities = createStatePriorityQueue(distanceBasedPriorities, flexibleMatrix, flexibleBackwardTransitions, oneStepProbabilities, ~newInitialStates);
+                while (statePriorities->hasNext()) {
+                    eliminationOrder.push_back(statePriorities->pop());
+                }
+                for (auto state : newInitialStates) {
+                    eliminationOrder.push_back(state);
+                }
+            }
+            
+            // Translate the transitions and values to nodes of the program. The rows are sorted by column and the
+            // predecessor lists by state.
+            typedef std::vector<std::pair<uint64_t, uint64_t>> NodeRow;
+            std::vector<NodeRow> transitions(submatrix.getRowCount());
+            std::vector<std::vector<uint64_t>> predecessors(submatrix.getRowCount());
+            std::vector<uint64_t> values(submatrix.getRowCount());
+            for (uint64_t state = 0; state < submatrix.getRowCount(); ++state) {
+                for (auto const& entry : submatrix.getRow(state)) {
+                    if (!storm::utility::isZero(entry.getValue())) {
+                        transitions[state].emplace_back(entry.getColumn(), program.addConstant(entry.getValue()));
+                        predecessors[entry.getColumn()].push_back(state);
+                    }
+                }
+                values[state] = program.addConstant(oneStepProbabilities[state]);
+            }
+            
+            STORM_LOG_DEBUG("Eliminating " << eliminationOrder.size() << " states while recording the operations as a straight-line program.");
+            for (auto const& state : eliminationOrder) {
+                NodeRow& row = transitions[state];
+                
+                // Eliminate the self-loop (if any) by scaling the remaining transitions.
+                auto selfLoopIt = std::lower_bound(row.begin(), row.end(), std::make_pair(state, uint64_t(0)));
+                if (selfLoopIt != row.end() && selfLoopIt->first == state) {
+                    uint64_t scaling = program.divide(program.getOne(), program.subtract(program.getOne(), selfLoopIt->second));
+                    row.erase(selfLoopIt);
+                    for (auto& entry : row) {
+                        entry.second = program.multiply(scaling, entry.second);
+                    }
+                    values[state] = program.multiply(scaling, values[state]);
+                }
+                
+                // Redirect the transitions of all predecessors through the state.
+                for (auto const& predecessor : predecessors[state]) {
+                    if (predecessor == state) {
+                        continue;
+                    }
+                    NodeRow& predecessorRow = transitions[predecessor];
+                    auto transitionIt = std::lower_bound(predecessorRow.begin(), predecessorRow.end(), std::make_pair(state, uint64_t(0)));
+                    STORM_LOG_ASSERT(transitionIt != predecessorRow.end() && transitionIt->first == state, "Missing transition of predecessor.");
+                    uint64_t factor = transitionIt->second;
+                    predecessorRow.erase(transitionIt);
+                    
+                    NodeRow newRow;
+                    newRow.reserve(predecessorRow.size() + row.size());
+                    auto first = predecessorRow.begin(), firstEnd = predecessorRow.end();
+                    auto second = row.begin(), secondEnd = row.end();
+                    while (first != firstEnd || second != secondEnd) {
+                        if (second == secondEnd || (first != firstEnd && first->first < second->first)) {
+                            newRow.push_back(*first);
+                            ++first;
+                        } else if (first == firstEnd || second->first < first->first) {
+                            newRow.emplace_back(second->first, program.multiply(factor, second->second));
+                            auto& successorPredecessors = predecessors[second->first];
+                            successorPredecessors.insert(std::lower_bound(successorPredecessors.begin(), successorPredecessors.end(), predecessor), predecessor);
+                            ++second;
+                        } else {
+                            newRow.emplace_back(first->first, program.add(first->second, program.multiply(factor, second->second)));
+                            ++first;
+                            ++second;
+                        }
+                    }
+                    predecessorRow = std::move(newRow);
+                    values[predecessor] = program.add(values[predecessor], program.multiply(factor, values[state]));
+                }
+                
+                // The state is no longer a predecessor of its successors, but its row is kept for the back substitution.
+                for (auto const& entry : row) {
+                    auto& successorPredecessors = predecessors[entry.first];
+                    auto predecessorIt = std::lower_bound(successorPredecessors.begin(), successorPredecessors.end(), state);
+                    if (predecessorIt != successorPredecessors.end() && *predecessorIt == state) {
+                        successorPredecessors.erase(predecessorIt);
+                    }
+                }
+                predecessors[state].clear();
+            }
+            
+            // Obtain the values of the initial states by back substitution. At the time an initial state was eliminated,
+            // only initial states that were eliminated later remained as its successors.
+            std::vector<uint64_t> initialStateNodes(submatrix.getRowCount(), program.getZero());
+            for (auto stateIt = eliminationOrder.rbegin(); stateIt != eliminationOrder.rend() && newInitialStates.get(*stateIt); ++stateIt) {
+                uint64_t node = values[*stateIt];
+                for (auto const& entry : transitions[*stateIt]) {
+                    node = program.add(node, program.multiply(entry.second, initialStateNodes[entry.first]));
+                }
+                initialStateNodes[*stateIt] = node;
+            }
+            
+            std::vector<uint64_t> result;
+            result.reserve(initialStates.getNumberOfSetBits());
+            for (auto state : initialStates) {
+                if (maybeStates.get(state)) {
+                    result.push_back(initialStateNodes[maybeStates.getNumberOfSetBitsBeforeIndex(state)]);
+                } else if (statesWithProbability01.second.get(state)) {
+                    result.push_back(program.getOne());
+                } else {
+                    result.push_back(program.getZero());
+                }
+            }
+            STORM_LOG_DEBUG("The straight-line program has " << program.getNumberOfNodes() << " nodes.");
+            return result;
+        }
+        
         template<typename SparseDtmcModelType>
         std::unique_ptr<CheckResult> SparseDtmcEliminationModelChecker<SparseDtmcModelType>::computeReachabilityRewards(Environment const& env, storm::logic::RewardMeasureType, CheckTask<storm::logic::EventuallyFormula, ValueType> const& checkTask) {
             storm::logic::EventuallyFormula const& eventuallyFormula = checkTask.getFormula();
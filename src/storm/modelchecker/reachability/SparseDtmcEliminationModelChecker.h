@@ -7,6 +7,7 @@
 
 #include "storm/storage/sparse/StateType.h"
 #include "storm/storage/FlexibleSparseMatrix.h"
+#include "storm/storage/StraightLineProgram.h"
 #include "storm/solver/stateelimination/StatePriorityQueue.h"
 
 namespace storm {
@@ -53,6 +54,15 @@ namespace storm {
 
             static std::unique_ptr<CheckResult> computeReachabilityRewards(storm::storage::SparseMatrix<ValueType> const& probabilityMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& initialStates, storm::storage::BitVector const& targetStates, std::vector<ValueType>& stateRewardValues, bool computeForInitialStatesOnly);
 
+            /*!
+             * Computes the until probabilities of the initial states by state elimination. Instead of computing (and
+             * simplifying) the values in every elimination step, the operations are recorded in the given straight-line
+             * program, which can then be evaluated (e.g. for many parameter valuations) or converted to values on demand.
+             *
+             * @return The nodes of the program that represent the probabilities of the initial states (in ascending order of the states).
+             */
+            static std::vector<uint64_t> computeUntilProbabilitiesAsStraightLineProgram(storm::storage::SparseMatrix<ValueType> const& probabilityMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& initialStates, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, storm::storage::StraightLineProgram<ValueType>& program);
+
         private:
             static std::vector<ValueType> computeLongRunValues(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& initialStates, storm::storage::BitVector const& maybeStates, bool computeResultsForInitialStatesOnly, std::vector<ValueType>& stateValues);
             
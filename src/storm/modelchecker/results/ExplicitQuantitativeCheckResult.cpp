@@ -86,7 +86,7 @@ namespace storm {
                     STORM_LOG_THROW(element < this->getValueVector().size(), storm::exceptions::InvalidAccessException, "Invalid index in results.");
                     newMap.emplace(element, this->getValueVector()[element]);
                 }
-                this->values = newMap;
+                this->values = std::move(newMap);
             } else {
                 map_type const& map = boost::get<map_type>(values);
                 
@@ -99,7 +99,7 @@ namespace storm {
                 
                 STORM_LOG_THROW(newMap.size() == filterTruthValues.getNumberOfSetBits(), storm::exceptions::InvalidOperationException, "The check result fails to contain some results referred to by the filter.");
                 
-                this->values = newMap;
+                this->values = std::move(newMap);
             }
         }
 
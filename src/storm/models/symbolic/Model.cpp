@@ -38,7 +38,7 @@ namespace storm {
                                           std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs,
                                           std::map<std::string, storm::expressions::Expression> labelToExpressionMap,
                                           std::unordered_map<std::string, RewardModelType> const& rewardModels)
-            : storm::models::Model<ValueType>(modelType), manager(manager), reachableStates(reachableStates), transitionMatrix(transitionMatrix), rowVariables(rowVariables), rowExpressionAdapter(rowExpressionAdapter), columnVariables(columnVariables), rowColumnMetaVariablePairs(rowColumnMetaVariablePairs), labelToExpressionMap(labelToExpressionMap), rewardModels(rewardModels) {
+            : storm::models::Model<ValueType>(modelType), manager(manager), reachableStates(reachableStates), transitionMatrix(transitionMatrix), rowVariables(rowVariables), rowExpressionAdapter(rowExpressionAdapter), columnVariables(columnVariables), rowColumnMetaVariablePairs(rowColumnMetaVariablePairs), labelToExpressionMap(labelToExpressionMap), rewardModels(rewardModels), transitionPartsReachabilityMethod(storm::utility::dd::ReachabilityMethod::Monolithic) {
                 this->labelToBddMap.emplace("init", initialStates);
                 this->labelToBddMap.emplace("deadlock", deadlockStates);
             }
@@ -55,7 +55,7 @@ namespace storm {
                                           std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs,
                                           std::map<std::string, storm::dd::Bdd<Type>> labelToBddMap,
                                           std::unordered_map<std::string, RewardModelType> const& rewardModels)
-            : storm::models::Model<ValueType>(modelType), manager(manager), reachableStates(reachableStates), transitionMatrix(transitionMatrix), rowVariables(rowVariables), rowExpressionAdapter(nullptr), columnVariables(columnVariables), rowColumnMetaVariablePairs(rowColumnMetaVariablePairs), labelToBddMap(labelToBddMap), rewardModels(rewardModels) {
+            : storm::models::Model<ValueType>(modelType), manager(manager), reachableStates(reachableStates), transitionMatrix(transitionMatrix), rowVariables(rowVariables), rowExpressionAdapter(nullptr), columnVariables(columnVariables), rowColumnMetaVariablePairs(rowColumnMetaVariablePairs), labelToBddMap(labelToBddMap), rewardModels(rewardModels), transitionPartsReachabilityMethod(storm::utility::dd::ReachabilityMethod::Monolithic) {
                 STORM_LOG_THROW(this->labelToBddMap.find("init") == this->labelToBddMap.end(), storm::exceptions::WrongFormatException, "Illegal custom label 'init'.");
                 STORM_LOG_THROW(this->labelToBddMap.find("deadlock") == this->labelToBddMap.end(), storm::exceptions::WrongFormatException, "Illegal custom label 'deadlock'.");
                 this->labelToBddMap.emplace("init", initialStates);
@@ -174,6 +174,27 @@ namespace storm {
                 return this->getTransitionMatrix().notZero();
             }
             
+            template<storm::dd::DdType Type, typename ValueType>
+            void Model<Type, ValueType>::setTransitionParts(std::vector<storm::dd::Bdd<Type>> const& transitionParts, storm::utility::dd::ReachabilityMethod const& method) {
+                this->transitionParts = transitionParts;
+                this->transitionPartsReachabilityMethod = method;
+            }
+            
+            template<storm::dd::DdType Type, typename ValueType>
+            bool Model<Type, ValueType>::hasTransitionParts() const {
+                return !transitionParts.empty();
+            }
+            
+            template<storm::dd::DdType Type, typename ValueType>
+            std::vector<storm::dd::Bdd<Type>> const& Model<Type, ValueType>::getTransitionParts() const {
+                return transitionParts;
+            }
+            
+            template<storm::dd::DdType Type, typename ValueType>
+            storm::utility::dd::ReachabilityMethod const& Model<Type, ValueType>::getTransitionPartsReachabilityMethod() const {
+                return transitionPartsReachabilityMethod;
+            }
+            
             template<storm::dd::DdType Type, typename ValueType>
             std::set<storm::expressions::Variable> const& Model<Type, ValueType>::getRowVariables() const {
                 return rowVariables;
@@ -211,6 +232,7 @@ namespace storm {
             template<storm::dd::DdType Type, typename ValueType>
             void Model<Type, ValueType>::setTransitionMatrix(storm::dd::Add<Type, ValueType> const& transitionMatrix) {
                 this->transitionMatrix = transitionMatrix;
+                this->transitionParts.clear();
             }
             
             template<storm::dd::DdType Type, typename ValueType>
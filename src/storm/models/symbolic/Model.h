@@ -13,6 +13,7 @@
 #include "storm/storage/dd/Bdd.h"
 #include "storm/models/Model.h"
 #include "storm/utility/OsDetection.h"
+#include "storm/utility/dd.h"
 
 #include "storm-config.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
@@ -209,6 +210,32 @@ namespace storm {
                  */
                 virtual storm::dd::Bdd<Type> getQualitativeTransitionMatrix(bool keepNondeterminism = true) const;
                 
+                /*!
+                 * Sets the partitioned transition relation (e.g. one part per action) that was used to explore the
+                 * reachable states. The parts abstract from the nondeterminism variables and may leave the meta variables
+                 * they do not change implicit (see storm::utility::dd::computeReachableStates). Their composition
+                 * must coincide with the qualitative transition matrix without nondeterminism.
+                 *
+                 * @param transitionParts The parts of the transition relation.
+                 * @param method The method with which to combine the parts in (backward) reachability analyses.
+                 */
+                void setTransitionParts(std::vector<storm::dd::Bdd<Type>> const& transitionParts, storm::utility::dd::ReachabilityMethod const& method);
+                
+                /*!
+                 * Retrieves whether the model has a partitioned transition relation.
+                 */
+                bool hasTransitionParts() const;
+                
+                /*!
+                 * Retrieves the parts of the partitioned transition relation.
+                 */
+                std::vector<storm::dd::Bdd<Type>> const& getTransitionParts() const;
+                
+                /*!
+                 * Retrieves the method with which the parts of the transition relation are to be combined.
+                 */
+                storm::utility::dd::ReachabilityMethod const& getTransitionPartsReachabilityMethod() const;
+                
                 /*!
                  * Retrieves the meta variables used to encode the rows of the transition matrix and the vector indices.
                  *
@@ -441,6 +468,10 @@ namespace storm {
                 // The parameters. Only meaningful for models over rational functions.
                 std::set<storm::RationalFunctionVariable> parameters;
                 
+                // The parts of the transition relation (if available) and the method with which they are combined.
+                std::vector<storm::dd::Bdd<Type>> transitionParts;
+                storm::utility::dd::ReachabilityMethod transitionPartsReachabilityMethod;
+                
                 // An empty variable set that can be used when references to non-existing sets need to be returned.
                 std::set<storm::expressions::Variable> emptyVariableSet;
             };
@@ -15,6 +15,8 @@ namespace storm {
             class BuildSettings;
             class ModuleSettings;
             class AbstractionSettings;
+            class EliminationSettings;
+            class ModelCheckerSettings;
         }
         class Option;
         
@@ -319,6 +321,22 @@ namespace storm {
          */
         storm::settings::modules::AbstractionSettings& mutableAbstractionSettings();
         
+        /*!
+         * Retrieves the elimination settings in a mutable form. This is only meant to be used for debug purposes or very
+         * rare cases where it is necessary.
+         *
+         * @return An object that allows accessing and modifying the elimination settings.
+         */
+        storm::settings::modules::EliminationSettings& mutableEliminationSettings();
+        
+        /*!
+         * Retrieves the model checker settings in a mutable form. This is only meant to be used for debug purposes or very
+         * rare cases where it is necessary.
+         *
+         * @return An object that allows accessing and modifying the model checker settings.
+         */
+        storm::settings::modules::ModelCheckerSettings& mutableModelCheckerSettings();
+        
     } // namespace settings
 } // namespace storm
 
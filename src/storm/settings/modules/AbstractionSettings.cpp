@@ -6,6 +6,7 @@
 #include "storm/settings/Argument.h"
 
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/exceptions/IllegalArgumentValueException.h"
 
 namespace storm {
@@ -34,6 +35,7 @@ namespace storm {
             const std::string AbstractionSettings::fixPlayer1StrategyOptionName = "fixpl1strat";
             const std::string AbstractionSettings::fixPlayer2StrategyOptionName = "fixpl2strat";
             const std::string AbstractionSettings::validBlockModeOptionName = "validmode";
+            const std::string AbstractionSettings::threadsOptionName = "threads";
             
             AbstractionSettings::AbstractionSettings() : ModuleSettings(moduleName) {
                 std::vector<std::string> methods = {"games", "bisimulation", "bisim"};
@@ -45,6 +47,9 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, maximalAbstractionOptionName, false, "The maximal number of abstraction to perform before solving is aborted.").setIsAdvanced()
                                 .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The maximal abstraction count.").setDefaultValueUnsignedInteger(20000).build()).build());
                 
+                this->addOption(storm::settings::OptionBuilder(moduleName, threadsOptionName, true, "Sets the number of threads used to enumerate the abstractions of commands/edges.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads (0 means as many as there are hardware threads).").setDefaultValueUnsignedInteger(1).build()).build());
+                
                 std::vector<std::string> onOff = {"on", "off"};
                 
                 this->addOption(storm::settings::OptionBuilder(moduleName, useDecompositionOptionName, true, "Sets whether to apply decomposition during the abstraction.").setIsAdvanced()
@@ -239,6 +244,14 @@ namespace storm {
                 return this->getOption(maximalAbstractionOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
             }
             
+            uint_fast64_t AbstractionSettings::getNumberOfThreads() const {
+                return storm::utility::parallel::resolveNumberOfThreads(this->getOption(threadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger());
+            }
+            
+            void AbstractionSettings::setNumberOfThreads(uint_fast64_t value) {
+                this->getOption(threadsOptionName).getArgumentByName("count").setFromStringValue(std::to_string(value));
+            }
+            
             bool AbstractionSettings::isRankRefinementPredicatesSet() const {
                 return this->getOption(rankRefinementPredicatesOptionName).getArgumentByName("value").getValueAsString() == "on";
             }
@@ -139,6 +139,20 @@ namespace storm {
                  */
                 uint_fast64_t getMaximalAbstractionCount() const;
                 
+                /*!
+                 * Retrieves the number of threads used to enumerate the abstractions of the commands/edges.
+                 *
+                 * @return The number of threads.
+                 */
+                uint_fast64_t getNumberOfThreads() const;
+                
+                /*!
+                 * Sets the number of threads used to enumerate the abstractions of the commands/edges.
+                 *
+                 * @param value The new number of threads (0 means as many as there are hardware threads).
+                 */
+                void setNumberOfThreads(uint_fast64_t value);
+                
                 /*
                  * Determines whether refinement predicates are to be ranked.
                  *
@@ -219,6 +233,7 @@ namespace storm {
                 const static std::string fixPlayer1StrategyOptionName;
                 const static std::string fixPlayer2StrategyOptionName;
                 const static std::string validBlockModeOptionName;
+                const static std::string threadsOptionName;
             };
             
         }
@@ -10,6 +10,7 @@
 #include "storm/parser/CSVParser.h"
 
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/exceptions/IllegalArgumentValueException.h"
 
 namespace storm {
@@ -36,6 +37,12 @@ namespace storm {
             const std::string buildOutOfBoundsStateOptionName = "build-out-of-bounds-state";
             const std::string buildOverlappingGuardsLabelOptionName = "build-overlapping-guards-label";
             const std::string bitsForUnboundedVariablesOptionName = "int-bits";
+            const std::string symbolicReachabilityMethodOptionName = "ddreach";
+            const std::string quotientVariablesOptionName = "build-quotient-vars";
+            const std::string symmetryReductionOptionName = "symmetry-reduction";
+            const std::string guardCachingOptionName = "guard-cache";
+            const std::string treeCompressionOptionName = "tree-compression";
+            const std::string concurrentProductOptionName = "concurrent-product";
 
             BuildSettings::BuildSettings() : ModuleSettings(moduleName) {
 
@@ -57,6 +64,16 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, buildOverlappingGuardsLabelOptionName, false, "For states where multiple guards are enabled, we add a label (for debugging DTMCs)").setIsAdvanced().build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, bitsForUnboundedVariablesOptionName, false, "Sets the number of bits that is used for unbounded integer variables.").setIsAdvanced()
                                         .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("number", "The number of bits.").addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedRangeValidatorExcluding(0,63)).setDefaultValueUnsignedInteger(32).build()).build());
+                std::vector<std::string> symbolicReachabilityMethods = {"mono", "chaining", "saturation"};
+                this->addOption(storm::settings::OptionBuilder(moduleName, symbolicReachabilityMethodOptionName, false, "Sets how reachable states are explored when building symbolic models. 'mono' uses breadth-first search over the monolithic transition relation, 'chaining' and 'saturation' use a transition relation that is partitioned per module/automaton.").setIsAdvanced()
+                                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the method to use.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(symbolicReachabilityMethods)).setDefaultValueString("mono").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, quotientVariablesOptionName, false, "If set, states that only differ in the given variables are merged while exploring the model (sparse engine only). This is only sound if the variables affect neither transitions nor rewards nor labels.").setIsAdvanced()
+                                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("variables", "A comma-separated list of variable names.").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, symmetryReductionOptionName, false, "If set, states that only differ by a permutation of fully symmetric renamed PRISM modules are merged while exploring the model (sparse engine only).").setIsAdvanced().build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, guardCachingOptionName, false, "If set, the enabled commands of each PRISM module are cached w.r.t. the values of the variables read by its guards, so guards are only evaluated for unseen valuations (sparse engine only). This trades memory for speed on models with many commands.").setIsAdvanced().build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, treeCompressionOptionName, false, "If set, the reachable states are stored in a tree-compressed table while exploring the model (sparse engine only). This reduces the memory needed for the states, in particular for models with many variables, at the cost of slower lookups.").setIsAdvanced().build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, concurrentProductOptionName, false, "If set, the transition matrix of products of a model with a memory structure is built concurrently (sparse engine only).").setIsAdvanced()
+                                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("threads", "The number of threads (0 means 'auto-detect').").setDefaultValueUnsignedInteger(0).makeOptional().build()).build());
             }
 
             bool BuildSettings::isExplorationOrderSet() const {
@@ -107,6 +124,14 @@ namespace storm {
                 return this->getOption(buildOverlappingGuardsLabelOptionName).getHasOptionBeenSet();
             }
 
+            bool BuildSettings::isSymmetryReductionSet() const {
+                return this->getOption(symmetryReductionOptionName).getHasOptionBeenSet();
+            }
+
+            bool BuildSettings::isGuardCachingSet() const {
+                return this->getOption(guardCachingOptionName).getHasOptionBeenSet();
+            }
+
             bool BuildSettings::isBuildAllLabelsSet() const {
                 return this->getOption(buildAllLabelsOptionName).getHasOptionBeenSet();
             }
@@ -129,6 +154,66 @@ namespace storm {
                 return this->getOption(bitsForUnboundedVariablesOptionName).getArgumentByName("number").getValueAsUnsignedInteger();
             }
 
+            bool BuildSettings::isQuotientVariablesSet() const {
+                return this->getOption(quotientVariablesOptionName).getHasOptionBeenSet();
+            }
+
+            std::vector<std::string> BuildSettings::getQuotientVariables() const {
+                return storm::parser::parseCommaSeperatedValues(this->getOption(quotientVariablesOptionName).getArgumentByName("variables").getValueAsString());
+            }
+
+            bool BuildSettings::isTreeCompressionSet() const {
+                return this->getOption(treeCompressionOptionName).getHasOptionBeenSet();
+            }
+
+            bool BuildSettings::isConcurrentProductSet() const {
+                return this->getOption(concurrentProductOptionName).getHasOptionBeenSet();
+            }
+
+            uint64_t BuildSettings::getNumberOfConcurrentProductThreads() const {
+                return storm::utility::parallel::resolveNumberOfThreads(this->getOption(concurrentProductOptionName).getArgumentByName("threads").getValueAsUnsignedInteger());
+            }
+
+            uint64_t BuildSettings::getNumberOfProductThreads() const {
+                return isConcurrentProductSet() ? getNumberOfConcurrentProductThreads() : 1;
+            }
+
+            std::unique_ptr<storm::settings::SettingMemento> BuildSettings::overrideConcurrentProductSet(bool stateToSet) {
+                return this->overrideOption(concurrentProductOptionName, stateToSet);
+            }
+
+            void BuildSettings::setNumberOfConcurrentProductThreads(uint64_t value) {
+                this->getOption(concurrentProductOptionName).getArgumentByName("threads").setFromStringValue(std::to_string(value));
+            }
+
+            storm::utility::dd::ReachabilityMethod BuildSettings::getSymbolicReachabilityMethod() const {
+                std::string methodAsString = this->getOption(symbolicReachabilityMethodOptionName).getArgumentByName("name").getValueAsString();
+                if (methodAsString == "mono") {
+                    return storm::utility::dd::ReachabilityMethod::Monolithic;
+                } else if (methodAsString == "chaining") {
+                    return storm::utility::dd::ReachabilityMethod::Chaining;
+                } else if (methodAsString == "saturation") {
+                    return storm::utility::dd::ReachabilityMethod::Saturation;
+                }
+                STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown symbolic reachability method '" << methodAsString << "'.");
+            }
+            
+            void BuildSettings::setSymbolicReachabilityMethod(storm::utility::dd::ReachabilityMethod const& method) {
+                std::string methodAsString;
+                switch (method) {
+                    case storm::utility::dd::ReachabilityMethod::Monolithic:
+                        methodAsString = "mono";
+                        break;
+                    case storm::utility::dd::ReachabilityMethod::Chaining:
+                        methodAsString = "chaining";
+                        break;
+                    case storm::utility::dd::ReachabilityMethod::Saturation:
+                        methodAsString = "saturation";
+                        break;
+                }
+                this->getOption(symbolicReachabilityMethodOptionName).getArgumentByName("name").setFromStringValue(methodAsString);
+            }
+
         }
 
 
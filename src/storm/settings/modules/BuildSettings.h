@@ -4,6 +4,7 @@
 #include "storm-config.h"
 #include "storm/settings/modules/ModuleSettings.h"
 #include "storm/builder/ExplorationOrder.h"
+#include "storm/utility/dd.h"
 
 namespace storm {
     namespace settings {
@@ -105,6 +106,16 @@ namespace storm {
                  */
                  bool isAddOverlappingGuardsLabelSet() const;
 
+                /*!
+                 * Retrieves whether states are to be canonicalized w.r.t. symmetric module replications
+                 */
+                bool isSymmetryReductionSet() const;
+
+                /*!
+                 * Retrieves whether the enabled commands are to be cached per module
+                 */
+                bool isGuardCachingSet() const;
+
                 /*!
                  * Retrieves whether all labels should be build
                  */
@@ -116,6 +127,70 @@ namespace storm {
                  */
                 uint64_t getBitsForUnboundedVariables() const;
 
+                /*!
+                 * Retrieves the method that is used for the reachability analysis when building symbolic models.
+                 *
+                 * @return The chosen method.
+                 */
+                storm::utility::dd::ReachabilityMethod getSymbolicReachabilityMethod() const;
+                
+                /*!
+                 * Sets the method that is used for the reachability analysis when building symbolic models.
+                 *
+                 * @param method The new method.
+                 */
+                void setSymbolicReachabilityMethod(storm::utility::dd::ReachabilityMethod const& method);
+
+                /*!
+                 * Retrieves whether states are to be merged with respect to some variables during exploration.
+                 */
+                bool isQuotientVariablesSet() const;
+
+                /*!
+                 * Retrieves the names of the variables whose values are ignored when identifying states during exploration.
+                 *
+                 * @return The names of the variables.
+                 */
+                std::vector<std::string> getQuotientVariables() const;
+
+                /*!
+                 * Retrieves whether the reachable states are to be stored tree-compressed during exploration.
+                 */
+                bool isTreeCompressionSet() const;
+
+                /*!
+                 * Retrieves whether the transition matrix of memory products is to be built concurrently.
+                 */
+                bool isConcurrentProductSet() const;
+
+                /*!
+                 * Retrieves the number of threads used to build the transition matrix of memory products. If the user did
+                 * not specify a number, the number of hardware threads is returned.
+                 */
+                uint64_t getNumberOfConcurrentProductThreads() const;
+
+                /*!
+                 * Retrieves the number of threads that are actually used to build the transition matrix of memory
+                 * products, i.e., one if the product is not to be built concurrently.
+                 */
+                uint64_t getNumberOfProductThreads() const;
+
+                /*!
+                 * Overrides the option to build the transition matrix of memory products concurrently by setting it to
+                 * the specified value. As soon as the returned memento goes out of scope, the original value is restored.
+                 *
+                 * @param stateToSet The value that is to be set for the option.
+                 * @return The memento that will eventually restore the original value.
+                 */
+                std::unique_ptr<storm::settings::SettingMemento> overrideConcurrentProductSet(bool stateToSet);
+
+                /*!
+                 * Sets the number of threads used to build the transition matrix of memory products.
+                 *
+                 * @param value The new number of threads (0 means as many as there are hardware threads).
+                 */
+                void setNumberOfConcurrentProductThreads(uint64_t value);
+
 
                 // The name of the module.
                 static const std::string moduleName;
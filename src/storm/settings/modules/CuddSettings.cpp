@@ -17,6 +17,7 @@ namespace storm {
             const std::string CuddSettings::moduleName = "cudd";
             const std::string CuddSettings::precisionOptionName = "precision";
             const std::string CuddSettings::maximalMemoryOptionName = "maxmem";
+            const std::string CuddSettings::adaptiveMemoryOptionName = "adaptivemem";
             const std::string CuddSettings::reorderOptionName = "dynreorder";
             const std::string CuddSettings::reorderTechniqueOptionName = "reordertechnique";
             
@@ -24,6 +25,8 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, precisionOptionName, true, "Sets the precision used by Cudd.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The precision up to which to constants are considered to be different.").setDefaultValueDouble(1e-15).addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorIncluding(0.0, 1.0)).build()).build());
                 
                 this->addOption(storm::settings::OptionBuilder(moduleName, maximalMemoryOptionName, true, "Sets the upper bound of memory available to Cudd in MB.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The memory available to Cudd (0 means unlimited).").setDefaultValueUnsignedInteger(4096).build()).build());
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, adaptiveMemoryOptionName, true, "If set, the sizes up to which the unique table grows without garbage collection and up to which the computed table grows are derived from the memory bound.").setIsAdvanced().build());
 
                 this->addOption(storm::settings::OptionBuilder(moduleName, reorderOptionName, false, "Sets whether dynamic reordering is allowed.").setIsAdvanced().build());
                 
@@ -57,6 +60,10 @@ namespace storm {
                 return this->getOption(maximalMemoryOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
             }
             
+            bool CuddSettings::isAdaptiveMemorySet() const {
+                return this->getOption(adaptiveMemoryOptionName).getHasOptionBeenSet();
+            }
+            
             bool CuddSettings::isReorderingEnabled() const {
                 return this->getOption(reorderOptionName).getHasOptionBeenSet();
             }
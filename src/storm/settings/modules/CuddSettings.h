@@ -34,6 +34,14 @@ namespace storm {
                  */
                 uint_fast64_t getMaximalMemory() const;
                 
+                /*!
+                 * Retrieves whether the growth of the unique table and the computed table is to be tied to the
+                 * maximal amount of memory rather than to the memory available to the process.
+                 *
+                 * @return True iff the adaptive memory mode is enabled.
+                 */
+                bool isAdaptiveMemorySet() const;
+                
                 /*!
                  * Retrieves whether dynamic reordering is enabled.
                  *
@@ -55,6 +63,7 @@ namespace storm {
                 // Define the string names of the options as constants.
                 static const std::string precisionOptionName;
                 static const std::string maximalMemoryOptionName;
+                static const std::string adaptiveMemoryOptionName;
                 static const std::string reorderOptionName;
                 static const std::string reorderTechniqueOptionName;
             };
@@ -61,6 +61,23 @@ namespace storm {
                  * @return True iff the option was set.
                  */
                 bool isUseDedicatedModelCheckerSet() const;
+                
+                /*!
+                 * Retrieves whether reachability probabilities are to be computed as a straight-line program that is
+                 * only converted to a value at the end.
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool isUseStraightLineProgramSet() const;
+                
+                /*!
+                 * Overrides the option to record reachability probabilities as a straight-line program by setting it to
+                 * the specified value. As soon as the returned memento goes out of scope, the original value is restored.
+                 *
+                 * @param stateToSet The value that is to be set for the option.
+                 * @return The memento that will eventually restore the original value.
+                 */
+                std::unique_ptr<storm::settings::SettingMemento> overrideUseStraightLineProgramSet(bool stateToSet);
 				
                 const static std::string moduleName;
                 
@@ -70,6 +87,7 @@ namespace storm {
                 const static std::string entryStatesLastOptionName;
                 const static std::string maximalSccSizeOptionName;
                 const static std::string useDedicatedModelCheckerOptionName;
+                const static std::string useStraightLineProgramOptionName;
             };
             
         } // namespace modules
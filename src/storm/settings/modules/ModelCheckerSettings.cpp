@@ -7,6 +7,8 @@
 #include "storm/settings/ArgumentBuilder.h"
 #include "storm/settings/Argument.h"
 
+#include "storm/utility/parallel.h"
+
 
 namespace storm {
     namespace settings {
@@ -14,15 +16,45 @@ namespace storm {
             
             const std::string ModelCheckerSettings::moduleName = "modelchecker";
             const std::string ModelCheckerSettings::filterRewZeroOptionName = "filterrewzero";
+            const std::string ModelCheckerSettings::concurrentPropertiesOptionName = "concurrent-properties";
+            const std::string ModelCheckerSettings::concurrentQuantileSubQueriesOptionName = "concurrent-quantile-subqueries";
 
             ModelCheckerSettings::ModelCheckerSettings() : ModuleSettings(moduleName) {
                 this->addOption(storm::settings::OptionBuilder(moduleName, filterRewZeroOptionName, false, "If set, states with reward zero are filtered out, potentially reducing the size of the equation system").setIsAdvanced().build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, concurrentPropertiesOptionName, false, "If set, independent properties are checked concurrently on the same model (sparse engine only). Results are printed in the original order.").setIsAdvanced()
+                                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("threads", "The number of threads (0 means 'auto-detect').").setDefaultValueUnsignedInteger(0).makeOptional().build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, concurrentQuantileSubQueriesOptionName, false, "If set, the independent sub-queries of multi-dimensional quantile queries are computed concurrently.").setIsAdvanced()
+                                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("threads", "The number of threads (0 means 'auto-detect').").setDefaultValueUnsignedInteger(0).makeOptional().build()).build());
             }
             
             bool ModelCheckerSettings::isFilterRewZeroSet() const {
                 return this->getOption(filterRewZeroOptionName).getHasOptionBeenSet();
             }
             
+            bool ModelCheckerSettings::isConcurrentPropertiesSet() const {
+                return this->getOption(concurrentPropertiesOptionName).getHasOptionBeenSet();
+            }
+            
+            uint64_t ModelCheckerSettings::getNumberOfConcurrentPropertyThreads() const {
+                return storm::utility::parallel::resolveNumberOfThreads(this->getOption(concurrentPropertiesOptionName).getArgumentByName("threads").getValueAsUnsignedInteger());
+            }
+            
+            bool ModelCheckerSettings::isConcurrentQuantileSubQueriesSet() const {
+                return this->getOption(concurrentQuantileSubQueriesOptionName).getHasOptionBeenSet();
+            }
+            
+            uint64_t ModelCheckerSettings::getNumberOfConcurrentQuantileSubQueryThreads() const {
+                return storm::utility::parallel::resolveNumberOfThreads(this->getOption(concurrentQuantileSubQueriesOptionName).getArgumentByName("threads").getValueAsUnsignedInteger());
+            }
+            
+            std::unique_ptr<storm::settings::SettingMemento> ModelCheckerSettings::overrideConcurrentQuantileSubQueriesSet(bool stateToSet) {
+                return this->overrideOption(concurrentQuantileSubQueriesOptionName, stateToSet);
+            }
+            
+            void ModelCheckerSettings::setNumberOfConcurrentQuantileSubQueryThreads(uint64_t value) {
+                this->getOption(concurrentQuantileSubQueriesOptionName).getArgumentByName("threads").setFromStringValue(std::to_string(value));
+            }
+            
         } // namespace modules
     } // namespace settings
 } // namespace storm
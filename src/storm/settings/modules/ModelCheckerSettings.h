@@ -21,6 +21,44 @@ namespace storm {
                 ModelCheckerSettings();
                 
                 bool isFilterRewZeroSet() const;
+                
+                /*!
+                 * Retrieves whether independent properties are to be checked concurrently.
+                 */
+                bool isConcurrentPropertiesSet() const;
+                
+                /*!
+                 * Retrieves the number of threads used to check properties concurrently. If the user did not specify a
+                 * number, the number of hardware threads is returned.
+                 */
+                uint64_t getNumberOfConcurrentPropertyThreads() const;
+                
+                /*!
+                 * Retrieves whether the independent sub-queries of a quantile query are to be computed concurrently.
+                 */
+                bool isConcurrentQuantileSubQueriesSet() const;
+                
+                /*!
+                 * Retrieves the number of threads used to compute the sub-queries of a quantile query. If the user did
+                 * not specify a number, the number of hardware threads is returned.
+                 */
+                uint64_t getNumberOfConcurrentQuantileSubQueryThreads() const;
+                
+                /*!
+                 * Overrides the option to compute the sub-queries of quantile queries concurrently by setting it to the
+                 * specified value. As soon as the returned memento goes out of scope, the original value is restored.
+                 *
+                 * @param stateToSet The value that is to be set for the option.
+                 * @return The memento that will eventually restore the original value.
+                 */
+                std::unique_ptr<storm::settings::SettingMemento> overrideConcurrentQuantileSubQueriesSet(bool stateToSet);
+                
+                /*!
+                 * Sets the number of threads used to compute the sub-queries of quantile queries.
+                 *
+                 * @param value The new number of threads (0 means as many as there are hardware threads).
+                 */
+                void setNumberOfConcurrentQuantileSubQueryThreads(uint64_t value);
 
                 // The name of the module.
                 static const std::string moduleName;
@@ -28,6 +66,8 @@ namespace storm {
             private:
                 // Define the string names of the options as constants.
                 static const std::string filterRewZeroOptionName;
+                static const std::string concurrentPropertiesOptionName;
+                static const std::string concurrentQuantileSubQueriesOptionName;
             };
 
         } // namespace modules
@@ -14,10 +14,12 @@ namespace storm {
             const std::string SylvanSettings::moduleName = "sylvan";
             const std::string SylvanSettings::maximalMemoryOptionName = "maxmem";
             const std::string SylvanSettings::threadCountOptionName = "threads";
+            const std::string SylvanSettings::adaptiveMemoryOptionName = "adaptivemem";
             
             SylvanSettings::SylvanSettings() : ModuleSettings(moduleName) {
                 this->addOption(storm::settings::OptionBuilder(moduleName, maximalMemoryOptionName, true, "Sets the upper bound of memory available to Sylvan in MB.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The memory available to Sylvan.").setDefaultValueUnsignedInteger(4096).build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, threadCountOptionName, true, "Sets the number of threads used by Sylvan.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The number of threads available to Sylvan (0 means 'auto-detect').").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, adaptiveMemoryOptionName, true, "If set, the node table and the operation cache start small and are only enlarged (up to the memory bound) if garbage collection leaves more than half of the table occupied.").setIsAdvanced().build());
             }
             
             uint_fast64_t SylvanSettings::getMaximalMemory() const {
@@ -28,6 +30,10 @@ namespace storm {
                 return this->getOption(threadCountOptionName).getArgumentByName("value").getHasBeenSet();
             }
             
+            bool SylvanSettings::isAdaptiveMemorySet() const {
+                return this->getOption(adaptiveMemoryOptionName).getHasOptionBeenSet();
+            }
+            
             uint_fast64_t SylvanSettings::getNumberOfThreads() const {
                 return this->getOption(threadCountOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
             }
@@ -37,6 +37,12 @@ namespace storm {
                  */
                 bool isNumberOfThreadsSet() const;
                 
+                /*!
+                 * Retrieves whether the tables of Sylvan are to start small and only grow (up to the maximal memory)
+                 * if garbage collection does not free enough space.
+                 */
+                bool isAdaptiveMemorySet() const;
+                
                 // The name of the module.
                 static const std::string moduleName;
                 
@@ -44,6 +50,7 @@ namespace storm {
                 // Define the string names of the options as constants.
                 static const std::string maximalMemoryOptionName;
                 static const std::string threadCountOptionName;
+                static const std::string adaptiveMemoryOptionName;
             };
             
         } // namespace modules
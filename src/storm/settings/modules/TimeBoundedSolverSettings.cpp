@@ -13,20 +13,27 @@ namespace storm {
             const std::string TimeBoundedSolverSettings::moduleName = "timebounded";
             
             const std::string TimeBoundedSolverSettings::maMethodOptionName = "mamethod";
+            const std::string TimeBoundedSolverSettings::ctmcMethodOptionName = "ctmcmethod";
             const std::string TimeBoundedSolverSettings::precisionOptionName = "precision";
             const std::string TimeBoundedSolverSettings::absoluteOptionName = "absolute";
             const std::string TimeBoundedSolverSettings::unifPlusKappaOptionName = "kappa";
+            const std::string TimeBoundedSolverSettings::steadyStateDetectionOptionName = "ssd";
             
             TimeBoundedSolverSettings::TimeBoundedSolverSettings() : ModuleSettings(moduleName) {
                 std::vector<std::string> maMethods = {"imca", "unifplus"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, maMethodOptionName, false, "The method to use to solve bounded reachability queries on MAs.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the method to use.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(maMethods)).setDefaultValueString("unifplus").build()).build());
                 
+                std::vector<std::string> ctmcMethods = {"uniformization", "krylov"};
+                this->addOption(storm::settings::OptionBuilder(moduleName, ctmcMethodOptionName, false, "The method to use for the transient analysis of CTMCs.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the method to use.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(ctmcMethods)).setDefaultValueString("uniformization").build()).build());
+                
                 this->addOption(storm::settings::OptionBuilder(moduleName, precisionOptionName, false, "The precision used for detecting convergence of iterative methods.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The precision to achieve.").setDefaultValueDouble(1e-06).addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0)).build()).build());
 
                 this->addOption(storm::settings::OptionBuilder(moduleName, absoluteOptionName, false, "Sets whether the relative or the absolute error is considered for detecting convergence.").setIsAdvanced().build());
 
                 this->addOption(storm::settings::OptionBuilder(moduleName, unifPlusKappaOptionName, false, "Controls which amount of the approximation error is due to truncation.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("kappa", "The factor").setDefaultValueDouble(0.05).addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0)).build()).build());
                 
+                this->addOption(storm::settings::OptionBuilder(moduleName, steadyStateDetectionOptionName, false, "If set, the transient analysis of CTMCs stops as soon as the remaining iterations provably cannot change the result by more than the precision (speeds up stiff models).").setIsAdvanced().build());
+                
             }
             
             bool TimeBoundedSolverSettings::isPrecisionSet() const {
@@ -49,6 +56,14 @@ namespace storm {
                 return storm::solver::MaBoundedReachabilityMethod::UnifPlus;
             }
             
+            storm::solver::CtmcTransientMethod TimeBoundedSolverSettings::getCtmcMethod() const {
+                std::string techniqueAsString = this->getOption(ctmcMethodOptionName).getArgumentByName("name").getValueAsString();
+                if (techniqueAsString == "krylov") {
+                    return storm::solver::CtmcTransientMethod::Krylov;
+                }
+                return storm::solver::CtmcTransientMethod::Uniformization;
+            }
+            
             bool TimeBoundedSolverSettings::isMaMethodSetFromDefaultValue() const {
                 return !this->getOption(maMethodOptionName).getArgumentByName("name").getHasBeenSet() || this->getOption(maMethodOptionName).getArgumentByName("name").wasSetFromDefaultValue();
             }
@@ -56,6 +71,10 @@ namespace storm {
             double TimeBoundedSolverSettings::getUnifPlusKappa() const {
                 return this->getOption(unifPlusKappaOptionName).getArgumentByName("kappa").getValueAsDouble();
             }
+            
+            bool TimeBoundedSolverSettings::isSteadyStateDetectionSet() const {
+                return this->getOption(steadyStateDetectionOptionName).getHasOptionBeenSet();
+            }
 
         }
     }
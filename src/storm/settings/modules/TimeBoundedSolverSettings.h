@@ -27,6 +27,11 @@ namespace storm {
                  */
                 storm::solver::MaBoundedReachabilityMethod getMaMethod() const;
                 
+                /*!
+                 * Retrieves the selected technique for the transient analysis of CTMCs.
+                 */
+                storm::solver::CtmcTransientMethod getCtmcMethod() const;
+                
                 /*!
                  * Retrieves whether the precision has been set.
                  *
@@ -51,14 +56,22 @@ namespace storm {
                  */
                 double getUnifPlusKappa() const;
                 
+                /*!
+                 * Retrieves whether the uniformization of CTMCs is supposed to stop as soon as the remaining iterations
+                 * cannot change the result by more than the precision.
+                 */
+                bool isSteadyStateDetectionSet() const;
+                
                 // The name of the module.
                 static const std::string moduleName;
                 
             private:
                 static const std::string maMethodOptionName;
+                static const std::string ctmcMethodOptionName;
                 static const std::string precisionOptionName;
                 static const std::string absoluteOptionName;
                 static const std::string unifPlusKappaOptionName;
+                static const std::string steadyStateDetectionOptionName;
             };
             
         }
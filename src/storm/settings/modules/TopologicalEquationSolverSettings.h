@@ -61,6 +61,13 @@ namespace storm {
                  */
                 storm::solver::MinMaxMethod getUnderlyingMinMaxMethod() const;
                 
+                /*!
+                 * Retrieves the maximal size of (non-trivial) SCCs that are solved directly instead of using the underlying solver.
+                 *
+                 * @return The maximal size of directly solved SCCs (0 if no SCC is to be solved directly).
+                 */
+                uint64_t getDirectSccSize() const;
+                
                 bool check() const override;
                 
                 // The name of the module.
@@ -70,6 +77,7 @@ namespace storm {
                 // Define the string names of the options as constants.
                 static const std::string underlyingEquationSolverOptionName;
                 static const std::string underlyingMinMaxMethodOptionName;
+                static const std::string directSccSizeOptionName;
             };
             
         } // namespace modules
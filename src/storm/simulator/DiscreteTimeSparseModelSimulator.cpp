@@ -71,7 +71,13 @@ namespace storm {
 
         template<typename ValueType, typename RewardModelType>
         bool DiscreteTimeSparseModelSimulator<ValueType,RewardModelType>::resetToInitial() {
-            currentState = *model.getInitialStates().begin();
+            return resetToState(*model.getInitialStates().begin());
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        bool DiscreteTimeSparseModelSimulator<ValueType,RewardModelType>::resetToState(uint64_t state) {
+            STORM_LOG_ASSERT(state < model.getNumberOfStates(), "Invalid state " << state << ".");
+            currentState = state;
             lastRewards = zeroRewards;
             uint64_t i = 0;
             for (auto const& rewModPair : model.getRewardModels()) {
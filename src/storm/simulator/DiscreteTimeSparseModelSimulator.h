@@ -23,6 +23,7 @@ namespace storm {
             std::vector<ValueType> const& getLastRewards() const;
             uint64_t getCurrentState() const;
             bool resetToInitial();
+            bool resetToState(uint64_t state);
         protected:
             storm::models::sparse::Model<ValueType, RewardModelType> const& model;
             uint64_t currentState;
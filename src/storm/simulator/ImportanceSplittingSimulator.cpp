@@ -0,0 +1,200 @@
+#include "storm/simulator/ImportanceSplittingSimulator.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <future>
+
+#include <boost/math/distributions/normal.hpp>
+
+#include "storm/simulator/DiscreteTimeSparseModelSimulator.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace simulator {
+
+        template<typename ValueType, typename RewardModelType>
+        ImportanceSplittingSimulator<ValueType, RewardModelType>::ImportanceSplittingSimulator(storm::models::sparse::Model<ValueType, RewardModelType> const& model, storm::storage::BitVector const& targetStates) : model(model), targetStates(targetStates), relevantStates(targetStates), distances(model.getNumberOfStates(), 0), targetLevel(1), effortPerLevel(1000), numberOfRuns(10), maximalPathLength(10000), numberOfThreads(1), seed(0) {
+            STORM_LOG_THROW(targetStates.size() == model.getNumberOfStates(), storm::exceptions::InvalidArgumentException, "The set of target states does not match the number of states of the model.");
+            STORM_LOG_WARN_COND(model.getInitialStates().getNumberOfSetBits() == 1, "The model has multiple initial states. The estimation starts from the initial state with the lowest index.");
+
+            // Compute the graph distance to the target states by a backward breadth-first search.
+            storm::storage::SparseMatrix<ValueType> backwardTransitions = model.getBackwardTransitions();
+            std::vector<uint64_t> queue;
+            for (auto state : targetStates) {
+                queue.push_back(state);
+            }
+            for (uint64_t position = 0; position < queue.size(); ++position) {
+                uint64_t state = queue[position];
+                for (auto const& entry : backwardTransitions.getRow(state)) {
+                    if (!storm::utility::isZero(entry.getValue()) && !relevantStates.get(entry.getColumn())) {
+                        relevantStates.set(entry.getColumn());
+                        distances[entry.getColumn()] = distances[state] + 1;
+                        queue.push_back(entry.getColumn());
+                    }
+                }
+            }
+            computeDistanceBasedImportance();
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        void ImportanceSplittingSimulator<ValueType, RewardModelType>::computeDistanceBasedImportance() {
+            uint64_t maximalDistance = 0;
+            for (auto state : relevantStates) {
+                maximalDistance = std::max(maximalDistance, distances[state]);
+            }
+            std::vector<uint64_t> distanceBasedImportance(model.getNumberOfStates(), 0);
+            for (auto state : relevantStates) {
+                distanceBasedImportance[state] = maximalDistance - distances[state];
+            }
+            setImportanceFunction(distanceBasedImportance);
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        void ImportanceSplittingSimulator<ValueType, RewardModelType>::setImportanceFunction(std::vector<uint64_t> const& importance) {
+            STORM_LOG_THROW(importance.size() == model.getNumberOfStates(), storm::exceptions::InvalidArgumentException, "The importance function does not match the number of states of the model.");
+            this->importance = importance;
+            targetLevel = 1;
+            for (uint64_t state = 0; state < importance.size(); ++state) {
+                if (!targetStates.get(state)) {
+                    targetLevel = std::max(targetLevel, importance[state] + 1);
+                }
+            }
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        std::vector<uint64_t> const& ImportanceSplittingSimulator<ValueType, RewardModelType>::getImportanceFunction() const {
+            return importance;
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        void ImportanceSplittingSimulator<ValueType, RewardModelType>::setEffortPerLevel(uint64_t effort) {
+            STORM_LOG_THROW(effort > 0, storm::exceptions::InvalidArgumentException, "The effort per level must be positive.");
+            effortPerLevel = effort;
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        void ImportanceSplittingSimulator<ValueType, RewardModelType>::setNumberOfRuns(uint64_t runs) {
+            STORM_LOG_THROW(runs > 0, storm::exceptions::InvalidArgumentException, "The number of runs must be positive.");
+            numberOfRuns = runs;
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        void ImportanceSplittingSimulator<ValueType, RewardModelType>::setMaximalPathLength(uint64_t length) {
+            maximalPathLength = length;
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        void ImportanceSplittingSimulator<ValueType, RewardModelType>::setNumberOfThreads(uint64_t threads) {
+            numberOfThreads = threads;
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        void ImportanceSplittingSimulator<ValueType, RewardModelType>::setSeed(uint64_t seed) {
+            this->seed = seed;
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        double ImportanceSplittingSimulator<ValueType, RewardModelType>::performRun(uint64_t runSeed) const {
+            auto getLevel = [this] (uint64_t state) { return targetStates.get(state) ? targetLevel : importance[state]; };
+
+            uint64_t initialState = *model.getInitialStates().begin();
+            if (targetStates.get(initialState)) {
+                return 1.0;
+            } else if (!relevantStates.get(initialState)) {
+                return 0.0;
+            }
+
+            DiscreteTimeSparseModelSimulator<ValueType, RewardModelType> simulator(model);
+            simulator.setSeed(runSeed);
+            // A separate generator selects the states the trajectories start from.
+            storm::utility::RandomProbabilityGenerator<double> entryGenerator(~runSeed);
+
+            double estimate = 1.0;
+            std::vector<uint64_t> entryStates = {initialState};
+            std::vector<uint64_t> hits;
+            uint64_t level = getLevel(initialState) + 1;
+            while (level <= targetLevel) {
+                hits.clear();
+                for (uint64_t trajectory = 0; trajectory < effortPerLevel; ++trajectory) {
+                    uint64_t state = entryStates[entryGenerator.random_uint(0, entryStates.size() - 1)];
+                    simulator.resetToState(state);
+                    bool reachedLevel = getLevel(state) >= level;
+                    for (uint64_t step = 0; !reachedLevel && step < maximalPathLength; ++step) {
+                        if (!simulator.randomStep()) {
+                            break;
+                        }
+                        state = simulator.getCurrentState();
+                        if (!relevantStates.get(state)) {
+                            // The target can no longer be reached.
+                            break;
+                        }
+                        reachedLevel = getLevel(state) >= level;
+                    }
+                    if (reachedLevel) {
+                        hits.push_back(state);
+                    }
+                }
+                if (hits.empty()) {
+                    return 0.0;
+                }
+                estimate *= static_cast<double>(hits.size()) / static_cast<double>(effortPerLevel);
+
+                // Levels that every hit already passed are skipped, as their conditional probability is one.
+                level = targetLevel + 1;
+                for (auto const& hit : hits) {
+                    level = std::min(level, getLevel(hit) + 1);
+                }
+                std::swap(entryStates, hits);
+            }
+            return estimate;
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        RareEventEstimate ImportanceSplittingSimulator<ValueType, RewardModelType>::estimateReachabilityProbability(double confidenceLevel) const {
+            STORM_LOG_THROW(confidenceLevel > 0.0 && confidenceLevel < 1.0, storm::exceptions::InvalidArgumentException, "The confidence level must be in (0,1).");
+
+            // Execute the independent runs concurrently. Each run has its own seed, so the result does not depend on the number of threads.
+            std::vector<double> estimates(numberOfRuns);
+            std::atomic<uint64_t> nextRun(0);
+            auto executeRuns = [this, &estimates, &nextRun] () {
+                for (uint64_t run = nextRun++; run < numberOfRuns; run = nextRun++) {
+                    estimates[run] = performRun(seed + run);
+                }
+            };
+            uint64_t threads = std::min(storm::utility::parallel::resolveNumberOfThreads(numberOfThreads), numberOfRuns);
+            std::vector<std::future<void>> futures;
+            for (uint64_t thread = 1; thread < threads; ++thread) {
+                futures.push_back(std::async(std::launch::async, executeRuns));
+            }
+            executeRuns();
+            for (auto& future : futures) {
+                future.get();
+            }
+
+            RareEventEstimate result;
+            result.confidenceLevel = confidenceLevel;
+            result.numberOfRuns = numberOfRuns;
+            double sum = 0.0;
+            for (auto const& estimate : estimates) {
+                sum += estimate;
+            }
+            result.estimate = sum / numberOfRuns;
+            double squaredDeviations = 0.0;
+            for (auto const& estimate : estimates) {
+                squaredDeviations += (estimate - result.estimate) * (estimate - result.estimate);
+            }
+            result.standardError = numberOfRuns > 1 ? std::sqrt(squaredDeviations / (numberOfRuns - 1) / numberOfRuns) : 0.0;
+            double halfWidth = boost::math::quantile(boost::math::normal_distribution<double>(), (1.0 + confidenceLevel) / 2.0) * result.standardError;
+            result.lowerBound = std::max(0.0, result.estimate - halfWidth);
+            result.upperBound = std::min(1.0, result.estimate + halfWidth);
+            STORM_LOG_INFO("Importance splitting estimated probability " << result.estimate << " with " << confidenceLevel * 100 << "% confidence interval [" << result.lowerBound << ", " << result.upperBound << "] from " << numberOfRuns << " runs.");
+            return result;
+        }
+
+        template class ImportanceSplittingSimulator<double>;
+    }
+}
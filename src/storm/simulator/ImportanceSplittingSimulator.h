@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/models/sparse/Model.h"
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+    namespace simulator {
+
+        /**
+         * The result of a rare-event estimation: the mean of the estimates of the independent runs together with a
+         * (normal) confidence interval for the estimated probability.
+         */
+        struct RareEventEstimate {
+            double estimate;
+            double standardError;
+            double lowerBound;
+            double upperBound;
+            double confidenceLevel;
+            uint64_t numberOfRuns;
+        };
+
+        /**
+         * This class estimates (rare) probabilities to reach a set of target states via fixed-effort importance splitting.
+         * The states are partitioned into levels according to an importance function. In every run, a fixed number of
+         * trajectories is started from the states that entered the previous level; the fraction of trajectories that
+         * reach the next level estimates the conditional probability of doing so. The product of these fractions is an
+         * unbiased estimate of the reachability probability.
+         *
+         * If no importance function is given, it is derived from the graph distance to the target states. Nondeterminism
+         * is resolved uniformly at random as in DiscreteTimeSparseModelSimulator::randomStep.
+         */
+        template<typename ValueType, typename RewardModelType = storm::models::sparse::StandardRewardModel<ValueType>>
+        class ImportanceSplittingSimulator {
+        public:
+            ImportanceSplittingSimulator(storm::models::sparse::Model<ValueType, RewardModelType> const& model, storm::storage::BitVector const& targetStates);
+
+            /*!
+             * Sets the importance of each state. States with a higher importance are assumed to be closer to the target.
+             * Target states are always put in the highest level.
+             */
+            void setImportanceFunction(std::vector<uint64_t> const& importance);
+            std::vector<uint64_t> const& getImportanceFunction() const;
+
+            /*!
+             * Sets the number of trajectories that are started on each level.
+             */
+            void setEffortPerLevel(uint64_t effort);
+
+            /*!
+             * Sets the number of independent runs that the confidence interval is computed from.
+             */
+            void setNumberOfRuns(uint64_t runs);
+
+            /*!
+             * Sets the number of steps after which a trajectory that did not reach the next level is abandoned.
+             */
+            void setMaximalPathLength(uint64_t length);
+
+            /*!
+             * Sets the number of threads executing the runs (0 means one per available core).
+             */
+            void setNumberOfThreads(uint64_t threads);
+
+            void setSeed(uint64_t seed);
+
+            /*!
+             * Estimates the probability to reach a target state from the initial state.
+             *
+             * @param confidenceLevel The confidence level of the reported interval.
+             */
+            RareEventEstimate estimateReachabilityProbability(double confidenceLevel = 0.95) const;
+
+        private:
+            /*!
+             * Sets the importance of each state to the maximal distance of any state to the target minus its own distance.
+             */
+            void computeDistanceBasedImportance();
+
+            /*!
+             * Performs a single run of fixed-effort splitting and returns its estimate.
+             */
+            double performRun(uint64_t seed) const;
+
+            storm::models::sparse::Model<ValueType, RewardModelType> const& model;
+            storm::storage::BitVector targetStates;
+
+            // The states from which the target is reachable. Trajectories leaving these states are abandoned.
+            storm::storage::BitVector relevantStates;
+
+            // The graph distance of each relevant state to the target states.
+            std::vector<uint64_t> distances;
+
+            std::vector<uint64_t> importance;
+
+            // The level of the target states (all other states have a lower level).
+            uint64_t targetLevel;
+
+            uint64_t effortPerLevel;
+            uint64_t numberOfRuns;
+            uint64_t maximalPathLength;
+            uint64_t numberOfThreads;
+            uint64_t seed;
+        };
+    }
+}
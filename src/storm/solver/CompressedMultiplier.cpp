@@ -0,0 +1,151 @@
+#include "storm/solver/CompressedMultiplier.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace solver {
+
+        template<typename ValueType>
+        CompressedMultiplier<ValueType>::CompressedMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix, storm::storage::CompressedSparseMatrix<ValueType>&& compressedMatrix) : Multiplier<ValueType>(matrix), compressedMatrix(std::move(compressedMatrix)) {
+            STORM_LOG_INFO("Compressed the matrix with " << this->compressedMatrix.getEntryCount() << " entries (" << this->compressedMatrix.getNumberOfDistinctValues() << " distinct values) to " << this->compressedMatrix.getSizeInMemory() << " bytes.");
+        }
+
+        template<typename ValueType>
+        storm::storage::CompressedSparseMatrix<ValueType> const& CompressedMultiplier<ValueType>::getCompressedMatrix() const {
+            return compressedMatrix;
+        }
+
+        template<typename ValueType>
+        void CompressedMultiplier<ValueType>::multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+            std::vector<ValueType>* target = &result;
+            if (&x == &result) {
+                if (this->cachedVector) {
+                    this->cachedVector->resize(x.size());
+                } else {
+                    this->cachedVector = std::make_unique<std::vector<ValueType>>(x.size());
+                }
+                target = this->cachedVector.get();
+            }
+            multAdd(x, b, *target, false);
+            if (&x == &result) {
+                std::swap(result, *this->cachedVector);
+            }
+        }
+
+        template<typename ValueType>
+        void CompressedMultiplier<ValueType>::multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, bool backwards) const {
+            multAdd(x, b, x, backwards);
+        }
+
+        template<typename ValueType>
+        void CompressedMultiplier<ValueType>::multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            std::vector<ValueType>* target = &result;
+            if (&x == &result) {
+                if (this->cachedVector) {
+                    this->cachedVector->resize(x.size());
+                } else {
+                    this->cachedVector = std::make_unique<std::vector<ValueType>>(x.size());
+                }
+                target = this->cachedVector.get();
+            }
+            if (dir == OptimizationDirection::Minimize) {
+                multAddReduce<storm::utility::ElementLess<ValueType>>(rowGroupIndices, x, b, *target, choices, false);
+            } else {
+                multAddReduce<storm::utility::ElementGreater<ValueType>>(rowGroupIndices, x, b, *target, choices, false);
+            }
+            if (&x == &result) {
+                std::swap(result, *this->cachedVector);
+            }
+        }
+
+        template<typename ValueType>
+        void CompressedMultiplier<ValueType>::multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices, bool backwards) const {
+            if (dir == OptimizationDirection::Minimize) {
+                multAddReduce<storm::utility::ElementLess<ValueType>>(rowGroupIndices, x, b, x, choices, backwards);
+            } else {
+                multAddReduce<storm::utility::ElementGreater<ValueType>>(rowGroupIndices, x, b, x, choices, backwards);
+            }
+        }
+
+        template<typename ValueType>
+        void CompressedMultiplier<ValueType>::multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const {
+            value += compressedMatrix.multiplyRowWithVector(rowIndex, x);
+        }
+
+        template<typename ValueType>
+        bool CompressedMultiplier<ValueType>::hasOwnMatrixRepresentation() const {
+            return true;
+        }
+
+        template<typename ValueType>
+        storm::storage::SparseMatrix<ValueType> CompressedMultiplier<ValueType>::restoreMatrix() const {
+            return compressedMatrix.decompress();
+        }
+
+        template<typename ValueType>
+        std::vector<uint64_t> const& CompressedMultiplier<ValueType>::getRowGroupIndices() const {
+            return compressedMatrix.getRowGroupIndices();
+        }
+
+        template<typename ValueType>
+        void CompressedMultiplier<ValueType>::multAdd(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, bool backwards) const {
+            uint64_t rowCount = compressedMatrix.getRowCount();
+            for (uint64_t step = 0; step < rowCount; ++step) {
+                uint64_t row = backwards ? rowCount - 1 - step : step;
+                ValueType value = compressedMatrix.multiplyRowWithVector(row, x);
+                if (b) {
+                    value += (*b)[row];
+                }
+                result[row] = value;
+            }
+        }
+
+        template<typename ValueType>
+        template<typename Compare>
+        void CompressedMultiplier<ValueType>::multAddReduce(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices, bool backwards) const {
+            Compare compare;
+            uint64_t groupCount = rowGroupIndices.size() - 1;
+            for (uint64_t step = 0; step < groupCount; ++step) {
+                uint64_t group = backwards ? groupCount - 1 - step : step;
+                uint64_t groupStart = rowGroupIndices[group];
+                uint64_t groupEnd = rowGroupIndices[group + 1];
+
+                // Groups without rows get the value zero.
+                if (groupStart == groupEnd) {
+                    result[group] = storm::utility::zero<ValueType>();
+                    continue;
+                }
+
+                ValueType currentValue = compressedMatrix.multiplyRowWithVector(groupStart, x);
+                if (b) {
+                    currentValue += (*b)[groupStart];
+                }
+                uint64_t selectedChoice = 0;
+                ValueType oldSelectedChoiceValue = currentValue;
+                for (uint64_t row = groupStart + 1; row < groupEnd; ++row) {
+                    ValueType newValue = compressedMatrix.multiplyRowWithVector(row, x);
+                    if (b) {
+                        newValue += (*b)[row];
+                    }
+                    if (choices && row - groupStart == (*choices)[group]) {
+                        oldSelectedChoiceValue = newValue;
+                    }
+                    if (compare(newValue, currentValue)) {
+                        currentValue = newValue;
+                        selectedChoice = row - groupStart;
+                    }
+                }
+
+                result[group] = currentValue;
+                // Only change the choice if the new one is strictly better than the old one.
+                if (choices && compare(currentValue, oldSelectedChoiceValue)) {
+                    (*choices)[group] = selectedChoice;
+                }
+            }
+        }
+
+        template class CompressedMultiplier<double>;
+
+    }
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <vector>
+
+#include "storm/solver/Multiplier.h"
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/CompressedSparseMatrix.h"
+
+namespace storm {
+    namespace solver {
+
+        /*!
+         * A multiplier that operates on a compressed copy of the matrix (see CompressedSparseMatrix), i.e., the values
+         * are looked up in a dictionary and the columns are decoded on the fly. This reduces the number of bytes that
+         * need to be read in every sweep over the matrix. After construction, the original matrix is not accessed
+         * anymore, so its owner may release it and restore it from the multiplier if needed (see restoreMatrix).
+         * Currently, this is only supported for double values.
+         */
+        template<typename ValueType>
+        class CompressedMultiplier : public Multiplier<ValueType> {
+        public:
+            /*!
+             * Creates a multiplier for the given matrix using the given compressed copy of it.
+             */
+            CompressedMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix, storm::storage::CompressedSparseMatrix<ValueType>&& compressedMatrix);
+            virtual ~CompressedMultiplier() = default;
+
+            virtual void multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const override;
+            virtual void multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, bool backwards = true) const override;
+            virtual void multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices = nullptr) const override;
+            virtual void multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices = nullptr, bool backwards = true) const override;
+            virtual void multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const override;
+            virtual bool hasOwnMatrixRepresentation() const override;
+            virtual storm::storage::SparseMatrix<ValueType> restoreMatrix() const override;
+
+            /*!
+             * Retrieves the compressed matrix of this multiplier.
+             */
+            storm::storage::CompressedSparseMatrix<ValueType> const& getCompressedMatrix() const;
+
+        protected:
+            virtual std::vector<uint64_t> const& getRowGroupIndices() const override;
+
+        private:
+            void multAdd(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, bool backwards) const;
+
+            template<typename Compare>
+            void multAddReduce(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices, bool backwards) const;
+
+            // The compressed copy of the matrix.
+            storm::storage::CompressedSparseMatrix<ValueType> compressedMatrix;
+        };
+
+    }
+}
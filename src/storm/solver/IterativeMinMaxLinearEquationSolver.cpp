@@ -91,17 +91,37 @@ namespace storm {
             return result;
         }
 
+        template<typename ValueType>
+        storm::storage::SparseMatrix<ValueType> const& IterativeMinMaxLinearEquationSolver<ValueType>::getMatrix() const {
+            if (!this->A) {
+                STORM_LOG_ASSERT(this->multiplierA && this->multiplierA->hasOwnMatrixRepresentation(), "The matrix was released but can not be restored.");
+                STORM_LOG_INFO("Restoring the matrix from the representation held by the multiplier.");
+                this->localA = std::make_unique<storm::storage::SparseMatrix<ValueType>>(this->multiplierA->restoreMatrix());
+                this->A = this->localA.get();
+            }
+            return *this->A;
+        }
+
+        template<typename ValueType>
+        void IterativeMinMaxLinearEquationSolver<ValueType>::releaseMatrix() const {
+            if (this->localA && this->multiplierA && this->multiplierA->hasOwnMatrixRepresentation()) {
+                STORM_LOG_INFO("Releasing the matrix as the multiplier holds its own representation of it.");
+                this->localA.reset();
+                this->A = nullptr;
+            }
+        }
+
         template<typename ValueType>
         bool IterativeMinMaxLinearEquationSolver<ValueType>::solveInducedEquationSystem(Environment const& env, std::unique_ptr<LinearEquationSolver<ValueType>>& linearEquationSolver, std::vector<uint64_t> const& scheduler, std::vector<ValueType>& x, std::vector<ValueType>& subB, std::vector<ValueType> const& originalB) const {
             assert(subB.size() == x.size());
             
             // Resolve the nondeterminism according to the given scheduler.
             bool convertToEquationSystem = this->linearEquationSolverFactory->getEquationProblemFormat(env) == LinearEquationSolverProblemFormat::EquationSystem;
-            storm::storage::SparseMatrix<ValueType> submatrix = this->A->selectRowsFromRowGroups(scheduler, convertToEquationSystem);
+            storm::storage::SparseMatrix<ValueType> submatrix = this->getMatrix().selectRowsFromRowGroups(scheduler, convertToEquationSystem);
             if (convertToEquationSystem) {
                 submatrix.convertToEquationSystem();
             }
-            storm::utility::vector::selectVectorValues<ValueType>(subB, scheduler, this->A->getRowGroupIndices(), originalB);
+            storm::utility::vector::selectVectorValues<ValueType>(subB, scheduler, this->getMatrix().getRowGroupIndices(), originalB);
             
             // Check whether the linear equation solver is already initialized
             if (!linearEquationSolver) {
@@ -120,7 +140,7 @@ namespace storm {
         template<typename ValueType>
         bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsPolicyIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
             // Create the initial scheduler.
-            std::vector<storm::storage::sparse::state_type> scheduler = this->hasInitialScheduler() ? this->getInitialScheduler() : std::vector<storm::storage::sparse::state_type>(this->A->getRowGroupCount());
+            std::vector<storm::storage::sparse::state_type> scheduler = this->hasInitialScheduler() ? this->getInitialScheduler() : std::vector<storm::storage::sparse::state_type>(this->getMatrix().getRowGroupCount());
             return performPolicyIteration(env, dir, x, b, std::move(scheduler));
         }
         
@@ -129,7 +149,7 @@ namespace storm {
             std::vector<storm::storage::sparse::state_type> scheduler = std::move(initialPolicy);
             // Get a vector for storing the right-hand side of the inner equation system.
             if (!auxiliaryRowGroupVector) {
-                auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
+                auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->getMatrix().getRowGroupCount());
             }
             std::vector<ValueType>& subB = *auxiliaryRowGroupVector;
 
@@ -165,17 +185,17 @@ namespace storm {
                 
                 // Go through the multiplication result and see whether we can improve any of the choices.
                 bool schedulerImproved = false;
-                for (uint_fast64_t group = 0; group < this->A->getRowGroupCount(); ++group) {
+                for (uint_fast64_t group = 0; group < this->getMatrix().getRowGroupCount(); ++group) {
                     uint_fast64_t currentChoice = scheduler[group];
-                    for (uint_fast64_t choice = this->A->getRowGroupIndices()[group]; choice < this->A->getRowGroupIndices()[group + 1]; ++choice) {
+                    for (uint_fast64_t choice = this->getMatrix().getRowGroupIndices()[group]; choice < this->getMatrix().getRowGroupIndices()[group + 1]; ++choice) {
                         // If the choice is the currently selected one, we can skip it.
-                        if (choice - this->A->getRowGroupIndices()[group] == currentChoice) {
+                        if (choice - this->getMatrix().getRowGroupIndices()[group] == currentChoice) {
                             continue;
                         }
                         
                         // Create the value of the choice.
                         ValueType choiceValue = storm::utility::zero<ValueType>();
-                        for (auto const& entry : this->A->getRow(choice)) {
+                        for (auto const& entry : this->getMatrix().getRow(choice)) {
                             choiceValue += entry.getValue() * x[entry.getColumn()];
                         }
                         choiceValue += b[choice];
@@ -185,7 +205,7 @@ namespace storm {
                         // only changing the scheduler if the values are not equal (modulo precision) would make this unsound.
                         if (valueImproved(dir, x[group], choiceValue)) {
                             schedulerImproved = true;
-                            scheduler[group] = choice - this->A->getRowGroupIndices()[group];
+                            scheduler[group] = choice - this->getMatrix().getRowGroupIndices()[group];
                             x[group] = std::move(choiceValue);
                         }
                     }
@@ -369,13 +389,13 @@ namespace storm {
             }
             
             if (!auxiliaryRowGroupVector) {
-                auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
+                auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->getMatrix().getRowGroupCount());
             }
             if (!optimisticValueIterationHelper) {
-                optimisticValueIterationHelper = std::make_unique<storm::solver::helper::OptimisticValueIterationHelper<ValueType>>(*this->A);
+                optimisticValueIterationHelper = std::make_unique<storm::solver::helper::OptimisticValueIterationHelper<ValueType>>(this->getMatrix());
             }
 
-            storm::solver::helper::OptimisticValueIterationHelper<ValueType> helper(*this->A);
+            storm::solver::helper::OptimisticValueIterationHelper<ValueType> helper(this->getMatrix());
             
             // x has to start with a lower bound.
             this->createLowerBoundsVector(x);
@@ -397,8 +417,8 @@ namespace storm {
 
             // If requested, we store the scheduler for retrieval.
             if (this->isTrackSchedulerSet()) {
-                this->schedulerChoices = std::vector<uint_fast64_t>(this->A->getRowGroupCount());
-                this->A->multiplyAndReduce(dir, this->A->getRowGroupIndices(), x, &b, *auxiliaryRowGroupVector.get(), &this->schedulerChoices.get());
+                this->schedulerChoices = std::vector<uint_fast64_t>(this->getMatrix().getRowGroupCount());
+                this->getMatrix().multiplyAndReduce(dir, this->getMatrix().getRowGroupIndices(), x, &b, *auxiliaryRowGroupVector.get(), &this->schedulerChoices.get());
             }
 
             if (!this->isCachingEnabled()) {
@@ -411,11 +431,11 @@ namespace storm {
         template<typename ValueType>
         bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsValueIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
             if (!this->multiplierA) {
-                this->multiplierA = storm::solver::MultiplierFactory<ValueType>().create(env, *this->A);
+                this->multiplierA = storm::solver::MultiplierFactory<ValueType>().create(env, this->getMatrix());
             }
             
             if (!auxiliaryRowGroupVector) {
-                auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
+                auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(x.size());
             }
             
             // By default, we can not provide any guarantee
@@ -469,6 +489,9 @@ namespace storm {
 
             std::vector<ValueType>* newX = auxiliaryRowGroupVector.get();
             std::vector<ValueType>* currentX = &x;
+
+            // From now on, we only multiply with the matrix, so there is no need to keep the original matrix.
+            releaseMatrix();
             
             this->startMeasureProgress();
             ValueIterationResult result = performValueIteration(env, dir, currentX, newX, b, storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision()), env.solver().minMax().getRelativeTerminationCriterion(), guarantee, 0, env.solver().minMax().getMaximalNumberOfIterations(), env.solver().minMax().getMultiplicationStyle());
@@ -482,7 +505,7 @@ namespace storm {
             
             // If requested, we store the scheduler for retrieval.
             if (this->isTrackSchedulerSet()) {
-                this->schedulerChoices = std::vector<uint_fast64_t>(this->A->getRowGroupCount());
+                this->schedulerChoices = std::vector<uint_fast64_t>(x.size());
                 this->multiplierA->multiplyAndReduce(env, dir, x, &b, *auxiliaryRowGroupVector.get(), &this->schedulerChoices.get());
             }
             
@@ -509,19 +532,20 @@ namespace storm {
             STORM_LOG_THROW(this->hasUpperBound(), storm::exceptions::UnmetRequirementException, "Solver requires upper bound, but none was given.");
 
             if (!this->multiplierA) {
-                this->multiplierA = storm::solver::MultiplierFactory<ValueType>().create(env, *this->A);
+                this->multiplierA = storm::solver::MultiplierFactory<ValueType>().create(env, this->getMatrix());
             }
             
             if (!auxiliaryRowGroupVector) {
-                auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
+                auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(x.size());
             }
+            releaseMatrix();
             
             // Allow aliased multiplications.
             bool useGaussSeidelMultiplication = env.solver().minMax().getMultiplicationStyle() == storm::solver::MultiplicationStyle::GaussSeidel;
             
             std::vector<ValueType>* lowerX = &x;
             this->createLowerBoundsVector(*lowerX);
-            this->createUpperBoundsVector(this->auxiliaryRowGroupVector, this->A->getRowGroupCount());
+            this->createUpperBoundsVector(this->auxiliaryRowGroupVector, x.size());
             std::vector<ValueType>* upperX = this->auxiliaryRowGroupVector.get();
             
             std::vector<ValueType>* tmp = nullptr;
@@ -666,7 +690,7 @@ namespace storm {
             
             // If requested, we store the scheduler for retrieval.
             if (this->isTrackSchedulerSet()) {
-                this->schedulerChoices = std::vector<uint_fast64_t>(this->A->getRowGroupCount());
+                this->schedulerChoices = std::vector<uint_fast64_t>(x.size());
                 this->multiplierA->multiplyAndReduce(env, dir, x, &b, *this->auxiliaryRowGroupVector, &this->schedulerChoices.get());
             }
             
@@ -681,12 +705,12 @@ namespace storm {
         bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsSoundValueIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
 
             // Prepare the solution vectors and the helper.
-            assert(x.size() == this->A->getRowGroupCount());
+            assert(x.size() == this->getMatrix().getRowGroupCount());
             if (!this->auxiliaryRowGroupVector) {
                 this->auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>();
             }
             if (!this->soundValueIterationHelper) {
-                this->soundValueIterationHelper = std::make_unique<storm::solver::helper::SoundValueIterationHelper<ValueType>>(*this->A, x, *this->auxiliaryRowGroupVector, env.solver().minMax().getRelativeTerminationCriterion(), storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision()));
+                this->soundValueIterationHelper = std::make_unique<storm::solver::helper::SoundValueIterationHelper<ValueType>>(this->getMatrix(), x, *this->auxiliaryRowGroupVector, env.solver().minMax().getRelativeTerminationCriterion(), storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision()));
             } else {
                 this->soundValueIterationHelper = std::make_unique<storm::solver::helper::SoundValueIterationHelper<ValueType>>(std::move(*this->soundValueIterationHelper), x, *this->auxiliaryRowGroupVector, env.solver().minMax().getRelativeTerminationCriterion(), storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision()));
             }
@@ -724,8 +748,8 @@ namespace storm {
             
             // If requested, we store the scheduler for retrieval.
             if (this->isTrackSchedulerSet()) {
-                this->schedulerChoices = std::vector<uint_fast64_t>(this->A->getRowGroupCount());
-                this->A->multiplyAndReduce(dir, this->A->getRowGroupIndices(), x, &b, *this->auxiliaryRowGroupVector, &this->schedulerChoices.get());
+                this->schedulerChoices = std::vector<uint_fast64_t>(this->getMatrix().getRowGroupCount());
+                this->getMatrix().multiplyAndReduce(dir, this->getMatrix().getRowGroupIndices(), x, &b, *this->auxiliaryRowGroupVector, &this->schedulerChoices.get());
             }
 
             this->reportStatus(status, iterations);
@@ -744,7 +768,7 @@ namespace storm {
             {
                 Environment viEnv = env;
                 viEnv.solver().minMax().setMethod(MinMaxMethod::ValueIteration);
-                auto impreciseSolver = GeneralMinMaxLinearEquationSolverFactory<double>().create(viEnv, this->A->template toValueType<double>());
+                auto impreciseSolver = GeneralMinMaxLinearEquationSolverFactory<double>().create(viEnv, this->getMatrix().template toValueType<double>());
                 impreciseSolver->setHasUniqueSolution(this->hasUniqueSolution());
                 impreciseSolver->setTrackScheduler(true);
                 if (this->hasInitialScheduler()) {
@@ -814,20 +838,20 @@ namespace storm {
             // Version for when the overall value type is imprecise.
 
             // Create a rational representation of the input so we can check for a proper solution later.
-            storm::storage::SparseMatrix<storm::RationalNumber> rationalA = this->A->template toValueType<storm::RationalNumber>();
+            storm::storage::SparseMatrix<storm::RationalNumber> rationalA = this->getMatrix().template toValueType<storm::RationalNumber>();
             std::vector<storm::RationalNumber> rationalX(x.size());
             std::vector<storm::RationalNumber> rationalB = storm::utility::vector::convertNumericVector<storm::RationalNumber>(b);
             
             if (!this->multiplierA) {
-                this->multiplierA = storm::solver::MultiplierFactory<ValueType>().create(env, *this->A);
+                this->multiplierA = storm::solver::MultiplierFactory<ValueType>().create(env, this->getMatrix());
             }
             
             if (!auxiliaryRowGroupVector) {
-                auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
+                auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->getMatrix().getRowGroupCount());
             }
             
             // Forward the call to the core rational search routine.
-            bool converged = solveEquationsRationalSearchHelper<storm::RationalNumber, ImpreciseType>(env, dir, *this, rationalA, rationalX, rationalB, *this->A, x, b, *auxiliaryRowGroupVector);
+            bool converged = solveEquationsRationalSearchHelper<storm::RationalNumber, ImpreciseType>(env, dir, *this, rationalA, rationalX, rationalB, this->getMatrix(), x, b, *auxiliaryRowGroupVector);
             
             // Translate back rational result to imprecise result.
             auto targetIt = x.begin();
@@ -848,15 +872,15 @@ namespace storm {
             // Version for when the overall value type is exact and the same type is to be used for the imprecise part.
             
             if (!this->multiplierA) {
-                this->multiplierA = storm::solver::MultiplierFactory<ValueType>().create(env, *this->A);
+                this->multiplierA = storm::solver::MultiplierFactory<ValueType>().create(env, this->getMatrix());
             }
             
             if (!auxiliaryRowGroupVector) {
-                auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
+                auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->getMatrix().getRowGroupCount());
             }
             
             // Forward the call to the core rational search routine.
-            bool converged = solveEquationsRationalSearchHelper<ValueType, ImpreciseType>(env, dir, *this, *this->A, x, b, *this->A, *auxiliaryRowGroupVector, b, x);
+            bool converged = solveEquationsRationalSearchHelper<ValueType, ImpreciseType>(env, dir, *this, this->getMatrix(), x, b, this->getMatrix(), *auxiliaryRowGroupVector, b, x);
 
             if (!this->isCachingEnabled()) {
                 this->clearCache();
@@ -872,7 +896,7 @@ namespace storm {
             // problem using the imprecise data type and fall back to the exact type as needed.
             
             // Translate A to its imprecise version.
-            storm::storage::SparseMatrix<ImpreciseType> impreciseA = this->A->template toValueType<ImpreciseType>();
+            storm::storage::SparseMatrix<ImpreciseType> impreciseA = this->getMatrix().template toValueType<ImpreciseType>();
             
             // Translate x to its imprecise version.
             std::vector<ImpreciseType> impreciseX(x.size());
@@ -904,13 +928,13 @@ namespace storm {
             bool converged = false;
             try {
                 // Forward the call to the core rational search routine.
-                converged = solveEquationsRationalSearchHelper<ValueType, ImpreciseType>(env, dir, impreciseSolver, *this->A, x, b, impreciseA, impreciseX, impreciseB, impreciseTmpX);
+                converged = solveEquationsRationalSearchHelper<ValueType, ImpreciseType>(env, dir, impreciseSolver, this->getMatrix(), x, b, impreciseA, impreciseX, impreciseB, impreciseTmpX);
                 impreciseSolver.clearCache();
             } catch (storm::exceptions::PrecisionExceededException const& e) {
                 STORM_LOG_WARN("Precision of value type was exceeded, trying to recover by switching to rational arithmetic.");
                 
                 if (!auxiliaryRowGroupVector) {
-                    auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
+                    auxiliaryRowGroupVector = std::make_unique<std::vector<ValueType>>(this->getMatrix().getRowGroupCount());
                 }
 
                 // Translate the imprecise value iteration result to the one we are going to use from now on.
@@ -926,11 +950,11 @@ namespace storm {
                 impreciseA = storm::storage::SparseMatrix<ImpreciseType>();
 
                 if (!this->multiplierA) {
-                    this->multiplierA = storm::solver::MultiplierFactory<ValueType>().create(env, *this->A);
+                    this->multiplierA = storm::solver::MultiplierFactory<ValueType>().create(env, this->getMatrix());
                 }
                 
                 // Forward the call to the core rational search routine, but now with our value type as the imprecise value type.
-                converged = solveEquationsRationalSearchHelper<ValueType, ValueType>(env, dir, *this, *this->A, x, b, *this->A, *auxiliaryRowGroupVector, b, x);
+                converged = solveEquationsRationalSearchHelper<ValueType, ValueType>(env, dir, *this, this->getMatrix(), x, b, this->getMatrix(), *auxiliaryRowGroupVector, b, x);
             }
             
             if (!this->isCachingEnabled()) {
@@ -1038,17 +1062,17 @@ namespace storm {
         
         template<typename ValueType>
         void IterativeMinMaxLinearEquationSolver<ValueType>::computeOptimalValueForRowGroup(uint_fast64_t group, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b, uint_fast64_t* choice) const {
-            uint64_t row = this->A->getRowGroupIndices()[group];
-            uint64_t groupEnd = this->A->getRowGroupIndices()[group + 1];
+            uint64_t row = this->getMatrix().getRowGroupIndices()[group];
+            uint64_t groupEnd = this->getMatrix().getRowGroupIndices()[group + 1];
             assert(row != groupEnd);
             
             auto bIt = b.begin() + row;
             ValueType& xi = x[group];
-            xi = this->A->multiplyRowWithVector(row, x) + *bIt;
+            xi = this->getMatrix().multiplyRowWithVector(row, x) + *bIt;
             uint64_t optimalRow = row;
             
             for (++row, ++bIt; row < groupEnd; ++row, ++bIt) {
-                ValueType choiceVal = this->A->multiplyRowWithVector(row, x) + *bIt;
+                ValueType choiceVal = this->getMatrix().multiplyRowWithVector(row, x) + *bIt;
                 if (minimize(dir)) {
                     if (choiceVal < xi) {
                         xi = choiceVal;
@@ -1062,13 +1086,18 @@ namespace storm {
                 }
             }
             if (choice != nullptr) {
-                *choice = optimalRow - this->A->getRowGroupIndices()[group];
+                *choice = optimalRow - this->getMatrix().getRowGroupIndices()[group];
             }
         }
         
         template<typename ValueType>
         void IterativeMinMaxLinearEquationSolver<ValueType>::clearCache() const {
-            multiplierA.reset();
+            if (this->A) {
+                multiplierA.reset();
+            } else if (multiplierA) {
+                // The multiplier holds the only representation of the (released) matrix, so we keep it.
+                multiplierA->clearCache();
+            }
             auxiliaryRowGroupVector.reset();
             auxiliaryRowGroupVector2.reset();
             soundValueIterationHelper.reset();
@@ -34,6 +34,17 @@ namespace storm {
         private:
             
             MinMaxMethod getMethod(Environment const& env, bool isExactMode) const;
+
+            /*!
+             * Retrieves the matrix of this solver. If it was released before, it is restored from the multiplier.
+             */
+            storm::storage::SparseMatrix<ValueType> const& getMatrix() const;
+
+            /*!
+             * Releases the matrix if the solver owns it and the multiplier holds its own representation of it. This
+             * way, only one copy of the matrix is kept while the solver merely multiplies with it.
+             */
+            void releaseMatrix() const;
             
             bool solveInducedEquationSystem(Environment const& env, std::unique_ptr<LinearEquationSolver<ValueType>>& linearEquationSolver, std::vector<uint64_t> const& scheduler, std::vector<ValueType>& x, std::vector<ValueType>& subB, std::vector<ValueType> const& originalB) const;
             bool solveEquationsPolicyIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
@@ -11,8 +11,10 @@
 #include "storm/solver/SolverSelectionOptions.h"
 #include "storm/solver/NativeMultiplier.h"
 #include "storm/solver/GmmxxMultiplier.h"
+#include "storm/solver/CompressedMultiplier.h"
 #include "storm/environment/solver/MultiplierEnvironment.h"
 #include "storm/exceptions/IllegalArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/ProgressMeasurement.h"
 
@@ -31,12 +33,12 @@ namespace storm {
         
         template<typename ValueType>
         void Multiplier<ValueType>::multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
-            multiplyAndReduce(env, dir, this->matrix.getRowGroupIndices(), x, b, result, choices);
+            multiplyAndReduce(env, dir, this->getRowGroupIndices(), x, b, result, choices);
         }
 
         template<typename ValueType>
         void Multiplier<ValueType>::multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices, bool backwards) const {
-            multiplyAndReduceGaussSeidel(env, dir, this->matrix.getRowGroupIndices(), x, b, choices, backwards);
+            multiplyAndReduceGaussSeidel(env, dir, this->getRowGroupIndices(), x, b, choices, backwards);
         }
     
         template<typename ValueType>
@@ -73,6 +75,36 @@ namespace storm {
             multiplyRow(rowIndex, x1, val1);
             multiplyRow(rowIndex, x2, val2);
         }
+
+        template<typename ValueType>
+        bool Multiplier<ValueType>::hasOwnMatrixRepresentation() const {
+            return false;
+        }
+
+        template<typename ValueType>
+        storm::storage::SparseMatrix<ValueType> Multiplier<ValueType>::restoreMatrix() const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The multiplier does not hold its own representation of the matrix.");
+        }
+
+        template<typename ValueType>
+        std::vector<uint64_t> const& Multiplier<ValueType>::getRowGroupIndices() const {
+            return this->matrix.getRowGroupIndices();
+        }
+        
+        template<typename ValueType>
+        std::unique_ptr<Multiplier<ValueType>> createCompressedMultiplier(storm::storage::SparseMatrix<ValueType> const&) {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The compressed multiplier is only supported for double values.");
+        }
+        
+        template<>
+        std::unique_ptr<Multiplier<double>> createCompressedMultiplier(storm::storage::SparseMatrix<double> const& matrix) {
+            boost::optional<storm::storage::CompressedSparseMatrix<double>> compressedMatrix = storm::storage::CompressedSparseMatrix<double>::compress(matrix);
+            if (!compressedMatrix) {
+                STORM_LOG_WARN("The matrix has too many distinct values to be compressed. Falling back to the native multiplier.");
+                return std::make_unique<NativeMultiplier<double>>(matrix);
+            }
+            return std::make_unique<CompressedMultiplier<double>>(matrix, std::move(compressedMatrix.get()));
+        }
         
         template<typename ValueType>
         std::unique_ptr<Multiplier<ValueType>> MultiplierFactory<ValueType>::create(Environment const& env, storm::storage::SparseMatrix<ValueType> const& matrix) {
@@ -96,6 +128,8 @@ namespace storm {
                     return std::make_unique<GmmxxMultiplier<ValueType>>(matrix);
                 case MultiplierType::Native:
                     return std::make_unique<NativeMultiplier<ValueType>>(matrix);
+                case MultiplierType::Compressed:
+                    return createCompressedMultiplier(matrix);
             }
             STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Unknown MultiplierType");
         }
@@ -133,8 +133,25 @@ namespace storm {
              * @param val2 The second multiplication result is added to this value. It shall not reffer to a value in x or in the Matrix.
              */
             virtual void multiplyRow2(uint64_t const& rowIndex, std::vector<ValueType> const& x1, ValueType& val1, std::vector<ValueType> const& x2, ValueType& val2) const;
+
+            /*!
+             * Retrieves whether this multiplier holds its own representation of the matrix. If so, the matrix given upon
+             * construction is not accessed anymore and the owner of the matrix may release it.
+             */
+            virtual bool hasOwnMatrixRepresentation() const;
+
+            /*!
+             * Reconstructs the matrix from the representation held by this multiplier.
+             * This is only supported if the multiplier has its own representation of the matrix.
+             */
+            virtual storm::storage::SparseMatrix<ValueType> restoreMatrix() const;
             
         protected:
+            /*!
+             * Retrieves the row group indices of the matrix.
+             */
+            virtual std::vector<uint64_t> const& getRowGroupIndices() const;
+
             mutable std::unique_ptr<std::vector<ValueType>> cachedVector;
             storm::storage::SparseMatrix<ValueType> const& matrix;
         };
@@ -1,7 +1,9 @@
 #include "storm/solver/NativeLinearEquationSolver.h"
 
 #include <limits>
+#include <numeric>
 
+#include "storm/adapters/EigenAdapter.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
 
 #include "storm/utility/ConstantsComparator.h"
@@ -23,24 +25,31 @@ namespace storm {
     namespace solver {
 
         template<typename ValueType>
-        NativeLinearEquationSolver<ValueType>::NativeLinearEquationSolver() : localA(nullptr), A(nullptr) {
+        NativeLinearEquationSolver<ValueType>::NativeLinearEquationSolver() : localA(nullptr), A(nullptr), matrixRowCount(0), matrixColumnCount(0) {
             // Intentionally left empty.
         }
 
         template<typename ValueType>
-        NativeLinearEquationSolver<ValueType>::NativeLinearEquationSolver(storm::storage::SparseMatrix<ValueType> const& A) : localA(nullptr), A(nullptr) {
+        NativeLinearEquationSolver<ValueType>::NativeLinearEquationSolver(storm::storage::SparseMatrix<ValueType> const& A) : localA(nullptr), A(nullptr), matrixRowCount(0), matrixColumnCount(0) {
             this->setMatrix(A);
         }
 
         template<typename ValueType>
-        NativeLinearEquationSolver<ValueType>::NativeLinearEquationSolver(storm::storage::SparseMatrix<ValueType>&& A) : localA(nullptr), A(nullptr) {
+        NativeLinearEquationSolver<ValueType>::NativeLinearEquationSolver(storm::storage::SparseMatrix<ValueType>&& A) : localA(nullptr), A(nullptr), matrixRowCount(0), matrixColumnCount(0) {
             this->setMatrix(std::move(A));
         }
         
+        template<typename ValueType>
+        NativeLinearEquationSolver<ValueType>::~NativeLinearEquationSolver() {
+            // Intentionally left empty.
+        }
+        
         template<typename ValueType>
         void NativeLinearEquationSolver<ValueType>::setMatrix(storm::storage::SparseMatrix<ValueType> const& A) {
             localA.reset();
             this->A = &A;
+            matrixRowCount = A.getRowCount();
+            matrixColumnCount = A.getColumnCount();
             clearCache();
         }
 
@@ -48,9 +57,31 @@ namespace storm {
         void NativeLinearEquationSolver<ValueType>::setMatrix(storm::storage::SparseMatrix<ValueType>&& A) {
             localA = std::make_unique<storm::storage::SparseMatrix<ValueType>>(std::move(A));
             this->A = localA.get();
+            matrixRowCount = localA->getRowCount();
+            matrixColumnCount = localA->getColumnCount();
             clearCache();
         }
 
+        template<typename ValueType>
+        storm::storage::SparseMatrix<ValueType> const& NativeLinearEquationSolver<ValueType>::getMatrix() const {
+            if (!this->A) {
+                STORM_LOG_ASSERT(this->multiplier && this->multiplier->hasOwnMatrixRepresentation(), "The matrix was released but can not be restored.");
+                STORM_LOG_INFO("Restoring the matrix from the representation held by the multiplier.");
+                localA = std::make_unique<storm::storage::SparseMatrix<ValueType>>(this->multiplier->restoreMatrix());
+                this->A = localA.get();
+            }
+            return *this->A;
+        }
+
+        template<typename ValueType>
+        void NativeLinearEquationSolver<ValueType>::releaseMatrix() const {
+            if (localA && this->multiplier && this->multiplier->hasOwnMatrixRepresentation()) {
+                STORM_LOG_INFO("Releasing the matrix as the multiplier holds its own representation of it.");
+                localA.reset();
+                this->A = nullptr;
+            }
+        }
+
         template<typename ValueType>
         bool NativeLinearEquationSolver<ValueType>::solveEquationsSOR(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b, ValueType const& omega) const {
             STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with NativeLinearEquationSolver (Gauss-Seidel, SOR omega = " << omega << ")");
@@ -69,7 +100,7 @@ namespace storm {
             
             this->startMeasureProgress();
             while (status == SolverStatus::InProgress && iterations < maxIter) {
-                A->performSuccessiveOverRelaxationStep(omega, x, b);
+                getMatrix().performSuccessiveOverRelaxationStep(omega, x, b);
                 
                 // Now check if the process already converged within our precision.
                 if (storm::utility::vector::equalModuloPrecision<ValueType>(*this->cachedRowVector, x, precision, relative)) {
@@ -116,7 +147,7 @@ namespace storm {
             
             // Get a Jacobi decomposition of the matrix A.
             if (!jacobiDecomposition) {
-                jacobiDecomposition = std::make_unique<JacobiDecomposition>(env, *A);
+                jacobiDecomposition = std::make_unique<JacobiDecomposition>(env, getMatrix());
             }
             
             ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
@@ -232,7 +263,7 @@ namespace storm {
             
             // (1) Compute an equivalent equation system that has only non-negative coefficients.
             if (!walkerChaeData) {
-                walkerChaeData = std::make_unique<WalkerChaeData>(env, *this->A, b);
+                walkerChaeData = std::make_unique<WalkerChaeData>(env, this->getMatrix(), b);
             }
 
             // (2) Enlarge the vectors x and b to account for additional variables.
@@ -295,7 +326,7 @@ namespace storm {
             }
 
             // Resize the solution to the right size.
-            x.resize(this->A->getRowCount());
+            x.resize(this->getMatrix().getRowCount());
             
             // Finalize solution vector.
             storm::utility::vector::applyPointwise(x, x, [this] (ValueType const& value) -> ValueType { return value - walkerChaeData->t; } );
@@ -351,8 +382,10 @@ namespace storm {
                 this->cachedRowVector = std::make_unique<std::vector<ValueType>>(getMatrixRowCount());
             }
             if (!this->multiplier) {
-                this->multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, *A);
+                this->multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, getMatrix());
             }
+            // The power method only multiplies with the matrix, so there is no need to keep the original matrix.
+            releaseMatrix();
             std::vector<ValueType>* currentX = &x;
             SolverGuarantee guarantee = SolverGuarantee::None;
             if (this->hasCustomTerminationCondition()) {
@@ -428,8 +461,9 @@ namespace storm {
             }
             
             if (!this->multiplier) {
-                this->multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, *A);
+                this->multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, getMatrix());
             }
+            releaseMatrix();
 
             SolverStatus status = SolverStatus::InProgress;
             uint64_t iterations = 0;
@@ -582,12 +616,12 @@ namespace storm {
         bool NativeLinearEquationSolver<ValueType>::solveEquationsSoundValueIteration(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
 
             // Prepare the solution vectors and the helper.
-            assert(x.size() == this->A->getRowCount());
+            assert(x.size() == this->getMatrix().getRowCount());
             if (!this->cachedRowVector) {
                 this->cachedRowVector = std::make_unique<std::vector<ValueType>>();
             }
             if (!this->soundValueIterationHelper) {
-                this->soundValueIterationHelper = std::make_unique<storm::solver::helper::SoundValueIterationHelper<ValueType>>(*this->A, x, *this->cachedRowVector, env.solver().native().getRelativeTerminationCriterion(), storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision()));
+                this->soundValueIterationHelper = std::make_unique<storm::solver::helper::SoundValueIterationHelper<ValueType>>(this->getMatrix(), x, *this->cachedRowVector, env.solver().native().getRelativeTerminationCriterion(), storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision()));
             } else {
                 this->soundValueIterationHelper = std::make_unique<storm::solver::helper::SoundValueIterationHelper<ValueType>>(std::move(*this->soundValueIterationHelper), x, *this->cachedRowVector, env.solver().native().getRelativeTerminationCriterion(), storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision()));
             }
@@ -644,10 +678,10 @@ namespace storm {
             }
             
             if (!this->cachedRowVector) {
-                this->cachedRowVector = std::make_unique<std::vector<ValueType>>(this->A->getRowCount());
+                this->cachedRowVector = std::make_unique<std::vector<ValueType>>(this->getMatrix().getRowCount());
             }
             if (!optimisticValueIterationHelper) {
-                optimisticValueIterationHelper = std::make_unique<storm::solver::helper::OptimisticValueIterationHelper<ValueType>>(*this->A);
+                optimisticValueIterationHelper = std::make_unique<storm::solver::helper::OptimisticValueIterationHelper<ValueType>>(this->getMatrix());
             }
 
             // x has to start with a lower bound.
@@ -656,7 +690,7 @@ namespace storm {
             std::vector<ValueType>* lowerX = &x;
             std::vector<ValueType>* upperX = this->cachedRowVector.get();
 
-            storm::solver::helper::OptimisticValueIterationHelper<ValueType> helper(*this->A);
+            storm::solver::helper::OptimisticValueIterationHelper<ValueType> helper(this->getMatrix());
             auto statusIters = helper.solveEquations(env, lowerX, upperX, b,
                                                      env.solver().native().getRelativeTerminationCriterion(),
                                                      storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision()),
@@ -784,19 +818,19 @@ namespace storm {
             // Version for when the overall value type is imprecise.
             
             // Create a rational representation of the input so we can check for a proper solution later.
-            storm::storage::SparseMatrix<storm::RationalNumber> rationalA = this->A->template toValueType<storm::RationalNumber>();
+            storm::storage::SparseMatrix<storm::RationalNumber> rationalA = this->getMatrix().template toValueType<storm::RationalNumber>();
             std::vector<storm::RationalNumber> rationalX(x.size());
             std::vector<storm::RationalNumber> rationalB = storm::utility::vector::convertNumericVector<storm::RationalNumber>(b);
                         
             if (!this->cachedRowVector) {
-                this->cachedRowVector = std::make_unique<std::vector<ValueType>>(this->A->getRowCount());
+                this->cachedRowVector = std::make_unique<std::vector<ValueType>>(this->getMatrix().getRowCount());
             }
             if (!this->multiplier) {
-                this->multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, *A);
+                this->multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, getMatrix());
             }
             
             // Forward the call to the core rational search routine.
-            bool converged = solveEquationsRationalSearchHelper<storm::RationalNumber, ImpreciseType>(env, *this, rationalA, rationalX, rationalB, *this->A, x, b, *this->cachedRowVector);
+            bool converged = solveEquationsRationalSearchHelper<storm::RationalNumber, ImpreciseType>(env, *this, rationalA, rationalX, rationalB, this->getMatrix(), x, b, *this->cachedRowVector);
             
             // Translate back rational result to imprecise result.
             auto targetIt = x.begin();
@@ -817,14 +851,14 @@ namespace storm {
             // Version for when the overall value type is exact and the same type is to be used for the imprecise part.
             
             if (!this->cachedRowVector) {
-                this->cachedRowVector = std::make_unique<std::vector<ValueType>>(this->A->getRowCount());
+                this->cachedRowVector = std::make_unique<std::vector<ValueType>>(this->getMatrix().getRowCount());
             }
             if (!this->multiplier) {
-                this->multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, *A);
+                this->multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, getMatrix());
             }
             
             // Forward the call to the core rational search routine.
-            bool converged = solveEquationsRationalSearchHelper<ValueType, ImpreciseType>(env, *this, *this->A, x, b, *this->A, *this->cachedRowVector, b, x);
+            bool converged = solveEquationsRationalSearchHelper<ValueType, ImpreciseType>(env, *this, this->getMatrix(), x, b, this->getMatrix(), *this->cachedRowVector, b, x);
             
             if (!this->isCachingEnabled()) {
                 this->clearCache();
@@ -840,7 +874,7 @@ namespace storm {
             // problem using the imprecise data type and fall back to the exact type as needed.
             
             // Translate A to its imprecise version.
-            storm::storage::SparseMatrix<ImpreciseType> impreciseA = this->A->template toValueType<ImpreciseType>();
+            storm::storage::SparseMatrix<ImpreciseType> impreciseA = this->getMatrix().template toValueType<ImpreciseType>();
             
             // Translate x to its imprecise version.
             std::vector<ImpreciseType> impreciseX(x.size());
@@ -872,16 +906,16 @@ namespace storm {
             bool converged = false;
             try {
                 // Forward the call to the core rational search routine.
-                converged = solveEquationsRationalSearchHelper<ValueType, ImpreciseType>(env, impreciseSolver, *this->A, x, b, impreciseA, impreciseX, impreciseB, impreciseTmpX);
+                converged = solveEquationsRationalSearchHelper<ValueType, ImpreciseType>(env, impreciseSolver, this->getMatrix(), x, b, impreciseA, impreciseX, impreciseB, impreciseTmpX);
                 impreciseSolver.clearCache();
             } catch (storm::exceptions::PrecisionExceededException const& e) {
                 STORM_LOG_WARN("Precision of value type was exceeded, trying to recover by switching to rational arithmetic.");
                 
                 if (!this->cachedRowVector) {
-                    this->cachedRowVector = std::make_unique<std::vector<ValueType>>(this->A->getRowGroupCount());
+                    this->cachedRowVector = std::make_unique<std::vector<ValueType>>(this->getMatrix().getRowGroupCount());
                 }
                 if (!this->multiplier) {
-                    this->multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, *A);
+                    this->multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, getMatrix());
                 }
                 // Translate the imprecise value iteration result to the one we are going to use from now on.
                 auto targetIt = this->cachedRowVector->begin();
@@ -896,7 +930,7 @@ namespace storm {
                 impreciseA = storm::storage::SparseMatrix<ImpreciseType>();
                 
                 // Forward the call to the core rational search routine, but now with our value type as the imprecise value type.
-                converged = solveEquationsRationalSearchHelper<ValueType, ValueType>(env, *this, *this->A, x, b, *this->A, *this->cachedRowVector, b, x);
+                converged = solveEquationsRationalSearchHelper<ValueType, ValueType>(env, *this, this->getMatrix(), x, b, this->getMatrix(), *this->cachedRowVector, b, x);
             }
             
             if (!this->isCachingEnabled()) {
@@ -919,6 +953,190 @@ namespace storm {
             return false;
         }
 
+        template<typename ValueType>
+        struct NativeLinearEquationSolver<ValueType>::AggregationData {
+            AggregationData(storm::storage::SparseMatrix<ValueType> const& A);
+            
+            /*!
+             * Adds the solution of the aggregated residual equation to the rows of each aggregate. If the aggregated
+             * equation can not be solved, x is left unchanged and the coarse solver is disabled.
+             */
+            void applyCoarseCorrection(storm::storage::SparseMatrix<ValueType> const& A, std::vector<ValueType>& x, std::vector<ValueType> const& b);
+            
+            // The aggregate of each row.
+            std::vector<uint64_t> aggregateOfRow;
+            uint64_t numberOfAggregates;
+            
+            // The aggregated matrix and its factorization (if the aggregated matrix is not singular).
+            std::unique_ptr<Eigen::SparseMatrix<ValueType>> coarseMatrix;
+            Eigen::SparseLU<Eigen::SparseMatrix<ValueType>, Eigen::COLAMDOrdering<int>> coarseSolver;
+            bool coarseSolverAvailable;
+            
+            // Auxiliary data.
+            std::vector<ValueType> residual;
+            Eigen::Matrix<ValueType, Eigen::Dynamic, 1> coarseResidual;
+            Eigen::Matrix<ValueType, Eigen::Dynamic, 1> coarseCorrection;
+        };
+        
+        template<typename ValueType>
+        NativeLinearEquationSolver<ValueType>::AggregationData::AggregationData(storm::storage::SparseMatrix<ValueType> const& A) : numberOfAggregates(0), coarseSolverAvailable(false) {
+            uint64_t numberOfRows = A.getRowCount();
+            
+            // Merge rows that are strongly coupled, i.e. whose entry is at least a fraction of the largest off-diagonal
+            // entry of the row. For nearly completely decomposable systems, the aggregates are the (nearly) decoupled blocks.
+            ValueType strongCouplingFactor = storm::utility::convertNumber<ValueType>(0.25);
+            std::vector<uint64_t> representative(numberOfRows);
+            std::iota(representative.begin(), representative.end(), 0);
+            auto findRepresentative = [&representative] (uint64_t row) {
+                while (representative[row] != row) {
+                    representative[row] = representative[representative[row]];
+                    row = representative[row];
+                }
+                return row;
+            };
+            for (uint64_t row = 0; row < numberOfRows; ++row) {
+                ValueType maxOffDiagonal = storm::utility::zero<ValueType>();
+                for (auto const& entry : A.getRow(row)) {
+                    if (entry.getColumn() != row) {
+                        maxOffDiagonal = storm::utility::max<ValueType>(maxOffDiagonal, storm::utility::abs<ValueType>(entry.getValue()));
+                    }
+                }
+                if (storm::utility::isZero(maxOffDiagonal)) {
+                    continue;
+                }
+                ValueType threshold = strongCouplingFactor * maxOffDiagonal;
+                for (auto const& entry : A.getRow(row)) {
+                    if (entry.getColumn() != row && storm::utility::abs<ValueType>(entry.getValue()) >= threshold) {
+                        uint64_t first = findRepresentative(row);
+                        uint64_t second = findRepresentative(entry.getColumn());
+                        if (first != second) {
+                            representative[std::max(first, second)] = std::min(first, second);
+                        }
+                    }
+                }
+            }
+            
+            // Number the aggregates consecutively.
+            aggregateOfRow.resize(numberOfRows);
+            std::vector<uint64_t> aggregateOfRepresentative(numberOfRows, std::numeric_limits<uint64_t>::max());
+            for (uint64_t row = 0; row < numberOfRows; ++row) {
+                uint64_t& aggregate = aggregateOfRepresentative[findRepresentative(row)];
+                if (aggregate == std::numeric_limits<uint64_t>::max()) {
+                    aggregate = numberOfAggregates++;
+                }
+                aggregateOfRow[row] = aggregate;
+            }
+            std::vector<std::vector<uint64_t>> rowsOfAggregate(numberOfAggregates);
+            for (uint64_t row = 0; row < numberOfRows; ++row) {
+                rowsOfAggregate[aggregateOfRow[row]].push_back(row);
+            }
+            
+            // Build the aggregated matrix by summing all entries between two aggregates.
+            storm::storage::SparseMatrixBuilder<ValueType> builder(numberOfAggregates, numberOfAggregates);
+            std::vector<ValueType> rowValues(numberOfAggregates, storm::utility::zero<ValueType>());
+            storm::storage::BitVector touchedAggregates(numberOfAggregates);
+            for (uint64_t aggregate = 0; aggregate < numberOfAggregates; ++aggregate) {
+                for (auto const& row : rowsOfAggregate[aggregate]) {
+                    for (auto const& entry : A.getRow(row)) {
+                        uint64_t column = aggregateOfRow[entry.getColumn()];
+                        rowValues[column] += entry.getValue();
+                        touchedAggregates.set(column);
+                    }
+                }
+                for (auto const& column : touchedAggregates) {
+                    if (!storm::utility::isZero(rowValues[column])) {
+                        builder.addNextValue(aggregate, column, rowValues[column]);
+                    }
+                    rowValues[column] = storm::utility::zero<ValueType>();
+                }
+                touchedAggregates.clear();
+            }
+            
+            coarseMatrix = storm::adapters::EigenAdapter::toEigenSparseMatrix(builder.build(numberOfAggregates, numberOfAggregates));
+            coarseSolver.compute(*coarseMatrix);
+            coarseSolverAvailable = coarseSolver.info() == Eigen::Success;
+            STORM_LOG_WARN_COND(coarseSolverAvailable, "The aggregated matrix is singular. Falling back to Gauss-Seidel iterations.");
+            
+            residual.resize(numberOfRows);
+            coarseResidual.resize(numberOfAggregates);
+            coarseCorrection.resize(numberOfAggregates);
+        }
+        
+        template<typename ValueType>
+        void NativeLinearEquationSolver<ValueType>::AggregationData::applyCoarseCorrection(storm::storage::SparseMatrix<ValueType> const& A, std::vector<ValueType>& x, std::vector<ValueType> const& b) {
+            A.multiplyWithVector(x, residual);
+            storm::utility::vector::subtractVectors(b, residual, residual);
+            
+            coarseResidual.setZero();
+            for (uint64_t row = 0; row < residual.size(); ++row) {
+                coarseResidual(aggregateOfRow[row]) += residual[row];
+            }
+            coarseCorrection = coarseSolver.solve(coarseResidual);
+            if (coarseSolver.info() != Eigen::Success) {
+                STORM_LOG_WARN("Solving the aggregated system failed. Falling back to Gauss-Seidel iterations.");
+                coarseSolverAvailable = false;
+                return;
+            }
+            for (uint64_t row = 0; row < x.size(); ++row) {
+                x[row] += coarseCorrection(aggregateOfRow[row]);
+            }
+        }
+        
+        template<typename ValueType>
+        bool NativeLinearEquationSolver<ValueType>::solveEquationsAggregationDisaggregation(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with NativeLinearEquationSolver (aggregation-disaggregation)");
+            
+            if (!this->cachedRowVector) {
+                this->cachedRowVector = std::make_unique<std::vector<ValueType>>(getMatrixRowCount());
+            }
+            if (!aggregationData) {
+                aggregationData = std::make_unique<AggregationData>(getMatrix());
+                STORM_LOG_INFO("Aggregated " << getMatrixRowCount() << " rows into " << aggregationData->numberOfAggregates << " blocks.");
+            }
+            
+            ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
+            uint64_t maxIter = env.solver().native().getMaximalNumberOfIterations();
+            bool relative = env.solver().native().getRelativeTerminationCriterion();
+            
+            // Set up additional environment variables.
+            uint_fast64_t iterations = 0;
+            SolverStatus status = SolverStatus::InProgress;
+            
+            this->startMeasureProgress();
+            while (status == SolverStatus::InProgress && iterations < maxIter) {
+                *this->cachedRowVector = x;
+                
+                // Smooth the error within the aggregates, correct the error between them on the aggregated system and
+                // smooth again.
+                getMatrix().performSuccessiveOverRelaxationStep(storm::utility::one<ValueType>(), x, b);
+                if (aggregationData->coarseSolverAvailable) {
+                    aggregationData->applyCoarseCorrection(getMatrix(), x, b);
+                    getMatrix().performSuccessiveOverRelaxationStep(storm::utility::one<ValueType>(), x, b);
+                }
+                
+                // Now check if the process already converged within our precision.
+                if (storm::utility::vector::equalModuloPrecision<ValueType>(*this->cachedRowVector, x, precision, relative)) {
+                    status = SolverStatus::Converged;
+                }
+                
+                // Potentially show progress.
+                this->showProgressIterative(iterations);
+                
+                // Increase iteration count so we can abort if convergence is too slow.
+                ++iterations;
+                
+                status = this->updateStatus(status, x, SolverGuarantee::None, iterations, maxIter);
+            }
+            
+            if (!this->isCachingEnabled()) {
+                clearCache();
+            }
+            
+            this->reportStatus(status, iterations);
+            
+            return status == SolverStatus::Converged;
+        }
+        
         template<typename ValueType>
         bool NativeLinearEquationSolver<ValueType>::isSolution(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType> const& values, std::vector<ValueType> const& b) {
             storm::utility::ConstantsComparator<ValueType> comparator;
@@ -994,6 +1212,8 @@ namespace storm {
                     return this->solveEquationsIntervalIteration(env, x, b);
                 case NativeLinearEquationSolverMethod::RationalSearch:
                     return this->solveEquationsRationalSearch(env, x, b);
+                case NativeLinearEquationSolverMethod::AggregationDisaggregation:
+                    return this->solveEquationsAggregationDisaggregation(env, x, b);
             }
             STORM_LOG_THROW(false, storm::exceptions::InvalidEnvironmentException, "Unknown solving technique.");
             return false;
@@ -1028,7 +1248,13 @@ namespace storm {
             jacobiDecomposition.reset();
             cachedRowVector2.reset();
             walkerChaeData.reset();
-            multiplier.reset();
+            aggregationData.reset();
+            if (this->A) {
+                multiplier.reset();
+            } else if (multiplier) {
+                // The multiplier holds the only representation of the (released) matrix, so we keep it.
+                multiplier->clearCache();
+            }
             soundValueIterationHelper.reset();
             optimisticValueIterationHelper.reset();
             LinearEquationSolver<ValueType>::clearCache();
@@ -1036,12 +1262,12 @@ namespace storm {
         
         template<typename ValueType>
         uint64_t NativeLinearEquationSolver<ValueType>::getMatrixRowCount() const {
-            return this->A->getRowCount();
+            return matrixRowCount;
         }
         
         template<typename ValueType>
         uint64_t NativeLinearEquationSolver<ValueType>::getMatrixColumnCount() const {
-            return this->A->getColumnCount();
+            return matrixColumnCount;
         }
         
         template<typename ValueType>
@@ -28,6 +28,7 @@ namespace storm {
             NativeLinearEquationSolver();
             NativeLinearEquationSolver(storm::storage::SparseMatrix<ValueType> const& A);
             NativeLinearEquationSolver(storm::storage::SparseMatrix<ValueType>&& A);
+            virtual ~NativeLinearEquationSolver();
             
             virtual void setMatrix(storm::storage::SparseMatrix<ValueType> const& A) override;
             virtual void setMatrix(storm::storage::SparseMatrix<ValueType>&& A) override;
@@ -62,6 +63,17 @@ namespace storm {
 
             NativeLinearEquationSolverMethod getMethod(Environment const& env, bool isExactMode) const;
 
+            /*!
+             * Retrieves the matrix of this solver. If it was released before, it is restored from the multiplier.
+             */
+            storm::storage::SparseMatrix<ValueType> const& getMatrix() const;
+
+            /*!
+             * Releases the matrix if the solver owns it and the multiplier holds its own representation of it. This
+             * way, only one copy of the matrix is kept while the solver merely multiplies with it.
+             */
+            void releaseMatrix() const;
+
             virtual bool solveEquationsSOR(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b, ValueType const& omega) const;
             virtual bool solveEquationsJacobi(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             virtual bool solveEquationsWalkerChae(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
@@ -70,6 +82,7 @@ namespace storm {
             virtual bool solveEquationsOptimisticValueIteration(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             virtual bool solveEquationsIntervalIteration(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             virtual bool solveEquationsRationalSearch(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+            virtual bool solveEquationsAggregationDisaggregation(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
 
             template<typename RationalType, typename ImpreciseType>
             bool solveEquationsRationalSearchHelper(storm::Environment const& env, NativeLinearEquationSolver<ImpreciseType> const& impreciseSolver, storm::storage::SparseMatrix<RationalType> const& rationalA, std::vector<RationalType>& rationalX, std::vector<RationalType> const& rationalB, storm::storage::SparseMatrix<ImpreciseType> const& A, std::vector<ImpreciseType>& x, std::vector<ImpreciseType> const& b, std::vector<ImpreciseType>& tmpX) const;
@@ -84,12 +97,16 @@ namespace storm {
             static bool isSolution(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType> const& values, std::vector<ValueType> const& b);
             
             // If the solver takes posession of the matrix, we store the moved matrix in this member, so it gets deleted
-            // when the solver is destructed.
-            std::unique_ptr<storm::storage::SparseMatrix<ValueType>> localA;
+            // when the solver is destructed. It may be released temporarily (see releaseMatrix).
+            mutable std::unique_ptr<storm::storage::SparseMatrix<ValueType>> localA;
             
             // A pointer to the original sparse matrix given to this solver. If the solver takes posession of the matrix
-            // the pointer refers to localA.
-            storm::storage::SparseMatrix<ValueType> const* A;
+            // the pointer refers to localA. It is null if the matrix was released.
+            mutable storm::storage::SparseMatrix<ValueType> const* A;
+
+            // The dimensions of the matrix, which remain available if the matrix was released.
+            uint64_t matrixRowCount;
+            uint64_t matrixColumnCount;
             
             // An object to dispatch all multiplication operations.
             mutable std::unique_ptr<Multiplier<ValueType>> multiplier;
@@ -125,6 +142,11 @@ namespace storm {
                 std::vector<ValueType> newX;
             };
             mutable std::unique_ptr<WalkerChaeData> walkerChaeData;
+            
+            // The aggregation of the rows and the factorized coarse system (defined in the source file to avoid
+            // exposing the Eigen types).
+            struct AggregationData;
+            mutable std::unique_ptr<AggregationData> aggregationData;
         };
         
         template<typename ValueType>
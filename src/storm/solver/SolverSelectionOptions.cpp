@@ -36,6 +36,8 @@ namespace storm {
                     return "Native";
                 case MultiplierType::Gmmxx:
                     return "Gmmxx";
+                case MultiplierType::Compressed:
+                    return "Compressed";
             }
             return "invalid";
         }
@@ -74,6 +76,16 @@ namespace storm {
             return "invalid";
         }
         
+        std::string toString(CtmcTransientMethod m) {
+            switch(m) {
+                case CtmcTransientMethod::Uniformization:
+                    return "uniformization";
+                case CtmcTransientMethod::Krylov:
+                    return "krylov";
+            }
+            return "invalid";
+        }
+        
         std::string toString(LpSolverType t) {
             switch(t) {
                 case LpSolverType::Gurobi:
@@ -134,6 +146,8 @@ namespace storm {
                     return "IntervalIteration";
                 case NativeLinearEquationSolverMethod::RationalSearch:
                     return "RationalSearch";
+                case NativeLinearEquationSolverMethod::AggregationDisaggregation:
+                    return "AggregationDisaggregation";
             }
             return "invalid";
         }
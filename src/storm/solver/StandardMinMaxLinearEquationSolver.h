@@ -24,12 +24,13 @@ namespace storm {
         protected:
             
             // If the solver takes posession of the matrix, we store the moved matrix in this member, so it gets deleted
-            // when the solver is destructed.
-            std::unique_ptr<storm::storage::SparseMatrix<ValueType>> localA;
+            // when the solver is destructed. Subclasses may release it temporarily if they hold another representation
+            // of the matrix.
+            mutable std::unique_ptr<storm::storage::SparseMatrix<ValueType>> localA;
             
             // A reference to the original sparse matrix given to this solver. If the solver takes posession of the matrix
-            // the reference refers to localA.
-            storm::storage::SparseMatrix<ValueType> const* A;
+            // the reference refers to localA. It is null if the matrix was released.
+            mutable storm::storage::SparseMatrix<ValueType> const* A;
         };
      
     }
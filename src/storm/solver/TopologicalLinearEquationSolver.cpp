@@ -1,6 +1,7 @@
 #include "storm/solver/TopologicalLinearEquationSolver.h"
 
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
+#include "storm/environment/solver/EigenSolverEnvironment.h"
 
 #include "storm/utility/constants.h"
 #include "storm/utility/vector.h"
@@ -54,6 +55,14 @@ namespace storm {
             }
             return subEnv;
         }
+        
+        template<typename ValueType>
+        storm::Environment TopologicalLinearEquationSolver<ValueType>::getEnvironmentForDirectSolver(storm::Environment const& env) const {
+            storm::Environment subEnv(env);
+            subEnv.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Eigen);
+            subEnv.solver().eigen().setMethod(storm::solver::EigenLinearEquationSolverMethod::SparseLU);
+            return subEnv;
+        }
 
         template<typename ValueType>
         bool TopologicalLinearEquationSolver<ValueType>::internalSolveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
@@ -78,11 +87,25 @@ namespace storm {
                 STORM_LOG_INFO("Longest SCC chain size is " << this->longestSccChainSize.get() << ".");
             }
             
+            // SCCs up to the given size are solved directly. As the result of the factorization is not guaranteed to be
+            // within the precision, we only do this if no sound results are required.
+            uint64_t directSccSize = 0;
+            if (storm::NumberTraits<ValueType>::IsExact || !env.solver().isForceSoundness()) {
+                directSccSize = env.solver().topological().getDirectSccSize();
+            }
+            
             // Handle the case where there is just one large SCC
             bool returnValue = true;
             if (this->sortedSccDecomposition->size() == 1) {
-                returnValue = solveFullyConnectedEquationSystem(sccSolverEnvironment, x, b);
+                if (x.size() <= directSccSize) {
+                    returnValue = solveFullyConnectedEquationSystem(getEnvironmentForDirectSolver(env), x, b);
+                } else {
+                    returnValue = solveFullyConnectedEquationSystem(sccSolverEnvironment, x, b);
+                }
             } else {
+                storm::Environment directSolverEnvironment = getEnvironmentForDirectSolver(env);
+                uint64_t numberOfTrivialSccs = 0;
+                uint64_t numberOfDirectlySolvedSccs = 0;
                 // Solve each SCC individually
                 storm::storage::BitVector sccAsBitVector(x.size(), false);
                 uint64_t sccIndex = 0;
@@ -92,12 +115,18 @@ namespace storm {
                 for (auto const& scc : *this->sortedSccDecomposition) {
                     if (scc.size() == 1) {
                         returnValue = solveTrivialScc(*scc.begin(), x, b) && returnValue;
+                        ++numberOfTrivialSccs;
                     } else {
                         sccAsBitVector.clear();
                         for (auto const& state : scc) {
                             sccAsBitVector.set(state, true);
                         }
-                        returnValue = solveScc(sccSolverEnvironment, sccAsBitVector, x, b) && returnValue;
+                        if (scc.size() <= directSccSize) {
+                            returnValue = solveScc(directSolverEnvironment, sccAsBitVector, x, b, true) && returnValue;
+                            ++numberOfDirectlySolvedSccs;
+                        } else {
+                            returnValue = solveScc(sccSolverEnvironment, sccAsBitVector, x, b) && returnValue;
+                        }
                     }
                     ++sccIndex;
                     progress.updateProgress(sccIndex);
@@ -106,6 +135,7 @@ namespace storm {
                         break;
                     }
                 }
+                STORM_LOG_INFO("Solved " << numberOfTrivialSccs << " trivial SCC(s) in closed form, " << numberOfDirectlySolvedSccs << " SCC(s) directly, and " << (sccIndex - numberOfTrivialSccs - numberOfDirectlySolvedSccs) << " SCC(s) with the underlying solver.");
             }
             
             if (!this->isCachingEnabled()) {
@@ -173,21 +203,22 @@ namespace storm {
         }
         
         template<typename ValueType>
-        bool TopologicalLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment, storm::storage::BitVector const& scc, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const {
+        bool TopologicalLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment, storm::storage::BitVector const& scc, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB, bool useDirectSolver) const {
             
             // Set up the SCC solver
-            if (!this->sccSolver) {
-                this->sccSolver = GeneralLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
-                this->sccSolver->setCachingEnabled(true);
+            auto& solver = useDirectSolver ? this->directSccSolver : this->sccSolver;
+            if (!solver) {
+                solver = GeneralLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
+                solver->setCachingEnabled(true);
             }
             
             // Matrix
-            bool asEquationSystem = this->sccSolver->getEquationProblemFormat(sccSolverEnvironment) == LinearEquationSolverProblemFormat::EquationSystem;
+            bool asEquationSystem = solver->getEquationProblemFormat(sccSolverEnvironment) == LinearEquationSolverProblemFormat::EquationSystem;
             storm::storage::SparseMatrix<ValueType> sccA = this->A->getSubmatrix(true, scc, scc, asEquationSystem);
             if (asEquationSystem) {
                 sccA.convertToEquationSystem();
             }
-            this->sccSolver->setMatrix(std::move(sccA));
+            solver->setMatrix(std::move(sccA));
             
             // x Vector
             auto sccX = storm::utility::vector::filterVector(globalX, scc);
@@ -207,20 +238,20 @@ namespace storm {
             
             // lower/upper bounds
             if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-                this->sccSolver->setLowerBound(this->getLowerBound());
+                solver->setLowerBound(this->getLowerBound());
             } else if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-                this->sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), scc));
+                solver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), scc));
             }
             if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-                this->sccSolver->setUpperBound(this->getUpperBound());
+                solver->setUpperBound(this->getUpperBound());
             } else if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-                this->sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), scc));
+                solver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), scc));
             }
             
             //std::cout << "rhs is " << storm::utility::vector::toString(sccB) << std::endl;
             //std::cout << "x is " << storm::utility::vector::toString(sccX) << std::endl;
             
-            bool returnvalue = this->sccSolver->solveEquations(sccSolverEnvironment, sccX, sccB);
+            bool returnvalue = solver->solveEquations(sccSolverEnvironment, sccX, sccB);
             storm::utility::vector::setVectorValues(globalX, scc, sccX);
             return returnvalue;
         }
@@ -241,6 +272,7 @@ namespace storm {
             sortedSccDecomposition.reset();
             longestSccChainSize = boost::none;
             sccSolver.reset();
+            directSccSolver.reset();
             LinearEquationSolver<ValueType>::clearCache();
         }
         
@@ -37,6 +37,9 @@ namespace storm {
 
             storm::Environment getEnvironmentForUnderlyingSolver(storm::Environment const& env, bool adaptPrecision = false) const;
             
+            // Retrieves the environment for SCCs that are small enough to be solved directly (via sparse LU factorization).
+            storm::Environment getEnvironmentForDirectSolver(storm::Environment const& env) const;
+            
             // Creates an SCC decomposition and sorts the SCCs according to a topological sort.
             void createSortedSccDecomposition(bool needLongestChainSize) const;
             
@@ -45,8 +48,8 @@ namespace storm {
             bool solveTrivialScc(uint64_t const& sccState, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const;
             // ... for the case that there is just one large SCC
             bool solveFullyConnectedEquationSystem(storm::Environment const& sccSolverEnvironment, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
-            // ... for the remaining cases (1 < scc.size() < x.size())
-            bool solveScc(storm::Environment const& sccSolverEnvironment, storm::storage::BitVector const& scc, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const;
+            // ... for the remaining cases (1 < scc.size() < x.size()). If useDirectSolver is set, the solver for small SCCs is used.
+            bool solveScc(storm::Environment const& sccSolverEnvironment, storm::storage::BitVector const& scc, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB, bool useDirectSolver = false) const;
 
             // If the solver takes posession of the matrix, we store the moved matrix in this member, so it gets deleted
             // when the solver is destructed.
@@ -60,6 +63,7 @@ namespace storm {
             mutable std::unique_ptr<storm::storage::StronglyConnectedComponentDecomposition<ValueType>> sortedSccDecomposition;
             mutable boost::optional<uint64_t> longestSccChainSize;
             mutable std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> sccSolver;
+            mutable std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> directSccSolver;
         };
         
         template<typename ValueType>
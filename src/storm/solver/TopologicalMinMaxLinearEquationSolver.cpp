@@ -2,6 +2,7 @@
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
+#include "storm/environment/solver/EigenSolverEnvironment.h"
 
 #include "storm/utility/constants.h"
 #include "storm/utility/vector.h"
@@ -42,6 +43,15 @@ namespace storm {
             }
             return subEnv;
         }
+        
+        template<typename ValueType>
+        storm::Environment TopologicalMinMaxLinearEquationSolver<ValueType>::getEnvironmentForDirectSolver(storm::Environment const& env) const {
+            storm::Environment subEnv(env);
+            subEnv.solver().minMax().setMethod(storm::solver::MinMaxMethod::PolicyIteration);
+            subEnv.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Eigen);
+            subEnv.solver().eigen().setMethod(storm::solver::EigenLinearEquationSolverMethod::SparseLU);
+            return subEnv;
+        }
 
         template<typename ValueType>
         bool TopologicalMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
@@ -68,10 +78,22 @@ namespace storm {
                 STORM_LOG_INFO("Longest SCC chain size is " << this->longestSccChainSize.get());
             }
             
+            // SCCs up to the given size are solved directly. As the result of the factorization is not guaranteed to be
+            // within the precision, we only do this if no sound results are required. Moreover, policy iteration can
+            // only be applied if the initial policy does not select an end component.
+            uint64_t directSccSize = 0;
+            if ((storm::NumberTraits<ValueType>::IsExact || !env.solver().isForceSoundness()) && (this->hasNoEndComponents() || this->hasInitialScheduler())) {
+                directSccSize = env.solver().topological().getDirectSccSize();
+            }
+            
             bool returnValue = true;
             if (this->sortedSccDecomposition->size() == 1) {
                 // Handle the case where there is just one large SCC
-                returnValue = solveFullyConnectedEquationSystem(sccSolverEnvironment, dir, x, b);
+                if (x.size() <= directSccSize) {
+                    returnValue = solveFullyConnectedEquationSystem(getEnvironmentForDirectSolver(env), dir, x, b);
+                } else {
+                    returnValue = solveFullyConnectedEquationSystem(sccSolverEnvironment, dir, x, b);
+                }
             } else {
                 // Solve each SCC individually
                 if (this->isTrackSchedulerSet()) {
@@ -81,6 +103,9 @@ namespace storm {
                         this->schedulerChoices = std::vector<uint64_t>(x.size());
                     }
                 }
+                storm::Environment directSolverEnvironment = getEnvironmentForDirectSolver(env);
+                uint64_t numberOfTrivialSccs = 0;
+                uint64_t numberOfDirectlySolvedSccs = 0;
                 storm::storage::BitVector sccRowGroupsAsBitVector(x.size(), false);
                 storm::storage::BitVector sccRowsAsBitVector(b.size(), false);
                 uint64_t sccIndex = 0;
@@ -90,6 +115,7 @@ namespace storm {
                 for (auto const& scc : *this->sortedSccDecomposition) {
                     if (scc.size() == 1) {
                         returnValue = solveTrivialScc(*scc.begin(), dir, x, b) && returnValue;
+                        ++numberOfTrivialSccs;
                     } else {
                         STORM_LOG_TRACE("Solving SCC of size " << scc.size() << ".");
                         sccRowGroupsAsBitVector.clear();
@@ -100,7 +126,12 @@ namespace storm {
                                 sccRowsAsBitVector.set(row, true);
                             }
                         }
-                        returnValue = solveScc(sccSolverEnvironment, dir, sccRowGroupsAsBitVector, sccRowsAsBitVector, x, b) && returnValue;
+                        if (scc.size() <= directSccSize) {
+                            returnValue = solveScc(directSolverEnvironment, dir, sccRowGroupsAsBitVector, sccRowsAsBitVector, x, b, true) && returnValue;
+                            ++numberOfDirectlySolvedSccs;
+                        } else {
+                            returnValue = solveScc(sccSolverEnvironment, dir, sccRowGroupsAsBitVector, sccRowsAsBitVector, x, b) && returnValue;
+                        }
                     }
                     ++sccIndex;
                     progress.updateProgress(sccIndex);
@@ -109,6 +140,7 @@ namespace storm {
                         break;
                     }
                 }
+                STORM_LOG_INFO("Solved " << numberOfTrivialSccs << " trivial SCC(s) in closed form, " << numberOfDirectlySolvedSccs << " SCC(s) directly, and " << (sccIndex - numberOfTrivialSccs - numberOfDirectlySolvedSccs) << " SCC(s) with the underlying solver.");
                 
                 // If requested, we store the scheduler for retrieval.
                 if (this->isTrackSchedulerSet()) {
@@ -230,21 +262,22 @@ namespace storm {
         }
         
         template<typename ValueType>
-        bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment, OptimizationDirection dir, storm::storage::BitVector const& sccRowGroups, storm::storage::BitVector const& sccRows, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const {
+        bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment, OptimizationDirection dir, storm::storage::BitVector const& sccRowGroups, storm::storage::BitVector const& sccRows, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB, bool useDirectSolver) const {
             
             // Set up the SCC solver
-            if (!this->sccSolver) {
-                this->sccSolver = GeneralMinMaxLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
-                this->sccSolver->setCachingEnabled(true);
+            auto& solver = useDirectSolver ? this->directSccSolver : this->sccSolver;
+            if (!solver) {
+                solver = GeneralMinMaxLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
+                solver->setCachingEnabled(true);
             }
-            this->sccSolver->setHasUniqueSolution(this->hasUniqueSolution());
-            this->sccSolver->setHasNoEndComponents(this->hasNoEndComponents());
-            this->sccSolver->setTrackScheduler(this->isTrackSchedulerSet());
+            solver->setHasUniqueSolution(this->hasUniqueSolution());
+            solver->setHasNoEndComponents(this->hasNoEndComponents());
+            solver->setTrackScheduler(this->isTrackSchedulerSet());
             
             // SCC Matrix
             storm::storage::SparseMatrix<ValueType> sccA = this->A->getSubmatrix(true, sccRowGroups, sccRowGroups);
             //std::cout << "Matrix is " << sccA << std::endl;
-            this->sccSolver->setMatrix(std::move(sccA));
+            solver->setMatrix(std::move(sccA));
             
             // x Vector
             auto sccX = storm::utility::vector::filterVector(globalX, sccRowGroups);
@@ -265,23 +298,23 @@ namespace storm {
             // initial scheduler
             if (this->hasInitialScheduler()) {
                 auto sccInitChoices = storm::utility::vector::filterVector(this->getInitialScheduler(), sccRowGroups);
-                this->sccSolver->setInitialScheduler(std::move(sccInitChoices));
+                solver->setInitialScheduler(std::move(sccInitChoices));
             }
             
             // lower/upper bounds
             if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-                this->sccSolver->setLowerBound(this->getLowerBound());
+                solver->setLowerBound(this->getLowerBound());
             } else if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-                this->sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), sccRowGroups));
+                solver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), sccRowGroups));
             }
             if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-                this->sccSolver->setUpperBound(this->getUpperBound());
+                solver->setUpperBound(this->getUpperBound());
             } else if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-                this->sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), sccRowGroups));
+                solver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), sccRowGroups));
             }
             
             // Requirements
-            auto req = this->sccSolver->getRequirements(sccSolverEnvironment, dir);
+            auto req = solver->getRequirements(sccSolverEnvironment, dir);
             if (req.upperBounds() && this->hasUpperBound()) {
                 req.clearUpperBounds();
             }
@@ -295,16 +328,16 @@ namespace storm {
                 req.clearUniqueSolution();
             }
             STORM_LOG_THROW(!req.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException, "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
-            this->sccSolver->setRequirementsChecked(true);
+            solver->setRequirementsChecked(true);
 
             // Invoke scc solver
-            bool res = this->sccSolver->solveEquations(sccSolverEnvironment, dir, sccX, sccB);
+            bool res = solver->solveEquations(sccSolverEnvironment, dir, sccX, sccB);
             //std::cout << "rhs is " << storm::utility::vector::toString(sccB) << std::endl;
             //std::cout << "x is " << storm::utility::vector::toString(sccX) << std::endl;
             
             // Set Scheduler choices
             if (this->isTrackSchedulerSet()) {
-                storm::utility::vector::setVectorValues(this->schedulerChoices.get(), sccRowGroups, this->sccSolver->getSchedulerChoices());
+                storm::utility::vector::setVectorValues(this->schedulerChoices.get(), sccRowGroups, solver->getSchedulerChoices());
             }
             
             // Set solution
@@ -324,6 +357,7 @@ namespace storm {
             sortedSccDecomposition.reset();
             longestSccChainSize = boost::none;
             sccSolver.reset();
+            directSccSolver.reset();
             auxiliaryRowGroupVector.reset();
             StandardMinMaxLinearEquationSolver<ValueType>::clearCache();
         }
@@ -32,6 +32,9 @@ namespace storm {
         private:
             storm::Environment getEnvironmentForUnderlyingSolver(storm::Environment const& env, bool adaptPrecision = false) const;
 
+            // Retrieves the environment for SCCs that are small enough to be solved directly (via policy iteration with sparse LU factorization).
+            storm::Environment getEnvironmentForDirectSolver(storm::Environment const& env) const;
+
             // Creates an SCC decomposition and sorts the SCCs according to a topological sort.
             void createSortedSccDecomposition(bool needLongestChainSize) const;
 
@@ -40,13 +43,14 @@ namespace storm {
             bool solveTrivialScc(uint64_t const& sccState, OptimizationDirection d, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const;
             // ... for the case that there is just one large SCC
             bool solveFullyConnectedEquationSystem(storm::Environment const& sccSolverEnvironment, OptimizationDirection d, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
-            // ... for the remaining cases (1 < scc.size() < x.size())
-            bool solveScc(storm::Environment const& sccSolverEnvironment, OptimizationDirection d, storm::storage::BitVector const& sccRowGroups, storm::storage::BitVector const& sccRows, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const;
+            // ... for the remaining cases (1 < scc.size() < x.size()). If useDirectSolver is set, the solver for small SCCs is used.
+            bool solveScc(storm::Environment const& sccSolverEnvironment, OptimizationDirection d, storm::storage::BitVector const& sccRowGroups, storm::storage::BitVector const& sccRows, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB, bool useDirectSolver = false) const;
 
             // cached auxiliary data
             mutable std::unique_ptr<storm::storage::StronglyConnectedComponentDecomposition<ValueType>> sortedSccDecomposition;
             mutable boost::optional<uint64_t> longestSccChainSize;
             mutable std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> sccSolver;
+            mutable std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> directSccSolver;
             mutable std::unique_ptr<std::vector<ValueType>> auxiliaryRowGroupVector; // A.rowGroupCount() entries
         };
     }
@@ -0,0 +1,232 @@
+#include "storm/storage/BitVectorTreeTable.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/OutOfRangeException.h"
+
+namespace storm {
+    namespace storage {
+
+        BitVectorTreeTable::BitVectorTreeTableIterator::BitVectorTreeTableIterator(BitVectorTreeTable const& table, uint64_t index) : table(table), index(index) {
+            // Intentionally left empty.
+        }
+
+        bool BitVectorTreeTable::BitVectorTreeTableIterator::operator==(BitVectorTreeTableIterator const& other) {
+            return &table == &other.table && index == other.index;
+        }
+
+        bool BitVectorTreeTable::BitVectorTreeTableIterator::operator!=(BitVectorTreeTableIterator const& other) {
+            return !(*this == other);
+        }
+
+        BitVectorTreeTable::BitVectorTreeTableIterator& BitVectorTreeTable::BitVectorTreeTableIterator::operator++(int) {
+            ++index;
+            return *this;
+        }
+
+        BitVectorTreeTable::BitVectorTreeTableIterator& BitVectorTreeTable::BitVectorTreeTableIterator::operator++() {
+            ++index;
+            return *this;
+        }
+
+        std::pair<storm::storage::BitVector, uint64_t> BitVectorTreeTable::BitVectorTreeTableIterator::operator*() const {
+            return std::make_pair(table.getBitVector(index), index);
+        }
+
+        BitVectorTreeTable::NodeTable::NodeTable() : keys(), buckets(1024, 0) {
+            // Intentionally left empty.
+        }
+
+        uint64_t BitVectorTreeTable::NodeTable::getInitialBucket(uint64_t key) const {
+            // Use the finalizer of MurmurHash3 to spread the (often small) keys over the buckets.
+            key ^= key >> 33;
+            key *= 0xff51afd7ed558ccdull;
+            key ^= key >> 33;
+            key *= 0xc4ceb9fe1a85ec53ull;
+            key ^= key >> 33;
+            return key & (buckets.size() - 1);
+        }
+
+        void BitVectorTreeTable::NodeTable::increaseSize() {
+            std::vector<uint32_t> newBuckets(buckets.size() * 2, 0);
+            buckets.swap(newBuckets);
+
+            for (uint64_t index = 0; index < keys.size(); ++index) {
+                uint64_t bucket = getInitialBucket(keys[index]);
+                while (buckets[bucket] != 0) {
+                    bucket = (bucket + 1) & (buckets.size() - 1);
+                }
+                buckets[bucket] = static_cast<uint32_t>(index + 1);
+            }
+        }
+
+        std::pair<uint64_t, bool> BitVectorTreeTable::NodeTable::findOrAdd(uint64_t key) {
+            // Keep the load factor below 0.75.
+            if (4 * (keys.size() + 1) > 3 * buckets.size()) {
+                increaseSize();
+            }
+
+            uint64_t bucket = getInitialBucket(key);
+            while (buckets[bucket] != 0) {
+                if (keys[buckets[bucket] - 1] == key) {
+                    return std::make_pair(static_cast<uint64_t>(buckets[bucket] - 1), false);
+                }
+                bucket = (bucket + 1) & (buckets.size() - 1);
+            }
+
+            STORM_LOG_THROW(keys.size() + 1 < std::numeric_limits<uint32_t>::max(), storm::exceptions::OutOfRangeException, "Too many distinct nodes for a single position of the tree table.");
+            keys.push_back(key);
+            buckets[bucket] = static_cast<uint32_t>(keys.size());
+            return std::make_pair(static_cast<uint64_t>(keys.size() - 1), true);
+        }
+
+        std::pair<bool, uint64_t> BitVectorTreeTable::NodeTable::find(uint64_t key) const {
+            uint64_t bucket = getInitialBucket(key);
+            while (buckets[bucket] != 0) {
+                if (keys[buckets[bucket] - 1] == key) {
+                    return std::make_pair(true, static_cast<uint64_t>(buckets[bucket] - 1));
+                }
+                bucket = (bucket + 1) & (buckets.size() - 1);
+            }
+            return std::make_pair(false, 0ull);
+        }
+
+        uint64_t BitVectorTreeTable::NodeTable::getKey(uint64_t index) const {
+            return keys[index];
+        }
+
+        uint64_t BitVectorTreeTable::NodeTable::size() const {
+            return keys.size();
+        }
+
+        uint64_t BitVectorTreeTable::NodeTable::getSizeInMemory() const {
+            return keys.capacity() * sizeof(uint64_t) + buckets.capacity() * sizeof(uint32_t);
+        }
+
+        BitVectorTreeTable::BitVectorTreeTable(uint64_t bitsPerBitVector) : bitsPerBitVector(bitsPerBitVector) {
+            uint64_t numberOfLeaves = std::max(static_cast<uint64_t>(1), (bitsPerBitVector + 63) / 64);
+            createPositions(0, numberOfLeaves);
+            tables.resize(positions.size());
+        }
+
+        uint64_t BitVectorTreeTable::createPositions(uint64_t firstLeaf, uint64_t lastLeaf) {
+            uint64_t position = positions.size();
+            positions.emplace_back();
+
+            if (lastLeaf - firstLeaf == 1) {
+                positions[position].isLeaf = true;
+                positions[position].leftChild = 0;
+                positions[position].rightChild = 0;
+                positions[position].bitOffset = firstLeaf * 64;
+                positions[position].bitWidth = std::min(static_cast<uint64_t>(64), bitsPerBitVector - std::min(bitsPerBitVector, firstLeaf * 64));
+            } else {
+                // Note that the recursive calls add positions, so we must not hold a reference to the current one.
+                uint64_t middleLeaf = firstLeaf + (lastLeaf - firstLeaf) / 2;
+                uint64_t leftChild = createPositions(firstLeaf, middleLeaf);
+                uint64_t rightChild = createPositions(middleLeaf, lastLeaf);
+                positions[position].isLeaf = false;
+                positions[position].leftChild = leftChild;
+                positions[position].rightChild = rightChild;
+                positions[position].bitOffset = 0;
+                positions[position].bitWidth = 0;
+            }
+            return position;
+        }
+
+        std::pair<uint64_t, bool> BitVectorTreeTable::findOrAddNode(uint64_t position, storm::storage::BitVector const& bitVector) {
+            Position const& currentPosition = positions[position];
+            if (currentPosition.isLeaf) {
+                uint64_t key = currentPosition.bitWidth == 0 ? 0 : bitVector.getAsInt(currentPosition.bitOffset, currentPosition.bitWidth);
+                return tables[position].findOrAdd(key);
+            }
+
+            uint64_t leftNode = findOrAddNode(currentPosition.leftChild, bitVector).first;
+            uint64_t rightNode = findOrAddNode(currentPosition.rightChild, bitVector).first;
+            return tables[position].findOrAdd((leftNode << 32) | rightNode);
+        }
+
+        std::pair<bool, uint64_t> BitVectorTreeTable::findNode(uint64_t position, storm::storage::BitVector const& bitVector) const {
+            Position const& currentPosition = positions[position];
+            if (currentPosition.isLeaf) {
+                uint64_t key = currentPosition.bitWidth == 0 ? 0 : bitVector.getAsInt(currentPosition.bitOffset, currentPosition.bitWidth);
+                return tables[position].find(key);
+            }
+
+            std::pair<bool, uint64_t> leftNode = findNode(currentPosition.leftChild, bitVector);
+            if (!leftNode.first) {
+                return leftNode;
+            }
+            std::pair<bool, uint64_t> rightNode = findNode(currentPosition.rightChild, bitVector);
+            if (!rightNode.first) {
+                return rightNode;
+            }
+            return tables[position].find((leftNode.second << 32) | rightNode.second);
+        }
+
+        void BitVectorTreeTable::reconstruct(uint64_t position, uint64_t node, storm::storage::BitVector& bitVector) const {
+            Position const& currentPosition = positions[position];
+            uint64_t key = tables[position].getKey(node);
+            if (currentPosition.isLeaf) {
+                if (currentPosition.bitWidth > 0) {
+                    bitVector.setFromInt(currentPosition.bitOffset, currentPosition.bitWidth, key);
+                }
+            } else {
+                reconstruct(currentPosition.leftChild, key >> 32, bitVector);
+                reconstruct(currentPosition.rightChild, key & 0xffffffffull, bitVector);
+            }
+        }
+
+        std::pair<uint64_t, bool> BitVectorTreeTable::findOrAdd(storm::storage::BitVector const& bitVector) {
+            STORM_LOG_ASSERT(bitVector.size() >= bitsPerBitVector, "Bit vector is too short for the tree table.");
+            return findOrAddNode(0, bitVector);
+        }
+
+        bool BitVectorTreeTable::contains(storm::storage::BitVector const& bitVector) const {
+            return findNode(0, bitVector).first;
+        }
+
+        uint64_t BitVectorTreeTable::getValue(storm::storage::BitVector const& bitVector) const {
+            std::pair<bool, uint64_t> result = findNode(0, bitVector);
+            STORM_LOG_ASSERT(result.first, "Unknown bit vector.");
+            return result.second;
+        }
+
+        storm::storage::BitVector BitVectorTreeTable::getBitVector(uint64_t index) const {
+            STORM_LOG_ASSERT(index < size(), "Index out of range.");
+            storm::storage::BitVector result(bitsPerBitVector);
+            reconstruct(0, index, result);
+            return result;
+        }
+
+        BitVectorTreeTable::const_iterator BitVectorTreeTable::begin() const {
+            return const_iterator(*this, 0);
+        }
+
+        BitVectorTreeTable::const_iterator BitVectorTreeTable::end() const {
+            return const_iterator(*this, size());
+        }
+
+        uint64_t BitVectorTreeTable::size() const {
+            return tables.front().size();
+        }
+
+        uint64_t BitVectorTreeTable::getNumberOfNodes() const {
+            uint64_t result = 0;
+            for (auto const& table : tables) {
+                result += table.size();
+            }
+            return result;
+        }
+
+        uint64_t BitVectorTreeTable::getSizeInMemory() const {
+            uint64_t result = sizeof(*this) + positions.capacity() * sizeof(Position);
+            for (auto const& table : tables) {
+                result += table.getSizeInMemory();
+            }
+            return result;
+        }
+
+    }
+}
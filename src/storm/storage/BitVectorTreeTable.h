@@ -0,0 +1,243 @@
+#ifndef STORM_STORAGE_BITVECTORTREETABLE_H_
+#define STORM_STORAGE_BITVECTORTREETABLE_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+    namespace storage {
+
+        /*!
+         * This class stores a set of bit vectors of a fixed length in a tree-compressed form (similar to the tree
+         * tables of LTSmin). Every bit vector is split into chunks of (at most) 64 bits that form the leaves of a
+         * balanced binary tree. Each position in the tree has its own table in which every distinct chunk (for leaves)
+         * or pair of child indices (for inner nodes) is stored only once. Bit vectors that agree on large parts
+         * therefore share most of their nodes and only require a few additional entries. The bit vectors are
+         * identified by the index of their root node, i.e. they are numbered consecutively in the order of insertion.
+         */
+        class BitVectorTreeTable {
+        public:
+            class BitVectorTreeTableIterator {
+            public:
+                /*!
+                 * Creates an iterator that points to the bit vector with the given index in the given table.
+                 *
+                 * @param table The table of the iterator.
+                 * @param index The index of the bit vector the iterator points to.
+                 */
+                BitVectorTreeTableIterator(BitVectorTreeTable const& table, uint64_t index);
+
+                // Methods to compare two iterators.
+                bool operator==(BitVectorTreeTableIterator const& other);
+                bool operator!=(BitVectorTreeTableIterator const& other);
+
+                // Methods to move iterator forward.
+                BitVectorTreeTableIterator& operator++(int);
+                BitVectorTreeTableIterator& operator++();
+
+                // Method to retrieve the currently pointed-to bit vector and its index.
+                std::pair<storm::storage::BitVector, uint64_t> operator*() const;
+
+            private:
+                // The table this iterator refers to.
+                BitVectorTreeTable const& table;
+
+                // The index of the bit vector this iterator points to.
+                uint64_t index;
+            };
+
+            typedef BitVectorTreeTableIterator const_iterator;
+
+            /*!
+             * Creates an empty table for bit vectors of the given length.
+             *
+             * @param bitsPerBitVector The number of bits of the bit vectors that are stored.
+             */
+            BitVectorTreeTable(uint64_t bitsPerBitVector);
+
+            BitVectorTreeTable(BitVectorTreeTable const&) = default;
+            BitVectorTreeTable(BitVectorTreeTable&&) = default;
+            BitVectorTreeTable& operator=(BitVectorTreeTable const&) = default;
+            BitVectorTreeTable& operator=(BitVectorTreeTable&&) = default;
+
+            /*!
+             * Searches for the given bit vector in the table and inserts it if it is not yet contained.
+             *
+             * @param bitVector The bit vector to search or insert.
+             * @return A pair whose first component is the index of the bit vector and whose second component indicates
+             * whether the bit vector was newly inserted.
+             */
+            std::pair<uint64_t, bool> findOrAdd(storm::storage::BitVector const& bitVector);
+
+            /*!
+             * Checks whether the given bit vector is contained in the table.
+             *
+             * @param bitVector The bit vector to search.
+             * @return True iff the bit vector is contained in the table.
+             */
+            bool contains(storm::storage::BitVector const& bitVector) const;
+
+            /*!
+             * Retrieves the index of the given bit vector. If the bit vector is not contained, the behaviour is
+             * undefined.
+             *
+             * @param bitVector The bit vector to search.
+             * @return The index of the bit vector.
+             */
+            uint64_t getValue(storm::storage::BitVector const& bitVector) const;
+
+            /*!
+             * Reconstructs the bit vector with the given index.
+             *
+             * @param index The index of the bit vector. This must be smaller than the size of the table.
+             * @return The bit vector with the given index.
+             */
+            storm::storage::BitVector getBitVector(uint64_t index) const;
+
+            /*!
+             * Retrieves an iterator to the bit vectors in the table (in the order of their indices).
+             *
+             * @return The iterator.
+             */
+            const_iterator begin() const;
+
+            /*!
+             * Retrieves an iterator that points one past the bit vectors in the table.
+             *
+             * @return The iterator.
+             */
+            const_iterator end() const;
+
+            /*!
+             * Retrieves the number of bit vectors stored in the table.
+             *
+             * @return The number of bit vectors.
+             */
+            uint64_t size() const;
+
+            /*!
+             * Retrieves the total number of nodes over all positions of the tree.
+             *
+             * @return The number of nodes.
+             */
+            uint64_t getNumberOfNodes() const;
+
+            /*!
+             * Retrieves the (approximate) number of bytes occupied by the table.
+             *
+             * @return The number of bytes.
+             */
+            uint64_t getSizeInMemory() const;
+
+        private:
+            /*!
+             * A hash set of 64-bit keys that assigns consecutive indices to its keys. It uses open addressing with
+             * linear probing and stores only the keys (indexed by their indices) and the index per bucket.
+             */
+            class NodeTable {
+            public:
+                NodeTable();
+
+                /*!
+                 * Searches for the given key and inserts it if it is not yet contained.
+                 *
+                 * @return The index of the key and whether the key was newly inserted.
+                 */
+                std::pair<uint64_t, bool> findOrAdd(uint64_t key);
+
+                /*!
+                 * Searches for the given key.
+                 *
+                 * @return A pair whose first component indicates whether the key was found and whose second component
+                 * is the index of the key (if it was found).
+                 */
+                std::pair<bool, uint64_t> find(uint64_t key) const;
+
+                /*!
+                 * Retrieves the key with the given index.
+                 */
+                uint64_t getKey(uint64_t index) const;
+
+                /*!
+                 * Retrieves the number of keys in the table.
+                 */
+                uint64_t size() const;
+
+                /*!
+                 * Retrieves the (approximate) number of bytes occupied by the table.
+                 */
+                uint64_t getSizeInMemory() const;
+
+            private:
+                /*!
+                 * Retrieves the bucket in which the search for the given key starts.
+                 */
+                uint64_t getInitialBucket(uint64_t key) const;
+
+                /*!
+                 * Doubles the number of buckets and reinserts all keys.
+                 */
+                void increaseSize();
+
+                // The keys in the order of their indices.
+                std::vector<uint64_t> keys;
+
+                // The buckets of the table. A bucket stores the index of its key plus one or zero if it is empty.
+                std::vector<uint32_t> buckets;
+            };
+
+            // A position in the tree. Leaves cover a chunk of the bits, inner nodes have two children.
+            struct Position {
+                // The child positions (only relevant for inner nodes).
+                uint64_t leftChild;
+                uint64_t rightChild;
+
+                // The chunk of the bit vector that is covered by the leaf (only relevant for leaves).
+                uint64_t bitOffset;
+                uint64_t bitWidth;
+
+                bool isLeaf;
+            };
+
+            /*!
+             * Creates the positions for the leaves in the given range and returns the position of their root.
+             */
+            uint64_t createPositions(uint64_t firstLeaf, uint64_t lastLeaf);
+
+            /*!
+             * Computes the key of the given position that corresponds to the given bit vector and inserts the nodes
+             * of the subtree if necessary.
+             *
+             * @return The index of the node and whether it was newly inserted.
+             */
+            std::pair<uint64_t, bool> findOrAddNode(uint64_t position, storm::storage::BitVector const& bitVector);
+
+            /*!
+             * Searches for the node of the given position that corresponds to the given bit vector.
+             *
+             * @return A pair whose first component indicates whether the node was found and whose second component
+             * is the index of the node (if it was found).
+             */
+            std::pair<bool, uint64_t> findNode(uint64_t position, storm::storage::BitVector const& bitVector) const;
+
+            /*!
+             * Writes the bits of the subtree with the given node at the given position to the bit vector.
+             */
+            void reconstruct(uint64_t position, uint64_t node, storm::storage::BitVector& bitVector) const;
+
+            // The number of bits of the stored bit vectors.
+            uint64_t bitsPerBitVector;
+
+            // The positions of the tree. The root is stored at position zero.
+            std::vector<Position> positions;
+
+            // The node tables of the positions.
+            std::vector<NodeTable> tables;
+        };
+
+    }
+}
+
+#endif /* STORM_STORAGE_BITVECTORTREETABLE_H_ */
@@ -0,0 +1,152 @@
+#include "storm/storage/CompressedSparseMatrix.h"
+
+#include "storm/utility/macros.h"
+#include "storm/utility/vector.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace storage {
+
+        template<typename ValueType>
+        const uint64_t CompressedSparseMatrix<ValueType>::maximalNumberOfDistinctValues;
+
+        template<typename ValueType>
+        CompressedSparseMatrix<ValueType>::CompressedSparseMatrix(SparseMatrix<ValueType> const& matrix) : CompressedSparseMatrix(matrix, std::map<ValueType, uint64_t>()) {
+            // Intentionally left empty.
+        }
+
+        template<typename ValueType>
+        boost::optional<CompressedSparseMatrix<ValueType>> CompressedSparseMatrix<ValueType>::compress(SparseMatrix<ValueType> const& matrix) {
+            std::map<ValueType, uint64_t> valueToCode;
+            if (!collectValues(matrix, valueToCode)) {
+                return boost::none;
+            }
+            return CompressedSparseMatrix<ValueType>(matrix, std::move(valueToCode));
+        }
+
+        template<typename ValueType>
+        bool CompressedSparseMatrix<ValueType>::collectValues(SparseMatrix<ValueType> const& matrix, std::map<ValueType, uint64_t>& valueToCode) {
+            for (auto const& entry : matrix) {
+                if (valueToCode.emplace(entry.getValue(), 0).second && valueToCode.size() > maximalNumberOfDistinctValues) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        template<typename ValueType>
+        CompressedSparseMatrix<ValueType>::CompressedSparseMatrix(SparseMatrix<ValueType> const& matrix, std::map<ValueType, uint64_t>&& valueToCode) : rowCount(matrix.getRowCount()), columnCount(matrix.getColumnCount()), entryCount(matrix.getEntryCount()), trivialRowGrouping(matrix.hasTrivialRowGrouping()) {
+            // Build the dictionary (unless this was already done by the caller). The codes are assigned in the order
+            // of the values.
+            if (valueToCode.empty()) {
+                STORM_LOG_THROW(collectValues(matrix, valueToCode), storm::exceptions::InvalidArgumentException, "Unable to compress a matrix with more than " << maximalNumberOfDistinctValues << " distinct values.");
+            }
+            dictionary.reserve(valueToCode.size());
+            for (auto& valueCodePair : valueToCode) {
+                valueCodePair.second = dictionary.size();
+                dictionary.push_back(valueCodePair.first);
+            }
+            wideCodes = dictionary.size() > (1ull << 8);
+            if (!trivialRowGrouping) {
+                auto const& groups = matrix.getRowGroupIndices();
+                rowGroupIndices = std::vector<uint64_t>(groups.begin(), groups.end());
+            }
+
+            // Encode the entries row by row.
+            rowOffsets.reserve(rowCount + 1);
+            data.reserve(entryCount * (wideCodes ? 3 : 2));
+            for (uint64_t row = 0; row < rowCount; ++row) {
+                rowOffsets.push_back(data.size());
+                uint64_t previousColumn = 0;
+                for (auto const& entry : matrix.getRow(row)) {
+                    STORM_LOG_ASSERT(entry.getColumn() >= previousColumn, "The columns of row " << row << " are not sorted.");
+                    uint64_t delta = entry.getColumn() - previousColumn;
+                    previousColumn = entry.getColumn();
+                    while (delta >= 0x80) {
+                        data.push_back(static_cast<uint8_t>(delta & 0x7f) | 0x80);
+                        delta >>= 7;
+                    }
+                    data.push_back(static_cast<uint8_t>(delta));
+                    uint64_t code = valueToCode[entry.getValue()];
+                    data.push_back(static_cast<uint8_t>(code & 0xff));
+                    if (wideCodes) {
+                        data.push_back(static_cast<uint8_t>(code >> 8));
+                    }
+                }
+            }
+            rowOffsets.push_back(data.size());
+            data.shrink_to_fit();
+            STORM_LOG_DEBUG("Compressed matrix with " << entryCount << " entries and " << dictionary.size() << " distinct values to " << getSizeInMemory() << " bytes.");
+        }
+
+        template<typename ValueType>
+        uint64_t CompressedSparseMatrix<ValueType>::getRowCount() const {
+            return rowCount;
+        }
+
+        template<typename ValueType>
+        uint64_t CompressedSparseMatrix<ValueType>::getColumnCount() const {
+            return columnCount;
+        }
+
+        template<typename ValueType>
+        uint64_t CompressedSparseMatrix<ValueType>::getEntryCount() const {
+            return entryCount;
+        }
+
+        template<typename ValueType>
+        bool CompressedSparseMatrix<ValueType>::hasTrivialRowGrouping() const {
+            return trivialRowGrouping;
+        }
+
+        template<typename ValueType>
+        std::vector<uint64_t> const& CompressedSparseMatrix<ValueType>::getRowGroupIndices() const {
+            if (!rowGroupIndices) {
+                STORM_LOG_ASSERT(trivialRowGrouping, "Only trivial row-groupings can be constructed on-the-fly.");
+                rowGroupIndices = storm::utility::vector::buildVectorForRange<uint64_t>(0, rowCount + 1);
+            }
+            return rowGroupIndices.get();
+        }
+
+        template<typename ValueType>
+        uint64_t CompressedSparseMatrix<ValueType>::getNumberOfDistinctValues() const {
+            return dictionary.size();
+        }
+
+        template<typename ValueType>
+        uint64_t CompressedSparseMatrix<ValueType>::getSizeInMemory() const {
+            uint64_t result = sizeof(*this) + dictionary.capacity() * sizeof(ValueType) + rowOffsets.capacity() * sizeof(uint64_t) + data.capacity();
+            if (!trivialRowGrouping) {
+                result += rowGroupIndices->capacity() * sizeof(uint64_t);
+            }
+            return result;
+        }
+
+        template<typename ValueType>
+        std::vector<typename CompressedSparseMatrix<ValueType>::EntryType> CompressedSparseMatrix<ValueType>::getRow(uint64_t row) const {
+            std::vector<EntryType> result;
+            forEachEntryInRow(row, [&result] (uint64_t column, ValueType const& value) { result.emplace_back(column, value); });
+            return result;
+        }
+
+        template<typename ValueType>
+        SparseMatrix<ValueType> CompressedSparseMatrix<ValueType>::decompress() const {
+            uint64_t rowGroupCount = trivialRowGrouping ? 0 : rowGroupIndices->size() - 1;
+            SparseMatrixBuilder<ValueType> builder(rowCount, columnCount, entryCount, true, !trivialRowGrouping, rowGroupCount);
+            uint64_t group = 0;
+            for (uint64_t row = 0; row < rowCount; ++row) {
+                if (!trivialRowGrouping) {
+                    while (group < rowGroupCount && rowGroupIndices.get()[group] == row) {
+                        builder.newRowGroup(row);
+                        ++group;
+                    }
+                }
+                forEachEntryInRow(row, [&builder, row] (uint64_t column, ValueType const& value) { builder.addNextValue(row, column, value); });
+            }
+            return builder.build();
+        }
+
+        template class CompressedSparseMatrix<double>;
+
+    }
+}
@@ -0,0 +1,170 @@
+#ifndef STORM_STORAGE_COMPRESSEDSPARSEMATRIX_H_
+#define STORM_STORAGE_COMPRESSEDSPARSEMATRIX_H_
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/constants.h"
+
+namespace storm {
+    namespace storage {
+
+        /*!
+         * A read-only representation of a sparse matrix that exploits that (typically) only few distinct values occur
+         * in the matrix. Every distinct value is stored once in a dictionary and the entries refer to it via codes of
+         * one or two bytes. The columns of a row are stored as variable-length encoded differences to the previous
+         * column of the row (the first column of a row is stored as is). Both are interleaved in a single byte stream,
+         * so a row can be decoded by a single forward pass.
+         *
+         * The compressed matrix keeps the row grouping of the original matrix and can be decompressed again, which
+         * allows owners of a matrix to release the original after compressing it.
+         */
+        template<typename ValueType>
+        class CompressedSparseMatrix {
+        public:
+            typedef MatrixEntry<typename SparseMatrix<ValueType>::index_type, ValueType> EntryType;
+
+            // The maximal number of distinct values that can be encoded.
+            static const uint64_t maximalNumberOfDistinctValues = 1ull << 16;
+
+            /*!
+             * Creates a compressed copy of the given matrix.
+             *
+             * @param matrix The matrix to compress. It must not have more than 2^16 distinct values.
+             */
+            CompressedSparseMatrix(SparseMatrix<ValueType> const& matrix);
+
+            /*!
+             * Creates a compressed copy of the given matrix if it has few enough distinct values. The dictionary is
+             * collected only once, i.e., checking the compressibility does not require an additional pass.
+             *
+             * @param matrix The matrix to compress.
+             * @return The compressed matrix or none if the matrix has more than 2^16 distinct values.
+             */
+            static boost::optional<CompressedSparseMatrix<ValueType>> compress(SparseMatrix<ValueType> const& matrix);
+
+            uint64_t getRowCount() const;
+            uint64_t getColumnCount() const;
+            uint64_t getEntryCount() const;
+
+            /*!
+             * Retrieves whether the matrix has a trivial row grouping.
+             */
+            bool hasTrivialRowGrouping() const;
+
+            /*!
+             * Retrieves the row group indices of the matrix. For a trivial row grouping, they are constructed on-the-fly.
+             */
+            std::vector<uint64_t> const& getRowGroupIndices() const;
+
+            /*!
+             * Retrieves the number of distinct values of the matrix, i.e., the size of the dictionary.
+             */
+            uint64_t getNumberOfDistinctValues() const;
+
+            /*!
+             * Retrieves the (approximate) number of bytes used to store the matrix.
+             */
+            uint64_t getSizeInMemory() const;
+
+            /*!
+             * Decodes the entries of the given row.
+             */
+            std::vector<EntryType> getRow(uint64_t row) const;
+
+            /*!
+             * Computes the scalar product of the given row and the given vector.
+             */
+            ValueType multiplyRowWithVector(uint64_t row, std::vector<ValueType> const& vector) const;
+
+            /*!
+             * Reconstructs the (uncompressed) matrix including its row grouping.
+             */
+            SparseMatrix<ValueType> decompress() const;
+
+        private:
+            /*!
+             * Compresses the given matrix using the given (complete) mapping of its values to their codes.
+             */
+            CompressedSparseMatrix(SparseMatrix<ValueType> const& matrix, std::map<ValueType, uint64_t>&& valueToCode);
+
+            /*!
+             * Collects the distinct values of the given matrix. Stops as soon as there are more values than can be
+             * encoded.
+             *
+             * @return True iff all values of the matrix were collected.
+             */
+            static bool collectValues(SparseMatrix<ValueType> const& matrix, std::map<ValueType, uint64_t>& valueToCode);
+
+            /*!
+             * Decodes the entries of the given row and calls the given function with the column and value of each entry.
+             */
+            template<typename Function>
+            void forEachEntryInRow(uint64_t row, Function const& function) const;
+
+            // The number of rows and columns of the matrix.
+            uint64_t rowCount;
+            uint64_t columnCount;
+
+            // The number of (stored) entries of the matrix.
+            uint64_t entryCount;
+
+            // Whether the matrix has a trivial row grouping.
+            bool trivialRowGrouping;
+
+            // The row group indices of the matrix. For a trivial row grouping, they are only built on demand.
+            mutable boost::optional<std::vector<uint64_t>> rowGroupIndices;
+
+            // The distinct values of the matrix. Entries refer to their value by the index in this vector.
+            std::vector<ValueType> dictionary;
+
+            // Whether the codes of the values take two bytes (instead of one).
+            bool wideCodes;
+
+            // The position of the first byte of each row in the data (plus the total number of bytes).
+            std::vector<uint64_t> rowOffsets;
+
+            // The encoded entries. Each entry consists of its column difference (7 bits per byte, the highest bit
+            // indicates that more bytes follow) and the code of its value (little endian).
+            std::vector<uint8_t> data;
+        };
+
+        template<typename ValueType>
+        template<typename Function>
+        inline void CompressedSparseMatrix<ValueType>::forEachEntryInRow(uint64_t row, Function const& function) const {
+            uint8_t const* it = data.data() + rowOffsets[row];
+            uint8_t const* ite = data.data() + rowOffsets[row + 1];
+            uint64_t column = 0;
+            while (it != ite) {
+                uint64_t delta = *it & 0x7f;
+                for (uint64_t shift = 7; *it & 0x80; shift += 7) {
+                    ++it;
+                    delta |= static_cast<uint64_t>(*it & 0x7f) << shift;
+                }
+                ++it;
+                column += delta;
+                uint64_t code = *it;
+                ++it;
+                if (wideCodes) {
+                    code |= static_cast<uint64_t>(*it) << 8;
+                    ++it;
+                }
+                function(column, dictionary[code]);
+            }
+        }
+
+        template<typename ValueType>
+        inline ValueType CompressedSparseMatrix<ValueType>::multiplyRowWithVector(uint64_t row, std::vector<ValueType> const& vector) const {
+            ValueType result = storm::utility::zero<ValueType>();
+            forEachEntryInRow(row, [&result, &vector] (uint64_t column, ValueType const& value) { result += value * vector[column]; });
+            return result;
+        }
+
+    }
+}
+
+#endif /* STORM_STORAGE_COMPRESSEDSPARSEMATRIX_H_ */
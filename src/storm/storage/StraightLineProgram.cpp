@@ -0,0 +1,161 @@
+#include "storm/storage/StraightLineProgram.h"
+
+#include <algorithm>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/stateelimination.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace storage {
+
+        template<typename ValueType>
+        StraightLineProgram<ValueType>::StraightLineProgram(uint64_t maximalFoldingComplexity) : maximalFoldingComplexity(maximalFoldingComplexity) {
+            addConstant(storm::utility::zero<ValueType>());
+            addConstant(storm::utility::one<ValueType>());
+        }
+
+        template<typename ValueType>
+        uint64_t StraightLineProgram<ValueType>::getZero() const {
+            return 0;
+        }
+
+        template<typename ValueType>
+        uint64_t StraightLineProgram<ValueType>::getOne() const {
+            return 1;
+        }
+
+        template<typename ValueType>
+        uint64_t StraightLineProgram<ValueType>::addConstant(ValueType const& value) {
+            // Keep the zero and one nodes unique, so the trivial operations can be detected by the node index.
+            if (nodes.size() >= 2) {
+                if (storm::utility::isZero(value)) {
+                    return getZero();
+                } else if (storm::utility::isOne(value)) {
+                    return getOne();
+                }
+            }
+            nodes.push_back({OperationType::Constant, constants.size(), 0});
+            constants.push_back(value);
+            return nodes.size() - 1;
+        }
+
+        template<typename ValueType>
+        uint64_t StraightLineProgram<ValueType>::add(uint64_t first, uint64_t second) {
+            if (isZero(first)) {
+                return second;
+            } else if (isZero(second)) {
+                return first;
+            }
+            return getOrAddOperation(OperationType::Add, std::min(first, second), std::max(first, second));
+        }
+
+        template<typename ValueType>
+        uint64_t StraightLineProgram<ValueType>::subtract(uint64_t first, uint64_t second) {
+            if (isZero(second)) {
+                return first;
+            } else if (first == second) {
+                return getZero();
+            }
+            return getOrAddOperation(OperationType::Subtract, first, second);
+        }
+
+        template<typename ValueType>
+        uint64_t StraightLineProgram<ValueType>::multiply(uint64_t first, uint64_t second) {
+            if (isZero(first) || isZero(second)) {
+                return getZero();
+            } else if (isOne(first)) {
+                return second;
+            } else if (isOne(second)) {
+                return first;
+            }
+            return getOrAddOperation(OperationType::Multiply, std::min(first, second), std::max(first, second));
+        }
+
+        template<typename ValueType>
+        uint64_t StraightLineProgram<ValueType>::divide(uint64_t first, uint64_t second) {
+            STORM_LOG_ASSERT(!isZero(second), "Division by zero.");
+            if (isZero(first) || isOne(second)) {
+                return first;
+            } else if (first == second) {
+                return getOne();
+            }
+            return getOrAddOperation(OperationType::Divide, first, second);
+        }
+
+        template<typename ValueType>
+        uint64_t StraightLineProgram<ValueType>::getOrAddOperation(OperationType type, uint64_t first, uint64_t second) {
+            // If both operands are constants that are cheap to combine, we do so directly.
+            if (isConstant(first) && isConstant(second)) {
+                ValueType const& firstValue = getConstant(first);
+                ValueType const& secondValue = getConstant(second);
+                if (storm::utility::stateelimination::estimateComplexity(firstValue) * storm::utility::stateelimination::estimateComplexity(secondValue) <= maximalFoldingComplexity) {
+                    switch (type) {
+                        case OperationType::Add:
+                            return addConstant(storm::utility::simplify(ValueType(firstValue + secondValue)));
+                        case OperationType::Subtract:
+                            return addConstant(storm::utility::simplify(ValueType(firstValue - secondValue)));
+                        case OperationType::Multiply:
+                            return addConstant(storm::utility::simplify(ValueType(firstValue * secondValue)));
+                        case OperationType::Divide:
+                            return addConstant(storm::utility::simplify(ValueType(firstValue / secondValue)));
+                        case OperationType::Constant:
+                            STORM_LOG_ASSERT(false, "Constants are not operations.");
+                    }
+                }
+            }
+
+            auto key = std::make_tuple(type, first, second);
+            auto it = operationToNode.find(key);
+            if (it != operationToNode.end()) {
+                return it->second;
+            }
+            nodes.push_back({type, first, second});
+            operationToNode[key] = nodes.size() - 1;
+            return nodes.size() - 1;
+        }
+
+        template<typename ValueType>
+        uint64_t StraightLineProgram<ValueType>::getNumberOfNodes() const {
+            return nodes.size();
+        }
+
+        template<typename ValueType>
+        bool StraightLineProgram<ValueType>::isConstant(uint64_t node) const {
+            return nodes[node].type == OperationType::Constant;
+        }
+
+        template<typename ValueType>
+        ValueType const& StraightLineProgram<ValueType>::getConstant(uint64_t node) const {
+            STORM_LOG_ASSERT(isConstant(node), "Node " << node << " is not a constant.");
+            return constants[nodes[node].firstOperand];
+        }
+
+        template<typename ValueType>
+        bool StraightLineProgram<ValueType>::isZero(uint64_t node) const {
+            return node == getZero();
+        }
+
+        template<typename ValueType>
+        bool StraightLineProgram<ValueType>::isOne(uint64_t node) const {
+            return node == getOne();
+        }
+
+        template<typename ValueType>
+        std::vector<ValueType> StraightLineProgram<ValueType>::toValues(std::vector<uint64_t> const& resultNodes) const {
+            std::vector<ValueType> result = evaluate<ValueType>(resultNodes, [] (ValueType const& value) { return value; });
+            for (auto& value : result) {
+                value = storm::utility::simplify(value);
+            }
+            return result;
+        }
+
+        template class StraightLineProgram<double>;
+
+#ifdef STORM_HAVE_CARL
+        template class StraightLineProgram<storm::RationalNumber>;
+        template class StraightLineProgram<storm::RationalFunction>;
+#endif
+    }
+}
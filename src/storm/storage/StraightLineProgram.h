@@ -0,0 +1,135 @@
+#ifndef STORM_STORAGE_STRAIGHTLINEPROGRAM_H_
+#define STORM_STORAGE_STRAIGHTLINEPROGRAM_H_
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <tuple>
+#include <vector>
+
+namespace storm {
+    namespace storage {
+
+        /*!
+         * A straight-line program, i.e., a sequence of arithmetic operations whose operands are constants or results of
+         * earlier operations. Equal operations are only stored once, so the program represents values as a shared DAG
+         * rather than as (fully expanded) expressions. Operations on constants are only carried out if this is cheap,
+         * e.g., if the constants are numbers rather than (complex) rational functions.
+         */
+        template<typename ValueType>
+        class StraightLineProgram {
+        public:
+            enum class OperationType { Constant, Add, Subtract, Multiply, Divide };
+
+            /*!
+             * Creates an empty program (containing only the constants zero and one).
+             *
+             * @param maximalFoldingComplexity The operations on two constants whose estimated complexity (product) is at
+             * most this value are carried out directly instead of being stored in the program.
+             */
+            StraightLineProgram(uint64_t maximalFoldingComplexity = 16);
+
+            uint64_t getZero() const;
+            uint64_t getOne() const;
+
+            uint64_t addConstant(ValueType const& value);
+            uint64_t add(uint64_t first, uint64_t second);
+            uint64_t subtract(uint64_t first, uint64_t second);
+            uint64_t multiply(uint64_t first, uint64_t second);
+            uint64_t divide(uint64_t first, uint64_t second);
+
+            /*!
+             * Retrieves the number of nodes (constants and operations) of the program.
+             */
+            uint64_t getNumberOfNodes() const;
+
+            bool isConstant(uint64_t node) const;
+            ValueType const& getConstant(uint64_t node) const;
+
+            /*!
+             * Computes the values that are represented by the given nodes.
+             */
+            std::vector<ValueType> toValues(std::vector<uint64_t> const& nodes) const;
+
+            /*!
+             * Evaluates the given nodes, where the value of every constant is determined by the given function (e.g. by
+             * instantiating the parameters of a rational function). Only the nodes the given ones depend on are evaluated.
+             */
+            template<typename ResultType>
+            std::vector<ResultType> evaluate(std::vector<uint64_t> const& nodes, std::function<ResultType(ValueType const&)> const& evaluateConstant) const;
+
+        private:
+            struct Node {
+                OperationType type;
+                // For constants, the first operand is the index of the value in the vector of constants.
+                uint64_t firstOperand;
+                uint64_t secondOperand;
+            };
+
+            /*!
+             * Retrieves the node representing the given operation and creates it if it does not exist yet.
+             */
+            uint64_t getOrAddOperation(OperationType type, uint64_t first, uint64_t second);
+
+            bool isZero(uint64_t node) const;
+            bool isOne(uint64_t node) const;
+
+            std::vector<Node> nodes;
+            std::vector<ValueType> constants;
+            std::map<std::tuple<OperationType, uint64_t, uint64_t>, uint64_t> operationToNode;
+            uint64_t maximalFoldingComplexity;
+        };
+
+        template<typename ValueType>
+        template<typename ResultType>
+        std::vector<ResultType> StraightLineProgram<ValueType>::evaluate(std::vector<uint64_t> const& resultNodes, std::function<ResultType(ValueType const&)> const& evaluateConstant) const {
+            // Since operands always precede the operations, the nodes that are needed can be determined by a single backward pass.
+            std::vector<bool> isNeeded(nodes.size(), false);
+            for (auto const& node : resultNodes) {
+                isNeeded[node] = true;
+            }
+            for (uint64_t node = nodes.size(); node > 0; --node) {
+                Node const& current = nodes[node - 1];
+                if (isNeeded[node - 1] && current.type != OperationType::Constant) {
+                    isNeeded[current.firstOperand] = true;
+                    isNeeded[current.secondOperand] = true;
+                }
+            }
+
+            std::vector<ResultType> values(nodes.size());
+            for (uint64_t node = 0; node < nodes.size(); ++node) {
+                if (!isNeeded[node]) {
+                    continue;
+                }
+                Node const& current = nodes[node];
+                switch (current.type) {
+                    case OperationType::Constant:
+                        values[node] = evaluateConstant(constants[current.firstOperand]);
+                        break;
+                    case OperationType::Add:
+                        values[node] = values[current.firstOperand] + values[current.secondOperand];
+                        break;
+                    case OperationType::Subtract:
+                        values[node] = values[current.firstOperand] - values[current.secondOperand];
+                        break;
+                    case OperationType::Multiply:
+                        values[node] = values[current.firstOperand] * values[current.secondOperand];
+                        break;
+                    case OperationType::Divide:
+                        values[node] = values[current.firstOperand] / values[current.secondOperand];
+                        break;
+                }
+            }
+
+            std::vector<ResultType> result;
+            result.reserve(resultNodes.size());
+            for (auto const& node : resultNodes) {
+                result.push_back(values[node]);
+            }
+            return result;
+        }
+
+    }
+}
+
+#endif /* STORM_STORAGE_STRAIGHTLINEPROGRAM_H_ */
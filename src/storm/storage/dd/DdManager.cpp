@@ -485,6 +485,11 @@ namespace storm {
             internalDdManager.debugCheck();
         }
         
+        template<DdType LibraryType>
+        DdManagerStatistics DdManager<LibraryType>::getStatistics() const {
+            return internalDdManager.getStatistics();
+        }
+        
         template class DdManager<DdType::CUDD>;
         
         template Add<DdType::CUDD, double> DdManager<DdType::CUDD>::getAddZero() const;
@@ -8,6 +8,7 @@
 #include "storm/storage/dd/DdType.h"
 #include "storm/storage/dd/DdMetaVariable.h"
 #include "storm/storage/dd/MetaVariablePosition.h"
+#include "storm/storage/dd/DdManagerStatistics.h"
 #include "storm/storage/dd/Bdd.h"
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/AddIterator.h"
@@ -322,6 +323,12 @@ namespace storm {
              */
             void debugCheck() const;
 
+            /*!
+             * Retrieves a snapshot of the resource usage (nodes, tables, caches, garbage collections and memory) of
+             * the underlying DD library.
+             */
+            DdManagerStatistics getStatistics() const;
+
         private:
             /*!
              * Creates a meta variable with the given number of DD variables and layers.
@@ -0,0 +1,35 @@
+#include "storm/storage/dd/DdManagerStatistics.h"
+
+namespace storm {
+    namespace dd {
+        
+        std::ostream& operator<<(std::ostream& out, DdManagerStatistics const& statistics) {
+            out << "    * nodes: " << statistics.numberOfNodes << " (peak: " << statistics.peakNumberOfNodes << ")" << std::endl;
+            out << "    * unique table slots: " << statistics.tableSize;
+            if (statistics.maximalTableSize) {
+                out << " (max: " << statistics.maximalTableSize.get() << ")";
+            }
+            out << std::endl;
+            out << "    * cache slots: " << statistics.cacheSize;
+            if (statistics.maximalCacheSize) {
+                out << " (max: " << statistics.maximalCacheSize.get() << ")";
+            }
+            out << std::endl;
+            if (statistics.cacheLookups && statistics.cacheHits) {
+                out << "    * cache hits: " << statistics.cacheHits.get() << " of " << statistics.cacheLookups.get() << " lookups";
+                if (statistics.cacheLookups.get() > 0) {
+                    out << " (" << (100.0 * statistics.cacheHits.get() / statistics.cacheLookups.get()) << "%)";
+                }
+                out << std::endl;
+            }
+            out << "    * garbage collections: " << statistics.garbageCollections << " (" << statistics.garbageCollectionTimeInMilliseconds << "ms)" << std::endl;
+            out << "    * memory: " << statistics.memoryInUse / (1024 * 1024) << "MB";
+            if (statistics.memoryLimit) {
+                out << " (limit: " << statistics.memoryLimit.get() / (1024 * 1024) << "MB)";
+            }
+            out << std::endl;
+            return out;
+        }
+        
+    }
+}
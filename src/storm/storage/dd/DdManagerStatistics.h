@@ -0,0 +1,49 @@
+#ifndef STORM_STORAGE_DD_DDMANAGERSTATISTICS_H_
+#define STORM_STORAGE_DD_DDMANAGERSTATISTICS_H_
+
+#include <cstdint>
+#include <ostream>
+
+#include <boost/optional.hpp>
+
+namespace storm {
+    namespace dd {
+        
+        /*!
+         * A snapshot of the resource usage of a DD manager. Values that are not provided by the underlying library
+         * are left empty.
+         */
+        struct DdManagerStatistics {
+            // The number of nodes that are currently stored in the unique table.
+            uint64_t numberOfNodes = 0;
+            
+            // The largest number of nodes that was stored in the unique table so far.
+            uint64_t peakNumberOfNodes = 0;
+            
+            // The current and maximal number of slots of the unique table.
+            uint64_t tableSize = 0;
+            boost::optional<uint64_t> maximalTableSize;
+            
+            // The current and maximal number of slots of the operation cache.
+            uint64_t cacheSize = 0;
+            boost::optional<uint64_t> maximalCacheSize;
+            
+            // The number of lookups in and hits of the operation cache.
+            boost::optional<uint64_t> cacheLookups;
+            boost::optional<uint64_t> cacheHits;
+            
+            // The number of garbage collections and the total time spent in them.
+            uint64_t garbageCollections = 0;
+            uint64_t garbageCollectionTimeInMilliseconds = 0;
+            
+            // The memory (in bytes) that is currently occupied and that may be occupied at most.
+            uint64_t memoryInUse = 0;
+            boost::optional<uint64_t> memoryLimit;
+        };
+        
+        std::ostream& operator<<(std::ostream& out, DdManagerStatistics const& statistics);
+        
+    }
+}
+
+#endif /* STORM_STORAGE_DD_DDMANAGERSTATISTICS_H_ */
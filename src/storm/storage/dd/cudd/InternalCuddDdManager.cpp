@@ -1,5 +1,8 @@
 #include "storm/storage/dd/cudd/InternalCuddDdManager.h"
 
+#include <algorithm>
+#include <limits>
+
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CuddSettings.h"
 
@@ -8,10 +11,23 @@
 namespace storm {
     namespace dd {
         
+        // Approximations of the sizes (in bytes) of a node and of an entry of the computed table, respectively.
+        static const uint64_t cuddNodeSize = 32;
+        static const uint64_t cuddCacheEntrySize = 32;
+        
         InternalDdManager<DdType::CUDD>::InternalDdManager() : cuddManager(), reorderingTechnique(CUDD_REORDER_NONE), numberOfDdVariables(0) {
             this->cuddManager.SetMaxMemory(static_cast<unsigned long>(storm::settings::getModule<storm::settings::modules::CuddSettings>().getMaximalMemory() * 1024ul * 1024ul));
             
             auto const& settings = storm::settings::getModule<storm::settings::modules::CuddSettings>();
+            if (settings.isAdaptiveMemorySet() && settings.getMaximalMemory() > 0) {
+                // By default, CUDD derives these limits from the memory available to the process. Instead, we use the
+                // same fractions (a fifth for the fast growth of the unique table and a third for the computed table)
+                // of the given memory bound, so garbage collection kicks in before the bound is exceeded.
+                uint64_t memoryBudget = settings.getMaximalMemory() * 1024ul * 1024ul;
+                uint64_t maximalUnsigned = std::numeric_limits<unsigned int>::max();
+                this->cuddManager.SetLooseUpTo(static_cast<unsigned int>(std::min(memoryBudget / (5 * cuddNodeSize), maximalUnsigned)));
+                this->cuddManager.SetMaxCacheHard(static_cast<unsigned int>(std::min(memoryBudget / (3 * cuddCacheEntrySize), maximalUnsigned)));
+            }
             this->cuddManager.SetEpsilon(settings.getConstantPrecision());
             
             // Now set the selected reordering technique.
@@ -168,6 +184,25 @@ namespace storm {
         uint_fast64_t InternalDdManager<DdType::CUDD>::getNumberOfDdVariables() const {
             return numberOfDdVariables;
         }
+        
+        DdManagerStatistics InternalDdManager<DdType::CUDD>::getStatistics() const {
+            ::DdManager* manager = cuddManager.getManager();
+            DdManagerStatistics result;
+            result.numberOfNodes = static_cast<uint64_t>(Cudd_ReadNodeCount(manager));
+            result.peakNumberOfNodes = static_cast<uint64_t>(Cudd_ReadPeakLiveNodeCount(manager));
+            result.tableSize = Cudd_ReadSlots(manager);
+            result.cacheSize = Cudd_ReadCacheSlots(manager);
+            result.maximalCacheSize = Cudd_ReadMaxCacheHard(manager);
+            result.cacheLookups = static_cast<uint64_t>(Cudd_ReadCacheLookUps(manager));
+            result.cacheHits = static_cast<uint64_t>(Cudd_ReadCacheHits(manager));
+            result.garbageCollections = static_cast<uint64_t>(Cudd_ReadGarbageCollections(manager));
+            result.garbageCollectionTimeInMilliseconds = static_cast<uint64_t>(Cudd_ReadGarbageCollectionTime(manager));
+            result.memoryInUse = Cudd_ReadMemoryInUse(manager);
+            if (Cudd_ReadMaxMemory(manager) > 0) {
+                result.memoryLimit = Cudd_ReadMaxMemory(manager);
+            }
+            return result;
+        }
 
         template InternalAdd<DdType::CUDD, double> InternalDdManager<DdType::CUDD>::getAddOne() const;
         template InternalAdd<DdType::CUDD, uint_fast64_t> InternalDdManager<DdType::CUDD>::getAddOne() const;
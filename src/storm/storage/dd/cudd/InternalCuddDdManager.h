@@ -5,6 +5,7 @@
 
 #include "storm/storage/dd/DdType.h"
 #include "storm/storage/dd/InternalDdManager.h"
+#include "storm/storage/dd/DdManagerStatistics.h"
 
 #include "storm/storage/dd/cudd/InternalCuddBdd.h"
 #include "storm/storage/dd/cudd/InternalCuddAdd.h"
@@ -138,6 +139,13 @@ namespace storm {
              */
             uint_fast64_t getNumberOfDdVariables() const;
 
+            /*!
+             * Retrieves a snapshot of the resource usage of the manager.
+             *
+             * @return The statistics of the manager.
+             */
+            DdManagerStatistics getStatistics() const;
+
             /*!
              * Retrieves the underlying CUDD manager.
              *
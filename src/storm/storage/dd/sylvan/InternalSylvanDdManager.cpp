@@ -1,5 +1,7 @@
 #include "storm/storage/dd/sylvan/InternalSylvanDdManager.h"
 
+#include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <iostream>
 
@@ -13,12 +15,19 @@
 
 #include "storm/adapters/sylvan.h"
 
+#include "sylvan_cache.h"
+
 #include "storm-config.h"
 
 namespace storm {
     namespace dd {
         
-#ifndef NDEBUG
+        // Statistics about the garbage collections of sylvan. They are maintained by the hooks below.
+        static uint64_t numberOfGarbageCollections = 0;
+        static std::chrono::high_resolution_clock::time_point garbageCollectionStart;
+        static std::chrono::high_resolution_clock::duration garbageCollectionTime(0);
+        static size_t peakNumberOfNodes = 0;
+        
 #if defined(__clang__)
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wzero-length-array"
@@ -27,16 +36,23 @@ namespace storm {
         
         VOID_TASK_0(gc_start) {
             STORM_LOG_TRACE("Starting sylvan garbage collection...");
+            
+            // Right before the garbage collection, the table holds the most nodes.
+            size_t filled = 0;
+            sylvan_table_usage(&filled, NULL);
+            peakNumberOfNodes = std::max(peakNumberOfNodes, filled);
+            
+            ++numberOfGarbageCollections;
+            garbageCollectionStart = std::chrono::high_resolution_clock::now();
         }
         
         VOID_TASK_0(gc_end) {
+            garbageCollectionTime += std::chrono::high_resolution_clock::now() - garbageCollectionStart;
             STORM_LOG_TRACE("Sylvan garbage collection done.");
         }
         
 #if defined(__clang__)
 #pragma clang diagnostic pop
-#endif
-        
 #endif
         
         uint_fast64_t InternalDdManager<DdType::Sylvan>::numberOfInstances = 0;
@@ -45,6 +61,12 @@ namespace storm {
         // some operations.
         uint_fast64_t InternalDdManager<DdType::Sylvan>::nextFreeVariableIndex = 0;
         
+        uint_fast64_t InternalDdManager<DdType::Sylvan>::maximalTableSize = 0;
+        
+        uint_fast64_t InternalDdManager<DdType::Sylvan>::maximalCacheSize = 0;
+        
+        uint_fast64_t InternalDdManager<DdType::Sylvan>::memoryLimit = 0;
+        
         uint_fast64_t findLargestPowerOfTwoFitting(uint_fast64_t number) {
             for (uint_fast64_t index = 0; index < 64; ++index) {
                 if ((number & (1ull << (63 - index))) != 0) {
@@ -68,7 +90,8 @@ namespace storm {
                 uint64_t memorycap = storm::settings::getModule<storm::settings::modules::SylvanSettings>().getMaximalMemory() * 1024 * 1024;
                 
                 uint64_t table_ratio = 0;
-                uint64_t initial_ratio = 0;
+                // In the adaptive mode, the tables start at 1/32 of their maximal size.
+                uint64_t initial_ratio = settings.isAdaptiveMemorySet() ? 5 : 0;
                 
                 uint64_t max_t = 1;
                 uint64_t max_c = 1;
@@ -95,6 +118,9 @@ namespace storm {
                     initial_ratio--;
                 }
                 // End of copied code.
+                maximalTableSize = max_t;
+                maximalCacheSize = max_c;
+                memoryLimit = memorycap;
                 
                 STORM_LOG_DEBUG("Initializing sylvan library. Initial/max table size: " << min_t << "/" << max_t << ", initial/max cache size: " << min_c << "/" << max_c << ".");
                 sylvan::Sylvan::initPackage(min_t, max_t, min_c, max_c);
@@ -103,10 +129,12 @@ namespace storm {
                 sylvan::Sylvan::initMtbdd();
                 sylvan::Sylvan::initCustomMtbdd();
                 
-#ifndef NDEBUG
                 sylvan_gc_hook_pregc(TASK(gc_start));
                 sylvan_gc_hook_postgc(TASK(gc_end));
-#endif
+                if (settings.isAdaptiveMemorySet()) {
+                    // Only grow the tables if a garbage collection leaves more than half of the node table occupied.
+                    sylvan_gc_hook_main(TASK(sylvan_gc_normal_resize));
+                }
 
             }
             ++numberOfInstances;
@@ -263,6 +291,29 @@ namespace storm {
             return nextFreeVariableIndex;
         }
         
+        DdManagerStatistics InternalDdManager<DdType::Sylvan>::getStatistics() const {
+            LACE_ME;
+            size_t filled = 0;
+            size_t total = 0;
+            sylvan_table_usage(&filled, &total);
+            peakNumberOfNodes = std::max(peakNumberOfNodes, filled);
+            
+            DdManagerStatistics result;
+            result.numberOfNodes = filled;
+            result.peakNumberOfNodes = peakNumberOfNodes;
+            result.tableSize = total;
+            result.maximalTableSize = maximalTableSize;
+            result.cacheSize = cache_getsize();
+            result.maximalCacheSize = maximalCacheSize;
+            // Sylvan only counts cache hits if it is compiled with statistics, so we do not report them.
+            result.garbageCollections = numberOfGarbageCollections;
+            result.garbageCollectionTimeInMilliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(garbageCollectionTime).count();
+            // The sizes of a bucket of the node table and of the cache are the ones used to derive the table sizes.
+            result.memoryInUse = total * 24 + result.cacheSize * 36;
+            result.memoryLimit = memoryLimit;
+            return result;
+        }
+        
         template InternalAdd<DdType::Sylvan, double> InternalDdManager<DdType::Sylvan>::getAddUndefined() const;
         template InternalAdd<DdType::Sylvan, uint_fast64_t> InternalDdManager<DdType::Sylvan>::getAddUndefined() const;
         
@@ -5,6 +5,7 @@
 
 #include "storm/storage/dd/DdType.h"
 #include "storm/storage/dd/InternalDdManager.h"
+#include "storm/storage/dd/DdManagerStatistics.h"
 
 #include "storm/storage/dd/sylvan/InternalSylvanBdd.h"
 #include "storm/storage/dd/sylvan/InternalSylvanAdd.h"
@@ -138,6 +139,13 @@ namespace storm {
              * @return The number of managed variables.
              */
             uint_fast64_t getNumberOfDdVariables() const;
+
+            /*!
+             * Retrieves a snapshot of the resource usage of the manager.
+             *
+             * @return The statistics of the manager.
+             */
+            DdManagerStatistics getStatistics() const;
             
         private:
             // Helper function to create the BDD whose encodings are below a given bound.
@@ -151,6 +159,12 @@ namespace storm {
             // The index of the next free variable index. This needs to be shared across all instances since the sylvan
             // manager is implicitly 'global'.
             static uint_fast64_t nextFreeVariableIndex;
+            
+            // The maximal sizes of the node table and the operation cache as well as the memory bound they were
+            // derived from. Like the instance counter, these are shared by all instances.
+            static uint_fast64_t maximalTableSize;
+            static uint_fast64_t maximalCacheSize;
+            static uint_fast64_t memoryLimit;
         };
         
         template<>
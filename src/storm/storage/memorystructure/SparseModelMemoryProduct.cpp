@@ -12,6 +12,9 @@
 #include "storm/storage/memorystructure/MemoryStructureBuilder.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/builder.h"
+#include "storm/utility/parallel.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/BuildSettings.h"
 
 #include "storm/exceptions/InvalidOperationException.h"
 
@@ -79,10 +82,8 @@ namespace storm {
             storm::storage::SparseMatrix<ValueType> transitionMatrix;
             if (scheduler) {
                 transitionMatrix = buildTransitionMatrixForScheduler();
-            } else if (model.getTransitionMatrix().hasTrivialRowGrouping()) {
-                transitionMatrix = buildDeterministicTransitionMatrix();
             } else {
-                transitionMatrix = buildNondeterministicTransitionMatrix();
+                transitionMatrix = buildTransitionMatrix(!model.getTransitionMatrix().hasTrivialRowGrouping());
             }
             storm::models::sparse::StateLabeling labeling = buildStateLabeling(transitionMatrix);
             std::unordered_map<std::string, RewardModelType> rewardModels = buildRewardModels(transitionMatrix);
@@ -176,61 +177,54 @@ namespace storm {
         }
         
         template <typename ValueType, typename RewardModelType>
-        storm::storage::SparseMatrix<ValueType> SparseModelMemoryProduct<ValueType, RewardModelType>::buildDeterministicTransitionMatrix() {
+        storm::storage::SparseMatrix<ValueType> SparseModelMemoryProduct<ValueType, RewardModelType>::buildTransitionMatrix(bool nondeterministic) {
+            storm::storage::SparseMatrix<ValueType> const& modelMatrix = model.getTransitionMatrix();
+            std::vector<uint64_t> const& modelRowGroupIndices = modelMatrix.getRowGroupIndices();
             uint64_t numResStates = reachableStates.getNumberOfSetBits();
-            uint64_t numResTransitions = 0;
-            for (auto const& stateIndex : reachableStates) {
-                numResTransitions += model.getTransitionMatrix().getRow(stateIndex / memoryStateCount).getNumberOfEntries();
-            }
-            
-            storm::storage::SparseMatrixBuilder<ValueType> builder(numResStates, numResStates, numResTransitions, true);
-            uint64_t currentRow = 0;
-            for (auto const& stateIndex : reachableStates) {
-                uint64_t modelState = stateIndex / memoryStateCount;
-                uint64_t memoryState = stateIndex % memoryStateCount;
-                auto const& modelRow = model.getTransitionMatrix().getRow(modelState);
-                for (auto entryIt = modelRow.begin(); entryIt != modelRow.end(); ++entryIt) {
-                    uint64_t transitionId = entryIt - model.getTransitionMatrix().begin();
-                    uint64_t successorMemoryState = memorySuccessors[transitionId * memoryStateCount + memoryState];
-                    builder.addNextValue(currentRow, getResultState(entryIt->getColumn(), successorMemoryState), entryIt->getValue());
-                }
-                ++currentRow;
-            }
             
-            return builder.build();
-        }
-        
-        template <typename ValueType, typename RewardModelType>
-        storm::storage::SparseMatrix<ValueType> SparseModelMemoryProduct<ValueType, RewardModelType>::buildNondeterministicTransitionMatrix() {
-            uint64_t numResStates = reachableStates.getNumberOfSetBits();
-            uint64_t numResChoices = 0;
-            uint64_t numResTransitions = 0;
-            for (auto const& stateIndex : reachableStates) {
+            // Compute the row groups and the row indications of the result upfront so that the rows of different states can be filled independently.
+            // As the rows of a model state are copied for each of its product states, the result has exactly one row group per reachable product state.
+            std::vector<uint64_t> resultToStateIndex(reachableStates.begin(), reachableStates.end());
+            std::vector<uint64_t> rowGroupIndices;
+            rowGroupIndices.reserve(numResStates + 1);
+            std::vector<uint64_t> rowIndications;
+            rowIndications.push_back(0);
+            for (auto const& stateIndex : resultToStateIndex) {
                 uint64_t modelState = stateIndex / memoryStateCount;
-                for (uint64_t modelRow = model.getTransitionMatrix().getRowGroupIndices()[modelState]; modelRow < model.getTransitionMatrix().getRowGroupIndices()[modelState + 1]; ++modelRow) {
-                    ++numResChoices;
-                    numResTransitions += model.getTransitionMatrix().getRow(modelRow).getNumberOfEntries();
+                rowGroupIndices.push_back(rowIndications.size() - 1);
+                for (uint64_t modelRow = modelRowGroupIndices[modelState]; modelRow < modelRowGroupIndices[modelState + 1]; ++modelRow) {
+                    rowIndications.push_back(rowIndications.back() + modelMatrix.getRow(modelRow).getNumberOfEntries());
                 }
             }
+            rowGroupIndices.push_back(rowIndications.size() - 1);
             
-            storm::storage::SparseMatrixBuilder<ValueType> builder(numResChoices, numResStates, numResTransitions, true, true, numResStates);
-            uint64_t currentRow = 0;
-            for (auto const& stateIndex : reachableStates) {
-                uint64_t modelState = stateIndex / memoryStateCount;
-                uint64_t memoryState = stateIndex % memoryStateCount;
-                builder.newRowGroup(currentRow);
-                for (uint64_t modelRowIndex = model.getTransitionMatrix().getRowGroupIndices()[modelState]; modelRowIndex < model.getTransitionMatrix().getRowGroupIndices()[modelState + 1]; ++modelRowIndex) {
-                    auto const& modelRow = model.getTransitionMatrix().getRow(modelRowIndex);
-                    for (auto entryIt = modelRow.begin(); entryIt != modelRow.end(); ++entryIt) {
-                        uint64_t transitionId = entryIt - model.getTransitionMatrix().begin();
+            // Copies the entries of the product states in the given range. Since the state mapping preserves the order of the
+            // model states, the entries of each row remain sorted by column.
+            std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>> columnsAndValues(rowIndications.back());
+            auto fillRows = [&] (uint64_t firstResultState, uint64_t lastResultState) {
+                for (uint64_t resultState = firstResultState; resultState < lastResultState; ++resultState) {
+                    uint64_t modelState = resultToStateIndex[resultState] / memoryStateCount;
+                    uint64_t memoryState = resultToStateIndex[resultState] % memoryStateCount;
+                    auto resultEntryIt = columnsAndValues.begin() + rowIndications[rowGroupIndices[resultState]];
+                    auto const& modelRowGroup = modelMatrix.getRowGroup(modelState);
+                    for (auto entryIt = modelRowGroup.begin(); entryIt != modelRowGroup.end(); ++entryIt, ++resultEntryIt) {
+                        uint64_t transitionId = entryIt - modelMatrix.begin();
                         uint64_t successorMemoryState = memorySuccessors[transitionId * memoryStateCount + memoryState];
-                        builder.addNextValue(currentRow, getResultState(entryIt->getColumn(), successorMemoryState), entryIt->getValue());
+                        uint64_t successorStateIndex = entryIt->getColumn() * memoryStateCount + successorMemoryState;
+                        STORM_LOG_ASSERT(reachableStates.get(successorStateIndex), "Tried to get unreachable product state (" << entryIt->getColumn() << "," << successorMemoryState << ")");
+                        *resultEntryIt = storm::storage::MatrixEntry<uint_fast64_t, ValueType>(toResultStateMapping[successorStateIndex], entryIt->getValue());
                     }
-                    ++currentRow;
                 }
-            }
+            };
             
-            return builder.build();
+            // Each thread handles a contiguous block of product states with roughly the same number of entries.
+            storm::utility::parallel::processRowGroupBlocksConcurrently(rowGroupIndices, rowIndications, storm::settings::getModule<storm::settings::modules::BuildSettings>().getNumberOfProductThreads(), fillRows);
+            
+            boost::optional<std::vector<uint64_t>> resultRowGroupIndices;
+            if (nondeterministic) {
+                resultRowGroupIndices = std::move(rowGroupIndices);
+            }
+            return storm::storage::SparseMatrix<ValueType>(numResStates, std::move(rowIndications), std::move(columnsAndValues), std::move(resultRowGroupIndices));
         }
         
         template <typename ValueType, typename RewardModelType>
@@ -63,10 +63,8 @@ namespace storm {
             void computeReachableStates(storm::storage::BitVector const& initialStates);
             
             // Methods that build the model components
-            // Matrix for deterministic models
-            storm::storage::SparseMatrix<ValueType> buildDeterministicTransitionMatrix();
-            // Matrix for nondeterministic models
-            storm::storage::SparseMatrix<ValueType> buildNondeterministicTransitionMatrix();
+            // Matrix for models that do not consider a scheduler. The rows of the product states are filled concurrently (if enabled).
+            storm::storage::SparseMatrix<ValueType> buildTransitionMatrix(bool nondeterministic);
             // Matrix for models that consider a scheduler
             storm::storage::SparseMatrix<ValueType> buildTransitionMatrixForScheduler();
             // State labeling.
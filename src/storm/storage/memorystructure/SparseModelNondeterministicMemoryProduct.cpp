@@ -3,6 +3,9 @@
 #include <limits>
 #include "storm/storage/sparse/ModelComponents.h"
 #include "storm/utility/graph.h"
+#include "storm/utility/parallel.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/BuildSettings.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -50,36 +53,48 @@ namespace storm {
             template<typename SparseModelType>
             storm::storage::SparseMatrix<typename SparseModelNondeterministicMemoryProduct<SparseModelType>::ValueType> SparseModelNondeterministicMemoryProduct<SparseModelType>::buildTransitions() const {
                 storm::storage::SparseMatrix<ValueType> const& origTransitions = model.getTransitionMatrix();
-                uint64_t numRows = 0;
-                uint64_t numEntries = 0;
+                uint64_t numProductStates = model.getNumberOfStates() * memory.getNumberOfStates();
+                
+                // Compute the row groups and the row indications upfront so that the rows of different product states can be filled independently.
+                std::vector<uint64_t> rowGroupIndices;
+                rowGroupIndices.reserve(numProductStates + 1);
+                std::vector<uint64_t> rowIndications;
+                rowIndications.push_back(0);
                 for (uint64_t modelState = 0; modelState < model.getNumberOfStates(); ++modelState) {
                     for (uint64_t memState = 0; memState < memory.getNumberOfStates(); ++memState) {
-                        numRows += origTransitions.getRowGroupSize(modelState) * memory.getNumberOfOutgoingTransitions(memState);
-                        numEntries += origTransitions.getRowGroup(modelState).getNumberOfEntries() * memory.getNumberOfOutgoingTransitions(memState);
+                        rowGroupIndices.push_back(rowIndications.size() - 1);
+                        for (uint64_t origRow = origTransitions.getRowGroupIndices()[modelState]; origRow < origTransitions.getRowGroupIndices()[modelState + 1]; ++origRow) {
+                            for (uint64_t memTransition = 0; memTransition < memory.getNumberOfOutgoingTransitions(memState); ++memTransition) {
+                                rowIndications.push_back(rowIndications.back() + origTransitions.getRow(origRow).getNumberOfEntries());
+                            }
+                        }
                     }
                 }
-                storm::storage::SparseMatrixBuilder<ValueType> builder(numRows,
-                                                                        model.getNumberOfStates() * memory.getNumberOfStates(),
-                                                                        numEntries,
-                                                                        true,
-                                                                        true,
-                                                                        model.getNumberOfStates() * memory.getNumberOfStates());
+                rowGroupIndices.push_back(rowIndications.size() - 1);
                 
-                uint64_t row = 0;
-                for (uint64_t modelState = 0; modelState < model.getNumberOfStates(); ++modelState) {
-                    for (uint64_t memState = 0; memState < memory.getNumberOfStates(); ++memState) {
-                        builder.newRowGroup(row);
+                // Copies the entries of the product states in the given range. As the product state index is monotone in the model state,
+                // the entries of each row remain sorted by column.
+                std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>> columnsAndValues(rowIndications.back());
+                auto fillRows = [&] (uint64_t firstProductState, uint64_t lastProductState) {
+                    for (uint64_t productState = firstProductState; productState < lastProductState; ++productState) {
+                        uint64_t modelState = getModelState(productState);
+                        uint64_t memState = getMemoryState(productState);
+                        auto resultEntryIt = columnsAndValues.begin() + rowIndications[rowGroupIndices[productState]];
                         for (uint64_t origRow = origTransitions.getRowGroupIndices()[modelState]; origRow < origTransitions.getRowGroupIndices()[modelState + 1]; ++origRow) {
                             for (auto const& memStatePrime : memory.getTransitions(memState)) {
                                 for (auto const& entry : origTransitions.getRow(origRow)) {
-                                    builder.addNextValue(row, getProductState(entry.getColumn(), memStatePrime), entry.getValue());
+                                    *resultEntryIt = storm::storage::MatrixEntry<uint_fast64_t, ValueType>(getProductState(entry.getColumn(), memStatePrime), entry.getValue());
+                                    ++resultEntryIt;
                                 }
-                                ++row;
                             }
                         }
                     }
-                }
-                return builder.build();
+                };
+                
+                // Each thread handles a contiguous block of product states with roughly the same number of entries.
+                storm::utility::parallel::processRowGroupBlocksConcurrently(rowGroupIndices, rowIndications, storm::settings::getModule<storm::settings::modules::BuildSettings>().getNumberOfProductThreads(), fillRows);
+                
+                return storm::storage::SparseMatrix<ValueType>(numProductStates, std::move(rowIndications), std::move(columnsAndValues), boost::optional<std::vector<uint_fast64_t>>(std::move(rowGroupIndices)));
             }
         
             template<typename SparseModelType>
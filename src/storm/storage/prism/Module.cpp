@@ -199,7 +199,7 @@ namespace storm {
                 }
             }
             
-            return Module(this->getName(), this->getBooleanVariables(), this->getIntegerVariables(), this->getClockVariables(), this->getInvariant(), newCommands);
+            return Module(this->getName(), this->getBooleanVariables(), this->getIntegerVariables(), this->getClockVariables(), this->getInvariant(), newCommands, this->renamedFromModule, this->renaming, this->getFilename(), this->getLineNumber());
         }
         
         Module Module::restrictActionIndices(storm::storage::FlatSet<uint_fast64_t> const& actionIndices) const {
@@ -211,7 +211,7 @@ namespace storm {
                 }
             }
             
-            return Module(this->getName(), this->getBooleanVariables(), this->getIntegerVariables(), this->getClockVariables(), this->getInvariant(), newCommands);
+            return Module(this->getName(), this->getBooleanVariables(), this->getIntegerVariables(), this->getClockVariables(), this->getInvariant(), newCommands, this->renamedFromModule, this->renaming, this->getFilename(), this->getLineNumber());
         }
         
         Module Module::substitute(std::map<storm::expressions::Variable, storm::expressions::Expression> const& substitution) const {
@@ -233,7 +233,7 @@ namespace storm {
                 newCommands.emplace_back(command.substitute(substitution));
             }
             
-            return Module(this->getName(), newBooleanVariables, newIntegerVariables, this->getClockVariables(), this->getInvariant(), newCommands, this->getFilename(), this->getLineNumber());
+            return Module(this->getName(), newBooleanVariables, newIntegerVariables, this->getClockVariables(), this->getInvariant(), newCommands, this->renamedFromModule, this->renaming, this->getFilename(), this->getLineNumber());
         }
         
         bool Module::containsVariablesOnlyInUpdateProbabilities(std::set<storm::expressions::Variable> const& undefinedConstantVariables) const {
@@ -1,13 +1,19 @@
 #include "storm/storage/prism/Program.h"
 
 #include <algorithm>
+#include <atomic>
+#include <exception>
+#include <limits>
+#include <mutex>
 #include <sstream>
+#include <thread>
 #include <boost/algorithm/string/join.hpp>
 
 #include "storm/storage/jani/Model.h"
 #include "storm/storage/jani/Property.h"
 
 #include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/expressions/VariableExpression.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/solver.h"
 #include "storm/utility/vector.h"
@@ -1515,7 +1521,210 @@ namespace storm {
             return Program(this->manager, modelType, newConstants, getGlobalBooleanVariables(), getGlobalIntegerVariables(), getFormulas(), newModules, actionIndicesToDelete.empty() ? getActionNameToIndexMapping() : newActionToIndexMap, actionIndicesToDelete.empty() ? this->getRewardModels() : newRewardModels, newLabels, getObservationLabels(), getOptionalInitialConstruct(), this->getOptionalSystemCompositionConstruct(), prismCompatibility);
         }
         
-        Program Program::flattenModules(std::shared_ptr<storm::utility::solver::SmtSolverFactory> const& smtSolverFactory) const {
+        namespace detail {
+            /*!
+             * Over-approximates the set of valuations satisfying a guard by a box, i.e. by an interval for each
+             * variable. Boolean variables are treated as variables with domain [0, 1]. The box is exact if all
+             * conjuncts of the guard could be captured by intervals.
+             */
+            class GuardBox {
+            public:
+                typedef std::map<storm::expressions::Variable, std::pair<int_fast64_t, int_fast64_t>> IntervalMap;
+                
+                GuardBox() = default;
+                
+                GuardBox(storm::expressions::Expression const& guard, IntervalMap const& domains) {
+                    addConjunct(guard, domains);
+                }
+                
+                void intersect(GuardBox const& other) {
+                    exact &= other.exact;
+                    empty |= other.empty;
+                    for (auto const& variableIntervalPair : other.intervals) {
+                        if (empty) {
+                            break;
+                        }
+                        restrict(variableIntervalPair.first, variableIntervalPair.second.first, variableIntervalPair.second.second);
+                    }
+                }
+                
+                bool isEmpty() const {
+                    return empty;
+                }
+                
+                bool isExact() const {
+                    return exact;
+                }
+                
+            private:
+                void restrict(storm::expressions::Variable const& variable, int_fast64_t lower, int_fast64_t upper) {
+                    auto intervalIt = intervals.find(variable);
+                    if (intervalIt == intervals.end()) {
+                        intervalIt = intervals.emplace(variable, std::make_pair(lower, upper)).first;
+                    } else {
+                        intervalIt->second.first = std::max(intervalIt->second.first, lower);
+                        intervalIt->second.second = std::min(intervalIt->second.second, upper);
+                    }
+                    empty |= intervalIt->second.first > intervalIt->second.second;
+                }
+                
+                bool restrictWithinDomain(storm::expressions::Variable const& variable, IntervalMap const& domains, int_fast64_t lower, int_fast64_t upper) {
+                    auto domainIt = domains.find(variable);
+                    if (domainIt == domains.end()) {
+                        return false;
+                    }
+                    restrict(variable, domainIt->second.first, domainIt->second.second);
+                    restrict(variable, lower, upper);
+                    return true;
+                }
+                
+                void addConjunct(storm::expressions::Expression const& expression, IntervalMap const& domains) {
+                    if (expression.isTrue()) {
+                        return;
+                    } else if (expression.isFalse()) {
+                        empty = true;
+                        return;
+                    } else if (expression.isVariable()) {
+                        if (expression.hasBooleanType() && restrictWithinDomain(expression.getBaseExpression().asVariableExpression().getVariable(), domains, 1, 1)) {
+                            return;
+                        }
+                    } else if (expression.isFunctionApplication()) {
+                        storm::expressions::OperatorType op = expression.getOperator();
+                        if (op == storm::expressions::OperatorType::And) {
+                            for (uint_fast64_t operandIndex = 0; operandIndex < expression.getArity(); ++operandIndex) {
+                                addConjunct(expression.getOperand(operandIndex), domains);
+                            }
+                            return;
+                        } else if (op == storm::expressions::OperatorType::Not) {
+                            storm::expressions::Expression operand = expression.getOperand(0);
+                            if (operand.isVariable() && restrictWithinDomain(operand.getBaseExpression().asVariableExpression().getVariable(), domains, 0, 0)) {
+                                return;
+                            }
+                        } else if (addRelation(expression, domains)) {
+                            return;
+                        }
+                    }
+                    
+                    // The conjunct is not reflected in the box.
+                    exact = false;
+                }
+                
+                bool addRelation(storm::expressions::Expression const& expression, IntervalMap const& domains) {
+                    storm::expressions::OperatorType op = expression.getOperator();
+                    if (op != storm::expressions::OperatorType::Equal && op != storm::expressions::OperatorType::Less && op != storm::expressions::OperatorType::LessOrEqual && op != storm::expressions::OperatorType::Greater && op != storm::expressions::OperatorType::GreaterOrEqual) {
+                        return false;
+                    }
+                    
+                    storm::expressions::Expression variableSide = expression.getOperand(0);
+                    storm::expressions::Expression valueSide = expression.getOperand(1);
+                    if (!variableSide.isVariable()) {
+                        std::swap(variableSide, valueSide);
+                        // Mirror the relation, such that it reads 'variable op value'.
+                        switch (op) {
+                            case storm::expressions::OperatorType::Less: op = storm::expressions::OperatorType::Greater; break;
+                            case storm::expressions::OperatorType::LessOrEqual: op = storm::expressions::OperatorType::GreaterOrEqual; break;
+                            case storm::expressions::OperatorType::Greater: op = storm::expressions::OperatorType::Less; break;
+                            case storm::expressions::OperatorType::GreaterOrEqual: op = storm::expressions::OperatorType::LessOrEqual; break;
+                            default: break;
+                        }
+                    }
+                    if (!variableSide.isVariable() || !variableSide.hasIntegerType() || !valueSide.hasIntegerType() || valueSide.containsVariables()) {
+                        return false;
+                    }
+                    
+                    storm::expressions::Variable const& variable = variableSide.getBaseExpression().asVariableExpression().getVariable();
+                    int_fast64_t value = valueSide.evaluateAsInt();
+                    int_fast64_t lower = std::numeric_limits<int_fast64_t>::min();
+                    int_fast64_t upper = std::numeric_limits<int_fast64_t>::max();
+                    switch (op) {
+                        case storm::expressions::OperatorType::Equal: lower = value; upper = value; break;
+                        case storm::expressions::OperatorType::Less: upper = value - 1; break;
+                        case storm::expressions::OperatorType::LessOrEqual: upper = value; break;
+                        case storm::expressions::OperatorType::Greater: lower = value + 1; break;
+                        case storm::expressions::OperatorType::GreaterOrEqual: lower = value; break;
+                        default: break;
+                    }
+                    return restrictWithinDomain(variable, domains, lower, upper);
+                }
+                
+                IntervalMap intervals;
+                bool exact = true;
+                bool empty = false;
+            };
+            
+            /*!
+             * Enumerates the combinations of commands (one per module) whose guards can be enabled together. The
+             * combinations are built module by module and a partial combination is discarded as soon as the boxes of
+             * its guards do not intersect. Only if a guard is not captured exactly by its box, the solver is queried.
+             */
+            class SynchronizingCommandEnumerator {
+            public:
+                SynchronizingCommandEnumerator(std::vector<std::vector<std::reference_wrapper<Command const>>> const& possibleCommands, std::vector<std::vector<GuardBox>> const& boxes, storm::solver::SmtSolver& solver, std::mutex* translationMutex) : possibleCommands(possibleCommands), boxes(boxes), solver(solver), translationMutex(translationMutex), solverLevel(0), currentCombination(possibleCommands.size()) {
+                    // Intentionally left empty.
+                }
+                
+                std::vector<std::vector<uint_fast64_t>> enumerate() {
+                    std::vector<std::vector<uint_fast64_t>> result;
+                    enumerate(0, GuardBox(), result);
+                    backtrackSolver(0);
+                    return result;
+                }
+                
+            private:
+                void enumerate(uint_fast64_t module, GuardBox const& box, std::vector<std::vector<uint_fast64_t>>& result) {
+                    for (uint_fast64_t commandIndex = 0; commandIndex < possibleCommands[module].size(); ++commandIndex) {
+                        backtrackSolver(module);
+                        currentCombination[module] = commandIndex;
+                        
+                        GuardBox newBox = box;
+                        newBox.intersect(boxes[module][commandIndex]);
+                        if (newBox.isEmpty()) {
+                            continue;
+                        }
+                        if (!newBox.isExact() && !isSatisfiable(module)) {
+                            continue;
+                        }
+                        
+                        if (module + 1 == possibleCommands.size()) {
+                            result.push_back(currentCombination);
+                        } else {
+                            enumerate(module + 1, newBox, result);
+                        }
+                    }
+                }
+                
+                bool isSatisfiable(uint_fast64_t module) {
+                    // Bring the solver up to date with the guards of the current (partial) combination.
+                    for (; solverLevel <= module; ++solverLevel) {
+                        solver.push();
+                        storm::expressions::Expression const& guard = possibleCommands[solverLevel][currentCombination[solverLevel]].get().getGuardExpression();
+                        if (translationMutex) {
+                            // Translating expressions may declare auxiliary variables in the (shared) manager.
+                            std::lock_guard<std::mutex> lock(*translationMutex);
+                            solver.add(guard);
+                        } else {
+                            solver.add(guard);
+                        }
+                    }
+                    return solver.check() != storm::solver::SmtSolver::CheckResult::Unsat;
+                }
+                
+                void backtrackSolver(uint_fast64_t module) {
+                    for (; solverLevel > module; --solverLevel) {
+                        solver.pop();
+                    }
+                }
+                
+                std::vector<std::vector<std::reference_wrapper<Command const>>> const& possibleCommands;
+                std::vector<std::vector<GuardBox>> const& boxes;
+                storm::solver::SmtSolver& solver;
+                std::mutex* translationMutex;
+                uint_fast64_t solverLevel;
+                std::vector<uint_fast64_t> currentCombination;
+            };
+        }
+        
+        Program Program::flattenModules(std::shared_ptr<storm::utility::solver::SmtSolverFactory> const& smtSolverFactory, uint_fast64_t numberOfThreads) const {
             // If the current program has only one module, we can simply return a copy.
             if (this->getNumberOfModules() == 1) {
                 return Program(*this);
@@ -1525,9 +1734,6 @@ namespace storm {
             
             // Otherwise, we need to actually flatten the contained modules.
             
-            // Get an SMT solver for computing the possible guard combinations.
-            std::unique_ptr<storm::solver::SmtSolver> solver = smtSolverFactory->create(*manager);
-            
             // Set up the data we need to gather to create the flat module.
             std::stringstream newModuleName;
             std::vector<storm::prism::BooleanVariable> allBooleanVariables;
@@ -1537,42 +1743,19 @@ namespace storm {
             uint_fast64_t nextCommandIndex = 0;
             uint_fast64_t nextUpdateIndex = 0;
             
-            // Assert the values of the constants.
-            for (auto const& constant : this->getConstants()) {
-                if (constant.isDefined()) {
-                    if (constant.getType().isBooleanType()) {
-                        solver->add(storm::expressions::iff(constant.getExpressionVariable(),constant.getExpression()));
-                    } else {
-                        solver->add(constant.getExpressionVariable() == constant.getExpression());
-                    }
-                }
-            }
-            
-            // Assert the bounds of the global variables.
-            for (auto const& variable : this->getGlobalIntegerVariables()) {
-                solver->add(variable.getExpression() >= variable.getLowerBoundExpression());
-                solver->add(variable.getExpression() <= variable.getUpperBoundExpression());
-            }
-            
             // Make the global variables local, such that the resulting module covers all occurring variables. Note that
             // this is just for simplicity and is not needed.
             allBooleanVariables.insert(allBooleanVariables.end(), this->getGlobalBooleanVariables().begin(), this->getGlobalBooleanVariables().end());
             allIntegerVariables.insert(allIntegerVariables.end(), this->getGlobalIntegerVariables().begin(), this->getGlobalIntegerVariables().end());
             storm::expressions::Expression newInvariant;
             
-            // Now go through the modules, gather the variables, construct the name of the new module and assert the
-            // bounds of the discovered variables.
+            // Now go through the modules, gather the variables and construct the name of the new module.
             for (auto const& module : this->getModules()) {
                 newModuleName << module.getName() << "_";
                 allBooleanVariables.insert(allBooleanVariables.end(), module.getBooleanVariables().begin(), module.getBooleanVariables().end());
                 allIntegerVariables.insert(allIntegerVariables.end(), module.getIntegerVariables().begin(), module.getIntegerVariables().end());
                 allClockVariables.insert(allClockVariables.end(), module.getClockVariables().begin(), module.getClockVariables().end());
                 
-                for (auto const& variable : module.getIntegerVariables()) {
-                    solver->add(variable.getExpression() >= variable.getLowerBoundExpression());
-                    solver->add(variable.getExpression() <= variable.getUpperBoundExpression());
-                }
-                
                 if (module.hasInvariant()) {
                     newInvariant = newInvariant.isInitialized() ? (newInvariant && module.getInvariant()) : module.getInvariant();
                 }
@@ -1595,12 +1778,52 @@ namespace storm {
                 }
             }
             
-            // Save state of solver so that we can always restore the point where we have exactly the constant values
-            // and variables bounds on the assertion stack.
-            solver->push();
+            // Determine the domains of the variables, as far as they can be determined statically. They are used for
+            // cheaply ruling out combinations of guards before resorting to the SMT solver.
+            std::map<storm::expressions::Variable, storm::expressions::Expression> constantsSubstitution = this->getConstantsSubstitution();
+            detail::GuardBox::IntervalMap domains;
+            for (auto const& variable : allBooleanVariables) {
+                domains.emplace(variable.getExpressionVariable(), std::make_pair(0, 1));
+            }
+            for (auto const& variable : allIntegerVariables) {
+                storm::expressions::Expression lowerBound = variable.getLowerBoundExpression().substitute(constantsSubstitution);
+                storm::expressions::Expression upperBound = variable.getUpperBoundExpression().substitute(constantsSubstitution);
+                if (!lowerBound.containsVariables() && !upperBound.containsVariables()) {
+                    domains.emplace(variable.getExpressionVariable(), std::make_pair(lowerBound.evaluateAsInt(), upperBound.evaluateAsInt()));
+                }
+            }
             
-            // Now we need to enumerate all possible combinations of synchronizing commands. For this, we iterate over
-            // all actions and let the solver enumerate the possible combinations of commands that can be enabled together.
+            // Creates an SMT solver that knows the values of the constants and the bounds of the variables.
+            auto createSolver = [&] () {
+                std::unique_ptr<storm::solver::SmtSolver> solver = smtSolverFactory->create(*manager);
+                
+                // Assert the values of the constants.
+                for (auto const& constant : this->getConstants()) {
+                    if (constant.isDefined()) {
+                        if (constant.getType().isBooleanType()) {
+                            solver->add(storm::expressions::iff(constant.getExpressionVariable(),constant.getExpression()));
+                        } else {
+                            solver->add(constant.getExpressionVariable() == constant.getExpression());
+                        }
+                    }
+                }
+                
+                // Assert the bounds of the variables.
+                for (auto const& variable : allIntegerVariables) {
+                    solver->add(variable.getExpression() >= variable.getLowerBoundExpression());
+                    solver->add(variable.getExpression() <= variable.getUpperBoundExpression());
+                }
+                return solver;
+            };
+            
+            // Now we need to enumerate all possible combinations of synchronizing commands. For this, we gather for
+            // each action the commands of the participating modules.
+            struct SynchronizingAction {
+                uint_fast64_t actionIndex;
+                std::vector<std::vector<std::reference_wrapper<storm::prism::Command const>>> possibleCommands;
+                std::vector<std::vector<uint_fast64_t>> combinations;
+            };
+            std::vector<SynchronizingAction> synchronizingActions;
             for (auto const& actionIndex : this->getSynchronizingActionIndices()) {
                 bool noCombinationsForAction = false;
                 
@@ -1633,87 +1856,84 @@ namespace storm {
                 
                 // If there are no valid combinations for the action, we need to skip the generation of synchronizing
                 // commands.
-                if (!noCombinationsForAction) {
-                    // Save the solver state to be able to restore it when this action index is done.
-                    solver->push();
-                    
-                    // Start by creating a fresh auxiliary variable for each command and link it with the guard.
-                    std::vector<std::vector<storm::expressions::Variable>> commandVariables(possibleCommands.size());
-                    std::vector<storm::expressions::Variable> allCommandVariables;
-                    for (uint_fast64_t outerIndex = 0; outerIndex < possibleCommands.size(); ++outerIndex) {
-                        // Create auxiliary variables and link them with the guards.
-                        for (uint_fast64_t innerIndex = 0; innerIndex < possibleCommands[outerIndex].size(); ++innerIndex) {
-                            commandVariables[outerIndex].push_back(manager->declareFreshBooleanVariable());
-                            allCommandVariables.push_back(commandVariables[outerIndex].back());
-                            solver->add(implies(commandVariables[outerIndex].back(), possibleCommands[outerIndex][innerIndex].get().getGuardExpression()));
+                if (!noCombinationsForAction && !possibleCommands.empty()) {
+                    synchronizingActions.push_back(SynchronizingAction{actionIndex, std::move(possibleCommands), {}});
+                }
+            }
+            
+            // Enumerates the combinations of the given action that can be enabled together.
+            auto enumerateCombinations = [&] (SynchronizingAction& action, storm::solver::SmtSolver& solver, std::mutex* translationMutex) {
+                std::vector<std::vector<detail::GuardBox>> boxes;
+                for (auto const& commands : action.possibleCommands) {
+                    boxes.emplace_back();
+                    for (auto const& command : commands) {
+                        boxes.back().emplace_back(command.get().getGuardExpression().substitute(constantsSubstitution), domains);
+                    }
+                }
+                action.combinations = detail::SynchronizingCommandEnumerator(action.possibleCommands, boxes, solver, translationMutex).enumerate();
+            };
+            
+            // The actions are independent of each other, so their combinations may be enumerated concurrently.
+            numberOfThreads = std::max<uint_fast64_t>(std::min<uint_fast64_t>(numberOfThreads, synchronizingActions.size()), 1);
+            if (numberOfThreads > 1) {
+                std::atomic<uint_fast64_t> nextAction(0);
+                std::mutex translationMutex;
+                std::mutex exceptionMutex;
+                std::exception_ptr exception;
+                
+                auto worker = [&] () {
+                    try {
+                        std::unique_ptr<storm::solver::SmtSolver> solver;
+                        {
+                            std::lock_guard<std::mutex> lock(translationMutex);
+                            solver = createSolver();
                         }
-                        
-                        storm::expressions::Expression atLeastOneCommandFromModule = manager->boolean(false);
-                        for (auto const& commandVariable : commandVariables[outerIndex]) {
-                            atLeastOneCommandFromModule = atLeastOneCommandFromModule || commandVariable;
+                        for (uint_fast64_t index = nextAction++; index < synchronizingActions.size(); index = nextAction++) {
+                            enumerateCombinations(synchronizingActions[index], *solver, &translationMutex);
+                        }
+                    } catch (...) {
+                        std::lock_guard<std::mutex> lock(exceptionMutex);
+                        if (!exception) {
+                            exception = std::current_exception();
                         }
-                        solver->add(atLeastOneCommandFromModule);
+                        nextAction = synchronizingActions.size();
+                    }
+                };
+                
+                std::vector<std::thread> threads;
+                for (uint_fast64_t thread = 1; thread < numberOfThreads; ++thread) {
+                    threads.emplace_back(worker);
+                }
+                worker();
+                for (auto& thread : threads) {
+                    thread.join();
+                }
+                
+                if (exception) {
+                    std::rethrow_exception(exception);
+                }
+            } else {
+                std::unique_ptr<storm::solver::SmtSolver> solver = createSolver();
+                for (auto& action : synchronizingActions) {
+                    enumerateCombinations(action, *solver, nullptr);
+                }
+            }
+            
+            // Now that we have retrieved the combinations, we need to build their synchronizations and add them to
+            // the flattened module. This is done sequentially to obtain deterministic command and update indices.
+            for (auto const& action : synchronizingActions) {
+                for (auto const& combination : action.combinations) {
+                    std::vector<std::reference_wrapper<Command const>> commandCombination;
+                    commandCombination.reserve(combination.size());
+                    for (uint_fast64_t index = 0; index < combination.size(); ++index) {
+                        commandCombination.push_back(action.possibleCommands[index][combination[index]]);
                     }
                     
-                    // Now we are in a position to start the enumeration over all command variables. While doing so, we
-                    // keep track of previously seen command combinations, because the AllSat procedures are not
-                    // always guaranteed to only provide distinct models.
-                    std::unordered_set<std::vector<uint_fast64_t>, storm::utility::vector::VectorHash<uint_fast64_t>> seenCommandCombinations;
-                    solver->allSat(allCommandVariables, [&] (storm::solver::SmtSolver::ModelReference& modelReference) -> bool {
-                        // Now we need to reconstruct the chosen commands from the valuation of the command variables.
-                        std::vector<std::vector<std::reference_wrapper<Command const>>> chosenCommands(possibleCommands.size());
-                        
-                        for (uint_fast64_t outerIndex = 0; outerIndex < commandVariables.size(); ++outerIndex) {
-                            for (uint_fast64_t innerIndex = 0; innerIndex < commandVariables[outerIndex].size(); ++innerIndex) {
-                                if (modelReference.getBooleanValue(commandVariables[outerIndex][innerIndex])) {
-                                    chosenCommands[outerIndex].push_back(possibleCommands[outerIndex][innerIndex]);
-                                }
-                            }
-                        }
-                        
-                        // Now that we have retrieved the commands, we need to build their synchronizations and add them
-                        // to the flattened module.
-                        std::vector<std::vector<std::reference_wrapper<Command const>>::const_iterator> iterators;
-                        for (auto const& element : chosenCommands) {
-                            iterators.push_back(element.begin());
-                        }
-                        
-                        bool movedAtLeastOneIterator = false;
-                        std::vector<std::reference_wrapper<Command const>> commandCombination(chosenCommands.size(), chosenCommands.front().front());
-                        std::vector<uint_fast64_t> commandCombinationIndices(iterators.size());
-                        do {
-                            for (uint_fast64_t index = 0; index < iterators.size(); ++index) {
-                                commandCombination[index] = *iterators[index];
-                                commandCombinationIndices[index] = commandCombination[index].get().getGlobalIndex();
-                            }
-                            
-                            // Only add the command combination if it was not previously seen.
-                            auto seenIt = seenCommandCombinations.find(commandCombinationIndices);
-                            if (seenIt == seenCommandCombinations.end()) {
-                                newCommands.push_back(synchronizeCommands(nextCommandIndex, actionIndex, nextUpdateIndex, indexToActionMap.find(actionIndex)->second, commandCombination));
-                                seenCommandCombinations.insert(commandCombinationIndices);
-
-                                // Move the counters appropriately.
-                                ++nextCommandIndex;
-                                nextUpdateIndex += newCommands.back().getNumberOfUpdates();
-                            }
-                            
-                            movedAtLeastOneIterator = false;
-                            for (uint_fast64_t index = 0; index < iterators.size(); ++index) {
-                                ++iterators[index];
-                                if (iterators[index] != chosenCommands[index].cend()) {
-                                    movedAtLeastOneIterator = true;
-                                    break;
-                                } else {
-                                    iterators[index] = chosenCommands[index].cbegin();
-                                }
-                            }
-                        } while (movedAtLeastOneIterator);
-                        
-                        return true;
-                    });
+                    newCommands.push_back(synchronizeCommands(nextCommandIndex, action.actionIndex, nextUpdateIndex, indexToActionMap.find(action.actionIndex)->second, commandCombination));
                     
-                    solver->pop();
+                    // Move the counters appropriately.
+                    ++nextCommandIndex;
+                    nextUpdateIndex += newCommands.back().getNumberOfUpdates();
                 }
             }
             
@@ -653,9 +653,10 @@ namespace storm {
              * Creates an equivalent program that contains exactly one module.
              *
              * @param smtSolverFactory an SMT solver factory to use. If none is given, the default one is used.
+             * @param numberOfThreads The number of threads used to enumerate the combinations of synchronizing commands.
              * @return The resulting program.
              */
-            Program flattenModules(std::shared_ptr<storm::utility::solver::SmtSolverFactory> const& smtSolverFactory = std::shared_ptr<storm::utility::solver::SmtSolverFactory>(new storm::utility::solver::SmtSolverFactory())) const;
+            Program flattenModules(std::shared_ptr<storm::utility::solver::SmtSolverFactory> const& smtSolverFactory = std::shared_ptr<storm::utility::solver::SmtSolverFactory>(new storm::utility::solver::SmtSolverFactory()), uint_fast64_t numberOfThreads = 1) const;
             
             friend std::ostream& operator<<(std::ostream& stream, Program const& program);
             
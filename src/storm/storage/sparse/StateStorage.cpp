@@ -5,13 +5,38 @@ namespace storm {
         namespace sparse {
                         
             template <typename StateType>
-            StateStorage<StateType>::StateStorage(uint64_t bitsPerState) : stateToId(bitsPerState, 100000), initialStateIndices(), deadlockStateIndices(), bitsPerState(bitsPerState) {
-                // Intentionally left empty.
+            StateStorage<StateType>::StateStorage(uint64_t bitsPerState, bool useTreeCompression) : stateToId(bitsPerState, useTreeCompression ? 1 : 100000), initialStateIndices(), deadlockStateIndices(), bitsPerState(bitsPerState) {
+                if (useTreeCompression) {
+                    stateTree = storm::storage::BitVectorTreeTable(bitsPerState);
+                }
             }
 
             template <typename StateType>
             uint_fast64_t StateStorage<StateType>::getNumberOfStates() const {
-                return stateToId.size();
+                return stateTree ? stateTree->size() : stateToId.size();
+            }
+            
+            template <typename StateType>
+            bool StateStorage<StateType>::containsState(storm::storage::BitVector const& state) const {
+                return stateTree ? stateTree->contains(state) : stateToId.contains(state);
+            }
+            
+            template <typename StateType>
+            StateType StateStorage<StateType>::getStateIndex(storm::storage::BitVector const& state) const {
+                return stateTree ? static_cast<StateType>(stateTree->getValue(state)) : stateToId.getValue(state);
+            }
+            
+            template <typename StateType>
+            void StateStorage<StateType>::forEachState(std::function<void (storm::storage::BitVector const&, StateType)> const& function) const {
+                if (stateTree) {
+                    for (auto const& stateIndexPair : stateTree.get()) {
+                        function(stateIndexPair.first, static_cast<StateType>(stateIndexPair.second));
+                    }
+                } else {
+                    for (auto const& stateIndexPair : stateToId) {
+                        function(stateIndexPair.first, stateIndexPair.second);
+                    }
+                }
             }
             
             template struct StateStorage<uint32_t>;
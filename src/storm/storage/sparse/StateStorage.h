@@ -1,8 +1,12 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
+
+#include <boost/optional.hpp>
 
 #include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/BitVectorTreeTable.h"
 
 namespace storm {
     namespace storage {
@@ -11,12 +15,17 @@ namespace storm {
             // A structure holding information about the reachable state space while building it.
             template <typename StateType>
             struct StateStorage {
-                // Creates an empty state storage structure for storing states of the given bit width.
-                StateStorage(uint64_t bitsPerState);
+                // Creates an empty state storage structure for storing states of the given bit width. If requested,
+                // the states are stored in a tree-compressed table.
+                StateStorage(uint64_t bitsPerState, bool useTreeCompression = false);
                 
                 // This member stores all the states and maps them to their unique indices.
                 storm::storage::BitVectorHashMap<StateType> stateToId;
                 
+                // If set, the states are stored in this tree-compressed table instead of the hash map. The index of
+                // a state is then given by the order in which the states were inserted.
+                boost::optional<storm::storage::BitVectorTreeTable> stateTree;
+                
                 // A list of initial states in terms of their global indices.
                 std::vector<StateType> initialStateIndices;
                 
@@ -28,6 +37,15 @@ namespace storm {
                 
                 // Get the number of states that were found in the exploration so far.
                 uint64_t getNumberOfStates() const;
+                
+                // Retrieves whether the given state was found in the exploration so far.
+                bool containsState(storm::storage::BitVector const& state) const;
+                
+                // Retrieves the index of the given state, which must have been found in the exploration.
+                StateType getStateIndex(storm::storage::BitVector const& state) const;
+                
+                // Calls the given function for every state found in the exploration so far and its index.
+                void forEachState(std::function<void (storm::storage::BitVector const&, StateType)> const& function) const;
             };
             
         }
@@ -1,5 +1,10 @@
 #include "storm/utility/dd.h"
 
+#include <algorithm>
+#include <chrono>
+
+#include <boost/optional.hpp>
+
 #include "storm/storage/dd/DdManager.h"
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
@@ -12,6 +17,154 @@ namespace storm {
     namespace utility {
         namespace dd {
             
+            std::ostream& operator<<(std::ostream& out, ReachabilityMethod const& method) {
+                switch (method) {
+                    case ReachabilityMethod::Monolithic:
+                        out << "monolithic";
+                        break;
+                    case ReachabilityMethod::Chaining:
+                        out << "chaining";
+                        break;
+                    case ReachabilityMethod::Saturation:
+                        out << "saturation";
+                        break;
+                    default:
+                        out << "undefined";
+                        break;
+                }
+                return out;
+            }
+            
+            /*!
+             * A part of a partitioned transition relation that is restricted to the meta variables it actually touches.
+             */
+            template <storm::dd::DdType Type>
+            struct LocalTransitionPart {
+                // The relation over the touched row and column meta variables.
+                storm::dd::Bdd<Type> relation;
+                
+                // The touched row and column meta variables.
+                std::set<storm::expressions::Variable> rowMetaVariables;
+                std::set<storm::expressions::Variable> columnMetaVariables;
+                std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> rowColumnMetaVariablePairs;
+                
+                // The topmost level of the DD variables of the part.
+                uint64_t level;
+            };
+            
+            /*!
+             * Retrieves whether the given part constrains the successor values of the given column meta variable. Parts
+             * that do not are considered to leave the corresponding row meta variable unchanged.
+             */
+            template <storm::dd::DdType Type>
+            bool constrainsSuccessorValues(storm::dd::Bdd<Type> const& part, storm::expressions::Variable const& columnMetaVariable) {
+                return !(part.existsAbstract({columnMetaVariable}) == part);
+            }
+            
+            template <storm::dd::DdType Type>
+            std::vector<LocalTransitionPart<Type>> getLocalTransitionParts(std::vector<storm::dd::Bdd<Type>> const& transitionParts, std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs) {
+                std::vector<LocalTransitionPart<Type>> result;
+                for (auto const& part : transitionParts) {
+                    if (part.isZero()) {
+                        continue;
+                    }
+                    
+                    LocalTransitionPart<Type> localPart;
+                    localPart.relation = part;
+                    for (auto const& metaVariablePair : rowColumnMetaVariablePairs) {
+                        if (!constrainsSuccessorValues(part, metaVariablePair.second)) {
+                            continue;
+                        }
+                        
+                        // Check whether the part is the identity with respect to this pair of meta variables.
+                        storm::dd::Bdd<Type> abstracted = localPart.relation.existsAbstract({metaVariablePair.first, metaVariablePair.second});
+                        if ((abstracted && part.getDdManager().getIdentity(metaVariablePair.first, metaVariablePair.second)) == localPart.relation) {
+                            localPart.relation = abstracted;
+                        } else {
+                            localPart.rowMetaVariables.insert(metaVariablePair.first);
+                            localPart.columnMetaVariables.insert(metaVariablePair.second);
+                            localPart.rowColumnMetaVariablePairs.push_back(metaVariablePair);
+                        }
+                    }
+                    
+                    // Parts that only consist of self-loops cannot contribute new states.
+                    if (localPart.rowColumnMetaVariablePairs.empty()) {
+                        continue;
+                    }
+                    localPart.level = localPart.relation.getLevel();
+                    
+                    STORM_LOG_TRACE("Transition part touches " << localPart.rowColumnMetaVariablePairs.size() << " of " << rowColumnMetaVariablePairs.size() << " meta variable(s) and has " << localPart.relation.getNodeCount() << " node(s).");
+                    result.push_back(std::move(localPart));
+                }
+                return result;
+            }
+            
+            template <storm::dd::DdType Type>
+            storm::dd::Bdd<Type> computeImage(storm::dd::Bdd<Type> const& states, LocalTransitionPart<Type> const& part) {
+                return states.andExists(part.relation, part.rowMetaVariables).swapVariables(part.rowColumnMetaVariablePairs);
+            }
+            
+            template <storm::dd::DdType Type>
+            storm::dd::Bdd<Type> computePreImage(storm::dd::Bdd<Type> const& states, LocalTransitionPart<Type> const& part) {
+                return states.swapVariables(part.rowColumnMetaVariablePairs).andExists(part.relation, part.columnMetaVariables);
+            }
+            
+            template <storm::dd::DdType Type>
+            std::pair<storm::dd::Bdd<Type>, uint64_t> computeFixpoint(storm::dd::Bdd<Type> const& initialStates, boost::optional<storm::dd::Bdd<Type>> const& constraintStates, std::vector<LocalTransitionPart<Type>>& parts, ReachabilityMethod const& method, bool forward) {
+                storm::dd::Bdd<Type> reachableStates = initialStates;
+                uint64_t iteration = 0;
+                
+                auto getNewStates = [&] (LocalTransitionPart<Type> const& part) {
+                    ++iteration;
+                    storm::dd::Bdd<Type> newStates = (forward ? computeImage(reachableStates, part) : computePreImage(reachableStates, part)) && !reachableStates;
+                    if (constraintStates) {
+                        newStates &= constraintStates.get();
+                    }
+                    return newStates;
+                };
+                
+                if (method == ReachabilityMethod::Chaining) {
+                    bool changed = true;
+                    while (changed) {
+                        changed = false;
+                        for (auto const& part : parts) {
+                            storm::dd::Bdd<Type> newStates = getNewStates(part);
+                            if (!newStates.isZero()) {
+                                changed = true;
+                                reachableStates |= newStates;
+                            }
+                        }
+                        STORM_LOG_TRACE("Chaining round completed after " << iteration << " image computations: " << reachableStates.getNonZeroCount() << " reachable states found.");
+                    }
+                } else {
+                    STORM_LOG_ASSERT(method == ReachabilityMethod::Saturation, "Unexpected reachability method.");
+                    
+                    // Saturate the parts touching only variables low in the order first.
+                    std::stable_sort(parts.begin(), parts.end(), [] (LocalTransitionPart<Type> const& first, LocalTransitionPart<Type> const& second) { return first.level > second.level; });
+                    
+                    uint64_t partIndex = 0;
+                    while (partIndex < parts.size()) {
+                        bool changed = false;
+                        storm::dd::Bdd<Type> newStates = getNewStates(parts[partIndex]);
+                        while (!newStates.isZero()) {
+                            changed = true;
+                            reachableStates |= newStates;
+                            newStates = getNewStates(parts[partIndex]);
+                        }
+                        
+                        // If the part discovered new states, the parts below it need to be saturated again.
+                        if (changed && partIndex > 0) {
+                            STORM_LOG_TRACE("Part " << partIndex << " discovered new states, restarting saturation after " << iteration << " image computations: " << reachableStates.getNonZeroCount() << " reachable states found.");
+                            partIndex = 0;
+                        } else {
+                            ++partIndex;
+                        }
+                    }
+                }
+                
+                return {reachableStates, iteration};
+            }
+            
             template <storm::dd::DdType Type>
             std::pair<storm::dd::Bdd<Type>,uint64_t> computeReachableStates(storm::dd::Bdd<Type> const& initialStates, storm::dd::Bdd<Type> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables) {
 
@@ -77,6 +230,71 @@ namespace storm {
                 return reachableStates;
             }
             
+            /*!
+             * Composes the given parts to the monolithic transition relation by making the identities of the meta
+             * variables a part leaves unchanged explicit.
+             */
+            template <storm::dd::DdType Type>
+            storm::dd::Bdd<Type> composeTransitionParts(storm::dd::DdManager<Type> const& manager, std::vector<storm::dd::Bdd<Type>> const& transitionParts, std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs) {
+                storm::dd::Bdd<Type> transitions = manager.getBddZero();
+                for (auto const& part : transitionParts) {
+                    storm::dd::Bdd<Type> completedPart = part;
+                    for (auto const& metaVariablePair : rowColumnMetaVariablePairs) {
+                        if (!constrainsSuccessorValues(part, metaVariablePair.second)) {
+                            completedPart &= manager.getIdentity(metaVariablePair.first, metaVariablePair.second);
+                        }
+                    }
+                    transitions |= completedPart;
+                }
+                return transitions;
+            }
+            
+            template <storm::dd::DdType Type>
+            std::pair<storm::dd::Bdd<Type>, uint64_t> computeReachableStates(storm::dd::Bdd<Type> const& initialStates, std::vector<storm::dd::Bdd<Type>> const& transitionParts, std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs, ReachabilityMethod const& method) {
+                if (method == ReachabilityMethod::Monolithic || transitionParts.size() <= 1) {
+                    std::set<storm::expressions::Variable> rowMetaVariables;
+                    std::set<storm::expressions::Variable> columnMetaVariables;
+                    for (auto const& metaVariablePair : rowColumnMetaVariablePairs) {
+                        rowMetaVariables.insert(metaVariablePair.first);
+                        columnMetaVariables.insert(metaVariablePair.second);
+                    }
+                    return computeReachableStates(initialStates, composeTransitionParts(initialStates.getDdManager(), transitionParts, rowColumnMetaVariablePairs), rowMetaVariables, columnMetaVariables);
+                }
+                
+                STORM_LOG_TRACE("Computing reachable states with " << method << " over " << transitionParts.size() << " transition part(s) and " << initialStates.getNonZeroCount() << " initial states.");
+                
+                auto start = std::chrono::high_resolution_clock::now();
+                std::vector<LocalTransitionPart<Type>> parts = getLocalTransitionParts(transitionParts, rowColumnMetaVariablePairs);
+                auto result = computeFixpoint<Type>(initialStates, boost::none, parts, method, true);
+                auto end = std::chrono::high_resolution_clock::now();
+                STORM_LOG_TRACE("Reachability computation completed with " << result.second << " image computations (" << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms).");
+                
+                return result;
+            }
+            
+            template <storm::dd::DdType Type>
+            storm::dd::Bdd<Type> computeBackwardsReachableStates(storm::dd::Bdd<Type> const& initialStates, storm::dd::Bdd<Type> const& constraintStates, std::vector<storm::dd::Bdd<Type>> const& transitionParts, std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs, ReachabilityMethod const& method) {
+                if (method == ReachabilityMethod::Monolithic || transitionParts.size() <= 1) {
+                    std::set<storm::expressions::Variable> rowMetaVariables;
+                    std::set<storm::expressions::Variable> columnMetaVariables;
+                    for (auto const& metaVariablePair : rowColumnMetaVariablePairs) {
+                        rowMetaVariables.insert(metaVariablePair.first);
+                        columnMetaVariables.insert(metaVariablePair.second);
+                    }
+                    return computeBackwardsReachableStates(initialStates, constraintStates, composeTransitionParts(initialStates.getDdManager(), transitionParts, rowColumnMetaVariablePairs), rowMetaVariables, columnMetaVariables);
+                }
+                
+                STORM_LOG_TRACE("Computing backwards reachable states with " << method << " over " << transitionParts.size() << " transition part(s) and " << initialStates.getNonZeroCount() << " initial states.");
+                
+                auto start = std::chrono::high_resolution_clock::now();
+                std::vector<LocalTransitionPart<Type>> parts = getLocalTransitionParts(transitionParts, rowColumnMetaVariablePairs);
+                auto result = computeFixpoint<Type>(initialStates, constraintStates, parts, method, false);
+                auto end = std::chrono::high_resolution_clock::now();
+                STORM_LOG_TRACE("Backward reachability computation completed with " << result.second << " image computations (" << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms).");
+                
+                return result.first;
+            }
+            
             template <storm::dd::DdType Type>
             storm::dd::Bdd<Type> getRowColumnDiagonal(storm::dd::DdManager<Type> const& ddManager, std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs) {
                 return ddManager.getIdentity(rowColumnMetaVariablePairs, false);
@@ -88,6 +306,12 @@ namespace storm {
             template storm::dd::Bdd<storm::dd::DdType::CUDD> computeBackwardsReachableStates(storm::dd::Bdd<storm::dd::DdType::CUDD> const& initialStates, storm::dd::Bdd<storm::dd::DdType::CUDD> const& constraintStates, storm::dd::Bdd<storm::dd::DdType::CUDD> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables);
             template storm::dd::Bdd<storm::dd::DdType::Sylvan> computeBackwardsReachableStates(storm::dd::Bdd<storm::dd::DdType::Sylvan> const& initialStates, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& constraintStates, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables);
             
+            template std::pair<storm::dd::Bdd<storm::dd::DdType::CUDD>, uint64_t> computeReachableStates(storm::dd::Bdd<storm::dd::DdType::CUDD> const& initialStates, std::vector<storm::dd::Bdd<storm::dd::DdType::CUDD>> const& transitionParts, std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs, ReachabilityMethod const& method);
+            template std::pair<storm::dd::Bdd<storm::dd::DdType::Sylvan>, uint64_t> computeReachableStates(storm::dd::Bdd<storm::dd::DdType::Sylvan> const& initialStates, std::vector<storm::dd::Bdd<storm::dd::DdType::Sylvan>> const& transitionParts, std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs, ReachabilityMethod const& method);
+            
+            template storm::dd::Bdd<storm::dd::DdType::CUDD> computeBackwardsReachableStates(storm::dd::Bdd<storm::dd::DdType::CUDD> const& initialStates, storm::dd::Bdd<storm::dd::DdType::CUDD> const& constraintStates, std::vector<storm::dd::Bdd<storm::dd::DdType::CUDD>> const& transitionParts, std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs, ReachabilityMethod const& method);
+            template storm::dd::Bdd<storm::dd::DdType::Sylvan> computeBackwardsReachableStates(storm::dd::Bdd<storm::dd::DdType::Sylvan> const& initialStates, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& constraintStates, std::vector<storm::dd::Bdd<storm::dd::DdType::Sylvan>> const& transitionParts, std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs, ReachabilityMethod const& method);
+            
             template storm::dd::Bdd<storm::dd::DdType::CUDD> getRowColumnDiagonal(storm::dd::DdManager<storm::dd::DdType::CUDD> const& ddManager, std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
             template storm::dd::Bdd<storm::dd::DdType::Sylvan> getRowColumnDiagonal(storm::dd::DdManager<storm::dd::DdType::Sylvan> const& ddManager, std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
 
@@ -3,6 +3,7 @@
 #include <set>
 #include <vector>
 #include <cstdint>
+#include <ostream>
 
 #include "storm/storage/dd/DdType.h"
 
@@ -24,12 +25,44 @@ namespace storm {
     namespace utility {
         namespace dd {
             
+            // An enum that contains all strategies for symbolic (forward and backward) reachability analysis.
+            enum class ReachabilityMethod { Monolithic, Chaining, Saturation };
+            
+            std::ostream& operator<<(std::ostream& out, ReachabilityMethod const& method);
+            
             template <storm::dd::DdType Type>
             std::pair<storm::dd::Bdd<Type>, uint64_t> computeReachableStates(storm::dd::Bdd<Type> const& initialStates, storm::dd::Bdd<Type> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables);
 
             template <storm::dd::DdType Type>
             storm::dd::Bdd<Type> computeBackwardsReachableStates(storm::dd::Bdd<Type> const& initialStates, storm::dd::Bdd<Type> const& constraintStates, storm::dd::Bdd<Type> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables);
 
+            /*!
+             * Computes the states reachable from the given initial states via a partitioned transition relation, e.g.
+             * one part per action or module. A part leaves all meta variables unchanged whose successor values (column
+             * meta variables) it does not constrain, so the parts can be given over the variables of their module only. For the remaining
+             * meta variables, the ones for which the part is the identity are detected and abstracted from, so that the
+             * images only involve the variables that are actually touched by the part (event locality).
+             *
+             * @param initialStates The states from which to start the search.
+             * @param transitionParts The parts of the transition relation. Their disjunction (with the identities of the
+             * meta variables they leave unchanged) is the full transition relation.
+             * @param rowColumnMetaVariablePairs The pairs of row and column meta variables encoding the states.
+             * @param method The method that is used to combine the images of the parts. With chaining, the images of
+             * all parts are applied one after another within one iteration. With saturation, the parts are ordered by
+             * the topmost variable they touch and every part is fired until a local fixpoint is reached before moving
+             * to parts higher up in the variable order.
+             * @return The reachable states and the number of image computations that were performed.
+             */
+            template <storm::dd::DdType Type>
+            std::pair<storm::dd::Bdd<Type>, uint64_t> computeReachableStates(storm::dd::Bdd<Type> const& initialStates, std::vector<storm::dd::Bdd<Type>> const& transitionParts, std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs, ReachabilityMethod const& method);
+            
+            /*!
+             * Computes the states that can reach the given initial states via a partitioned transition relation while
+             * only passing through the constraint states. See the forward variant for a description of the parameters.
+             */
+            template <storm::dd::DdType Type>
+            storm::dd::Bdd<Type> computeBackwardsReachableStates(storm::dd::Bdd<Type> const& initialStates, storm::dd::Bdd<Type> const& constraintStates, std::vector<storm::dd::Bdd<Type>> const& transitionParts, std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs, ReachabilityMethod const& method);
+            
             template <storm::dd::DdType Type, typename ValueType>
             storm::dd::Add<Type, ValueType> getRowColumnDiagonal(storm::dd::DdManager<Type> const& ddManager, std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
 
@@ -21,6 +21,7 @@
 #include "storm/models/sparse/StandardRewardModel.h"
 
 #include "storm/utility/constants.h"
+#include "storm/utility/dd.h"
 #include "storm/utility/macros.h"
 #include "storm/exceptions/InvalidArgumentException.h"
 
@@ -109,6 +110,12 @@ namespace storm {
                 return reachableStates;
             }
             
+            template<typename T>
+            void restrictToStatesReachableFromRelevantStates(storm::storage::SparseMatrix<T> const& transitionMatrix, storm::storage::BitVector const& relevantStates, storm::storage::BitVector& states) {
+                states &= getReachableStates(transitionMatrix, relevantStates & states, states, storm::storage::BitVector(states.size(), false));
+                STORM_LOG_INFO("Restricting the computation to " << states.getNumberOfSetBits() << " states that are reachable from the relevant states.");
+            }
+            
             template<typename T>
             storm::storage::BitVector getBsccCover(storm::storage::SparseMatrix<T> const& transitionMatrix) {
                 storm::storage::BitVector result(transitionMatrix.getRowGroupCount());
@@ -387,6 +394,12 @@ namespace storm {
             
             template <storm::dd::DdType Type, typename ValueType>
             storm::dd::Bdd<Type> performProbGreater0(storm::models::symbolic::Model<Type, ValueType> const& model, storm::dd::Bdd<Type> const& transitionMatrix, storm::dd::Bdd<Type> const& phiStates, storm::dd::Bdd<Type> const& psiStates, boost::optional<uint_fast64_t> const& stepBound) {
+                // If the search is over the full transition relation of a model that comes with a partitioned
+                // transition relation, we use the parts instead of the monolithic relation.
+                if (!stepBound && model.hasTransitionParts() && transitionMatrix == model.getQualitativeTransitionMatrix(false)) {
+                    return storm::utility::dd::computeBackwardsReachableStates(psiStates, phiStates, model.getTransitionParts(), model.getRowColumnMetaVariablePairs(), model.getTransitionPartsReachabilityMethod());
+                }
+                
                 // Initialize environment for backward search.
                 storm::dd::DdManager<Type> const& manager = model.getManager();
                 storm::dd::Bdd<Type> lastIterationStates = manager.getBddZero();
@@ -992,6 +1005,10 @@ namespace storm {
                 
                 uint_fast64_t iterations = 0;
                 storm::dd::Bdd<Type> abstractedTransitionMatrix = transitionMatrix.existsAbstract(model.getNondeterminismVariables());
+                if (model.hasTransitionParts() && abstractedTransitionMatrix == model.getQualitativeTransitionMatrix(false)) {
+                    return storm::utility::dd::computeBackwardsReachableStates(psiStates, phiStates, model.getTransitionParts(), model.getRowColumnMetaVariablePairs(), model.getTransitionPartsReachabilityMethod());
+                }
+                
                 while (lastIterationStates != statesWithProbabilityGreater0E) {
                     lastIterationStates = statesWithProbabilityGreater0E;
                     statesWithProbabilityGreater0E = statesWithProbabilityGreater0E.inverseRelationalProduct(abstractedTransitionMatrix, model.getRowVariables(), model.getColumnVariables());
@@ -1697,6 +1714,8 @@ namespace storm {
 
             template storm::storage::BitVector getReachableStates(storm::storage::SparseMatrix<double> const& transitionMatrix, storm::storage::BitVector const& initialStates, storm::storage::BitVector const& constraintStates, storm::storage::BitVector const& targetStates, bool useStepBound, uint_fast64_t maximalSteps, boost::optional<storm::storage::BitVector> const& choiceFilter);
             
+            template void restrictToStatesReachableFromRelevantStates(storm::storage::SparseMatrix<double> const& transitionMatrix, storm::storage::BitVector const& relevantStates, storm::storage::BitVector& states);
+            
             template storm::storage::BitVector getBsccCover(storm::storage::SparseMatrix<double> const& transitionMatrix);
            
             template bool hasCycle(storm::storage::SparseMatrix<double> const& transitionMatrix, boost::optional<storm::storage::BitVector> const& subsystem);
@@ -1777,6 +1796,8 @@ namespace storm {
 #ifdef STORM_HAVE_CARL
             template storm::storage::BitVector getReachableStates(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::BitVector const& initialStates, storm::storage::BitVector const& constraintStates, storm::storage::BitVector const& targetStates, bool useStepBound, uint_fast64_t maximalSteps, boost::optional<storm::storage::BitVector> const& choiceFilter);
             
+            template void restrictToStatesReachableFromRelevantStates(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::BitVector const& relevantStates, storm::storage::BitVector& states);
+            
             template storm::storage::BitVector getBsccCover(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix);
             
             template bool hasCycle(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, boost::optional<storm::storage::BitVector> const& subsystem);
@@ -1836,6 +1857,8 @@ namespace storm {
             
             template storm::storage::BitVector getReachableStates(storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix, storm::storage::BitVector const& initialStates, storm::storage::BitVector const& constraintStates, storm::storage::BitVector const& targetStates, bool useStepBound, uint_fast64_t maximalSteps, boost::optional<storm::storage::BitVector> const& choiceFilter);
             
+            template void restrictToStatesReachableFromRelevantStates(storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix, storm::storage::BitVector const& relevantStates, storm::storage::BitVector& states);
+            
             template storm::storage::BitVector getBsccCover(storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix);
             
             template bool hasCycle(storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix, boost::optional<storm::storage::BitVector> const& subsystem);
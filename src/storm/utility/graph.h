@@ -73,6 +73,17 @@ namespace storm {
             template<typename T>
             storm::storage::BitVector getReachableStates(storm::storage::SparseMatrix<T> const& transitionMatrix, storm::storage::BitVector const& initialStates, storm::storage::BitVector const& constraintStates, storm::storage::BitVector const& targetStates, bool useStepBound = false, uint_fast64_t maximalSteps = 0, boost::optional<storm::storage::BitVector> const& choiceFilter = boost::none);
 
+            /*!
+             * Restricts the given states to the ones that are reachable (under any choice) from the relevant states among
+             * them without leaving them. This is useful if only the values of the relevant states are of interest.
+             *
+             * @param transitionMatrix The transition relation of the graph structure to search.
+             * @param relevantStates The states whose values are of interest.
+             * @param states The states to restrict.
+             */
+            template<typename T>
+            void restrictToStatesReachableFromRelevantStates(storm::storage::SparseMatrix<T> const& transitionMatrix, storm::storage::BitVector const& relevantStates, storm::storage::BitVector& states);
+
             /*!
              * Retrieves a set of states that covers als BSCCs of the system in the sense that for every BSCC exactly
              * one state is included in the cover.
@@ -0,0 +1,58 @@
+#include "storm/utility/parallel.h"
+
+#include <algorithm>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace utility {
+        namespace parallel {
+
+            uint64_t resolveNumberOfThreads(uint64_t numberOfThreads) {
+                if (numberOfThreads == 0) {
+                    // The number of hardware threads is zero if it cannot be determined.
+                    return std::max<uint64_t>(std::thread::hardware_concurrency(), 1);
+                }
+                return numberOfThreads;
+            }
+
+            std::vector<uint64_t> computeEntryBalancedBlocks(std::vector<uint64_t> const& rowGroupIndices, std::vector<uint64_t> const& rowIndications, uint64_t numberOfBlocks) {
+                STORM_LOG_ASSERT(!rowGroupIndices.empty() && !rowIndications.empty(), "Invalid row grouping.");
+                STORM_LOG_ASSERT(numberOfBlocks > 0, "Expected at least one block.");
+                uint64_t numberOfRowGroups = rowGroupIndices.size() - 1;
+                uint64_t numberOfEntries = rowIndications.back();
+                std::vector<uint64_t> result;
+                result.reserve(numberOfBlocks + 1);
+                result.push_back(0);
+                for (uint64_t block = 1; block < numberOfBlocks; ++block) {
+                    // The block ends at the first row group that starts at or after the desired number of entries.
+                    uint64_t entryThreshold = numberOfEntries / numberOfBlocks * block;
+                    auto blockEndIt = std::lower_bound(rowGroupIndices.begin(), rowGroupIndices.end() - 1, entryThreshold, [&rowIndications] (uint64_t const& row, uint64_t const& threshold) { return rowIndications[row] < threshold; });
+                    result.push_back(std::max(result.back(), static_cast<uint64_t>(std::distance(rowGroupIndices.begin(), blockEndIt))));
+                }
+                result.push_back(numberOfRowGroups);
+                return result;
+            }
+
+            void processRowGroupBlocksConcurrently(std::vector<uint64_t> const& rowGroupIndices, std::vector<uint64_t> const& rowIndications, uint64_t numberOfThreads, std::function<void(uint64_t, uint64_t)> const& function) {
+                uint64_t numberOfRowGroups = rowGroupIndices.size() - 1;
+                numberOfThreads = std::min(numberOfThreads, numberOfRowGroups);
+                if (numberOfThreads <= 1) {
+                    function(0, numberOfRowGroups);
+                    return;
+                }
+
+                STORM_LOG_INFO("Processing " << numberOfRowGroups << " row groups on " << numberOfThreads << " threads.");
+                std::vector<uint64_t> blocks = computeEntryBalancedBlocks(rowGroupIndices, rowIndications, numberOfThreads);
+                std::vector<std::thread> threads;
+                for (uint64_t block = 0; block < numberOfThreads; ++block) {
+                    threads.emplace_back(function, blocks[block], blocks[block + 1]);
+                }
+                for (auto& thread : threads) {
+                    thread.join();
+                }
+            }
+
+        }
+    }
+}
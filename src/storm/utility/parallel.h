@@ -0,0 +1,119 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <future>
+#include <thread>
+#include <vector>
+
+namespace storm {
+    namespace utility {
+        namespace parallel {
+
+            /*!
+             * Resolves the given number of threads, where zero means to use as many threads as there are hardware threads.
+             *
+             * @param numberOfThreads The requested number of threads or zero.
+             * @return The number of threads to use (at least one).
+             */
+            uint64_t resolveNumberOfThreads(uint64_t numberOfThreads);
+
+            /*!
+             * Splits the given row groups into (at most) the given number of contiguous blocks that have roughly the
+             * same number of entries.
+             *
+             * @param rowGroupIndices The first row of every row group (plus the total number of rows).
+             * @param rowIndications The first entry of every row (plus the total number of entries).
+             * @param numberOfBlocks The desired number of blocks.
+             * @return The first row group of every block (plus the total number of row groups). Blocks may be empty.
+             */
+            std::vector<uint64_t> computeEntryBalancedBlocks(std::vector<uint64_t> const& rowGroupIndices, std::vector<uint64_t> const& rowIndications, uint64_t numberOfBlocks);
+
+            /*!
+             * Calls the given function for contiguous blocks of the given row groups on (at most) the given number of
+             * threads. The blocks have roughly the same number of entries (see computeEntryBalancedBlocks). With at most
+             * one thread, the function is called once for all row groups on the calling thread.
+             *
+             * @param rowGroupIndices The first row of every row group (plus the total number of rows).
+             * @param rowIndications The first entry of every row (plus the total number of entries).
+             * @param numberOfThreads The (maximal) number of threads to use.
+             * @param function Called with the first and the last (exclusive) row group of a block. It must be safe to
+             * call it concurrently for disjoint blocks.
+             */
+            void processRowGroupBlocksConcurrently(std::vector<uint64_t> const& rowGroupIndices, std::vector<uint64_t> const& rowIndications, uint64_t numberOfThreads, std::function<void(uint64_t, uint64_t)> const& function);
+
+            /*!
+             * Computes the results for the indices 0, ..., count - 1 on (at most) the given number of threads. The
+             * results are passed to the consumer on the calling thread, in the order of the indices, as soon as they
+             * become available. With at most one thread, everything happens on the calling thread.
+             *
+             * The behavior matches the sequential processing of the indices: if the computation for an index throws,
+             * the consumer is neither called for this nor for any subsequent index and the exception is rethrown (after
+             * all threads have finished). Exceptions of the consumer are rethrown in the same way.
+             *
+             * @param count The number of results to compute.
+             * @param numberOfThreads The (maximal) number of threads to use.
+             * @param compute The computation of the result for a given index. It must be safe to call it concurrently.
+             * @param consume The consumer of the result of a given index.
+             */
+            template<typename ResultType>
+            void computeConcurrentlyInOrder(uint64_t count, uint64_t numberOfThreads, std::function<ResultType(uint64_t)> const& compute, std::function<void(uint64_t, ResultType&)> const& consume) {
+                numberOfThreads = std::min<uint64_t>(numberOfThreads, count);
+                if (numberOfThreads <= 1) {
+                    for (uint64_t index = 0; index < count; ++index) {
+                        ResultType result = compute(index);
+                        consume(index, result);
+                    }
+                    return;
+                }
+
+                std::vector<std::promise<ResultType>> promises(count);
+                std::vector<std::future<ResultType>> futures;
+                futures.reserve(count);
+                for (auto& promise : promises) {
+                    futures.push_back(promise.get_future());
+                }
+
+                // The workers repeatedly take the next index that is not yet processed. After an exception, they stop
+                // taking new indices as the remaining results are not consumed anyway.
+                std::atomic<uint64_t> nextIndex(0);
+                std::atomic<bool> aborted(false);
+                auto worker = [&] () {
+                    for (uint64_t index = nextIndex++; index < count && !aborted; index = nextIndex++) {
+                        try {
+                            promises[index].set_value(compute(index));
+                        } catch (...) {
+                            promises[index].set_exception(std::current_exception());
+                        }
+                    }
+                };
+                std::vector<std::thread> threads;
+                for (uint64_t threadIndex = 0; threadIndex < numberOfThreads; ++threadIndex) {
+                    threads.emplace_back(worker);
+                }
+
+                std::exception_ptr exception;
+                for (uint64_t index = 0; index < count; ++index) {
+                    try {
+                        ResultType result = futures[index].get();
+                        consume(index, result);
+                    } catch (...) {
+                        exception = std::current_exception();
+                        aborted = true;
+                        break;
+                    }
+                }
+                for (auto& thread : threads) {
+                    thread.join();
+                }
+                if (exception) {
+                    std::rethrow_exception(exception);
+                }
+            }
+
+        }
+    }
+}
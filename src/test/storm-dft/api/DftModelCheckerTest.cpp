@@ -248,4 +248,30 @@ namespace {
         double result = this->analyzeReliability(STORM_TEST_RESOURCES_DIR "/dft/hecs_2_2.dft", 1.0);
         EXPECT_FLOAT_EQ(result, 0.00021997582);
     }
+
+    TEST(DftModelCheckerTest, ConcurrentModules) {
+        std::shared_ptr<storm::storage::DFT<double>> dft = storm::api::loadDFTGalileoFile<double>(STORM_TEST_RESOURCES_DIR "/dft/modules.dft");
+        EXPECT_TRUE(storm::api::isWellFormed(*dft).first);
+        std::string property = "Pmin=? [F<=1 \"failed\"]; Pmin=? [F<=2 \"failed\"]";
+        std::vector<std::shared_ptr<storm::logic::Formula const>> properties = storm::api::extractFormulasFromProperties(storm::api::parseProperties(property));
+        storm::utility::RelevantEvents relevantEvents = storm::api::computeRelevantEvents<double>(*dft, properties, {}, false);
+
+        storm::modelchecker::DFTModelChecker<double> sequentialChecker(false);
+        sequentialChecker.setNumberOfModuleThreads(1);
+        typename storm::modelchecker::DFTModelChecker<double>::dft_results sequentialResults = sequentialChecker.check(*dft, properties, false, true, relevantEvents);
+
+        storm::modelchecker::DFTModelChecker<double> concurrentChecker(false);
+        concurrentChecker.setNumberOfModuleThreads(2);
+        typename storm::modelchecker::DFTModelChecker<double>::dft_results concurrentResults = concurrentChecker.check(*dft, properties, false, true, relevantEvents);
+
+        ASSERT_EQ(2ull, sequentialResults.size());
+        ASSERT_EQ(2ull, concurrentResults.size());
+        for (uint64_t i = 0; i < 2; ++i) {
+            double bound = i + 1;
+            // The top AND fails if both ORs have failed; each OR fails with the sum of the rates of its children.
+            double expected = (1 - std::exp(-1.5 * bound)) * (1 - std::exp(-1.0 * bound));
+            EXPECT_FLOAT_EQ(expected, boost::get<double>(sequentialResults[i]));
+            EXPECT_FLOAT_EQ(boost::get<double>(sequentialResults[i]), boost::get<double>(concurrentResults[i]));
+        }
+    }
 }
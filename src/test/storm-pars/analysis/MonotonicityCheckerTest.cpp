@@ -106,6 +106,23 @@ TEST(MonotonicityCheckerTest, Derivative_checker) {
     functionRes = storm::analysis::MonotonicityChecker<storm::RationalFunction>::checkDerivative(function, region);
     EXPECT_TRUE(functionRes.first);
     EXPECT_FALSE(functionRes.second);
+
+    // Derivative (p-q)^2, not decided by the bounds of the region
+    function = (functionP - functionQ) * (functionP - functionQ);
+    functionRes = storm::analysis::MonotonicityChecker<storm::RationalFunction>::checkDerivative(function, region);
+    EXPECT_TRUE(functionRes.first);
+    EXPECT_FALSE(functionRes.second);
+
+    // Same derivative again
+    functionRes = storm::analysis::MonotonicityChecker<storm::RationalFunction>::checkDerivative(function, region);
+    EXPECT_TRUE(functionRes.first);
+    EXPECT_FALSE(functionRes.second);
+
+    // Derivative -p/(1+q)
+    functionDecr = storm::RationalFunction(storm::RationalFunction(0)-functionP) / storm::RationalFunction(storm::RationalFunction(1)+functionQ);
+    functionDecrRes = storm::analysis::MonotonicityChecker<storm::RationalFunction>::checkDerivative(functionDecr, region);
+    EXPECT_FALSE(functionDecrRes.first);
+    EXPECT_TRUE(functionDecrRes.second);
 }
 
 TEST(MonotonicityCheckerTest, Brp_with_bisimulation_no_samples) {
@@ -155,6 +172,23 @@ std::vector<storm::storage::ParameterRegion<storm::RationalFunction>> regions =
     auto monotone = result.begin()->second.begin();
     EXPECT_EQ(true, monotone->second.first);
     EXPECT_EQ(false, monotone->second.second);
+
+    // Checking the same derivative again on the region of the checker is answered from its cache
+    storm::RationalFunction function;
+    for (auto const& entry : dtmc->getTransitionMatrix()) {
+        if (!entry.getValue().isConstant()) {
+            function = entry.getValue() * entry.getValue();
+            break;
+        }
+    }
+    ASSERT_FALSE(function.isConstant());
+    auto derivative = function.derivative(*function.gatherVariables().begin());
+    auto firstResult = monotonicityChecker.checkDerivativeOnRegion(derivative);
+    uint_fast64_t cacheHits = monotonicityChecker.getNumberOfDerivativeCacheHits();
+    auto secondResult = monotonicityChecker.checkDerivativeOnRegion(derivative);
+    EXPECT_EQ(cacheHits + 1, monotonicityChecker.getNumberOfDerivativeCacheHits());
+    EXPECT_EQ(firstResult, secondResult);
+    EXPECT_EQ(storm::analysis::MonotonicityChecker<storm::RationalFunction>::checkDerivative(derivative, region), secondResult);
 }
 
 TEST(MonotonicityCheckerTest, Brp_with_bisimulation_samples) {
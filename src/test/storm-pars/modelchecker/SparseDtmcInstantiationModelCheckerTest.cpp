@@ -0,0 +1,106 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_CARL
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm-pars/api/storm-pars.h"
+#include "storm-pars/modelchecker/instantiation/SparseDtmcInstantiationModelChecker.h"
+#include "storm/api/storm.h"
+
+#include "storm-parsers/api/storm-parsers.h"
+
+#include "storm/modelchecker/reachability/SparseDtmcEliminationModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/EliminationSettings.h"
+#include "storm/storage/StraightLineProgram.h"
+#include "storm/storage/jani/Property.h"
+
+namespace {
+
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> buildParametricDtmc(std::string const& programFile, std::string const& formulaAsString, std::vector<std::shared_ptr<storm::logic::Formula const>>& formulas) {
+        storm::prism::Program program = storm::api::parseProgram(programFile);
+        formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+        return storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+    }
+
+    TEST(SparseDtmcInstantiationModelCheckerTest, DieStraightLineProgram) {
+        std::vector<std::shared_ptr<storm::logic::Formula const>> formulas;
+        auto dtmc = buildParametricDtmc(STORM_TEST_RESOURCES_DIR "/pdtmc/parametric_die.pm", "P=? [F \"two\"]", formulas);
+        ASSERT_EQ(13ull, dtmc->getNumberOfStates());
+
+        storm::storage::BitVector phiStates(dtmc->getNumberOfStates(), true);
+        storm::storage::BitVector psiStates = dtmc->getStates("two");
+        typedef storm::modelchecker::SparseDtmcEliminationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>> EliminationModelChecker;
+
+        storm::storage::StraightLineProgram<storm::RationalFunction> program;
+        std::vector<uint64_t> nodes = EliminationModelChecker::computeUntilProbabilitiesAsStraightLineProgram(dtmc->getTransitionMatrix(), dtmc->getBackwardTransitions(), dtmc->getInitialStates(), phiStates, psiStates, program);
+        ASSERT_EQ(1ull, nodes.size());
+        storm::RationalFunction slpResult = program.toValues(nodes).front();
+
+        std::unique_ptr<storm::modelchecker::CheckResult> result = EliminationModelChecker::computeUntilProbabilities(dtmc->getTransitionMatrix(), dtmc->getBackwardTransitions(), dtmc->getInitialStates(), phiStates, psiStates, true);
+        storm::RationalFunction eliminationResult = result->asExplicitQuantitativeCheckResult<storm::RationalFunction>()[*dtmc->getInitialStates().begin()];
+
+        // Both functions agree (for p=1/2, the die is fair).
+        std::set<storm::RationalFunctionVariable> parameters = storm::models::sparse::getProbabilityParameters(*dtmc);
+        ASSERT_EQ(1ull, parameters.size());
+        for (std::string const& value : {"1/2", "1/3", "4/5"}) {
+            storm::utility::parametric::Valuation<storm::RationalFunction> valuation;
+            valuation.emplace(*parameters.begin(), storm::utility::convertNumber<storm::RationalFunctionCoefficient>(value));
+            EXPECT_EQ(eliminationResult.evaluate(valuation), slpResult.evaluate(valuation)) << "p=" << value;
+            std::vector<double> evaluated = program.evaluate<double>(nodes, [&valuation] (storm::RationalFunction const& function) { return storm::utility::convertNumber<double>(function.evaluate(valuation)); });
+            EXPECT_NEAR(storm::utility::convertNumber<double>(eliminationResult.evaluate(valuation)), evaluated.front(), 1e-12) << "p=" << value;
+        }
+        storm::utility::parametric::Valuation<storm::RationalFunction> fair;
+        fair.emplace(*parameters.begin(), storm::utility::convertNumber<storm::RationalFunctionCoefficient>("1/2"));
+        EXPECT_EQ(storm::utility::convertNumber<storm::RationalFunctionCoefficient>("1/6"), slpResult.evaluate(fair));
+    }
+
+    TEST(SparseDtmcInstantiationModelCheckerTest, BrpSamplingWithStraightLineProgram) {
+        std::vector<std::shared_ptr<storm::logic::Formula const>> formulas;
+        auto dtmc = buildParametricDtmc(STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm", "P=? [F s=5]; P<=0.84 [F s=5]", formulas);
+        auto parameters = storm::models::sparse::getProbabilityParameters(*dtmc);
+        ASSERT_EQ(2ull, parameters.size());
+
+        std::vector<storm::utility::parametric::Valuation<storm::RationalFunction>> samples;
+        for (auto const& values : std::vector<std::pair<std::string, std::string>>({{"0.7", "0.8"}, {"0.9", "0.9"}, {"0.4", "0.95"}})) {
+            storm::utility::parametric::Valuation<storm::RationalFunction> valuation;
+            for (auto const& parameter : parameters) {
+                valuation.emplace(parameter, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(parameter.name() == "pL" ? values.first : values.second));
+            }
+            samples.push_back(std::move(valuation));
+        }
+
+        storm::Environment env;
+        uint64_t initialState = *dtmc->getInitialStates().begin();
+        for (auto const& formula : formulas) {
+            storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double> modelChecker(*dtmc);
+            modelChecker.specifyFormula(storm::api::createTask<storm::RationalFunction>(formula, true));
+            modelChecker.setInstantiationsAreGraphPreserving(true);
+
+            // The program is built on the first sample and evaluated for all of them.
+            std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> straightLineProgramResults;
+            {
+                std::unique_ptr<storm::settings::SettingMemento> useStraightLineProgram = storm::settings::mutableEliminationSettings().overrideUseStraightLineProgramSet(true);
+                for (auto const& valuation : samples) {
+                    straightLineProgramResults.push_back(modelChecker.check(env, valuation));
+                }
+            }
+
+            for (uint64_t sample = 0; sample < samples.size(); ++sample) {
+                std::unique_ptr<storm::modelchecker::CheckResult> expectedResult = modelChecker.check(env, samples[sample]);
+                if (formula->asOperatorFormula().hasQuantitativeResult()) {
+                    EXPECT_NEAR(expectedResult->asExplicitQuantitativeCheckResult<double>()[initialState], straightLineProgramResults[sample]->asExplicitQuantitativeCheckResult<double>()[initialState], 1e-6) << "sample " << sample;
+                } else {
+                    EXPECT_EQ(expectedResult->asExplicitQualitativeCheckResult()[initialState], straightLineProgramResults[sample]->asExplicitQualitativeCheckResult()[initialState]) << "sample " << sample;
+                }
+            }
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,84 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include "storm-pomdp/analysis/IterativePolicySearch.h"
+#include "storm-pomdp/analysis/QualitativeAnalysisOnGraphs.h"
+#include "storm-pomdp/transformer/MakePOMDPCanonic.h"
+#include "storm/api/storm.h"
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/utility/solver.h"
+
+#ifdef STORM_HAVE_Z3
+namespace {
+
+    struct WinningStates {
+        std::vector<bool> winning;
+        storm::RationalNumber beliefSupportStates;
+    };
+
+    class IterativePolicySearchTest : public ::testing::Test {
+    protected:
+        void buildPrism(std::string const& programFile, std::string const& formulaAsString, std::string const& constantsAsString) {
+            storm::prism::Program program = storm::api::parseProgram(programFile);
+            program = storm::utility::prism::preprocess(program, constantsAsString);
+            formula = storm::api::parsePropertiesForPrismProgram(formulaAsString, program).front().getRawFormula();
+            pomdp = storm::api::buildSparseModel<double>(program, {formula})->template as<storm::models::sparse::Pomdp<double>>();
+            storm::transformer::MakePOMDPCanonic<double> makeCanonic(*pomdp);
+            pomdp = makeCanonic.transform();
+
+            // Preprocess as the command line interface does.
+            storm::analysis::QualitativeAnalysisOnGraphs<double> qualitativeAnalysis(*pomdp);
+            surelyNotAlmostSurelyReachTarget = qualitativeAnalysis.analyseProbSmaller1(formula->asProbabilityOperatorFormula());
+            pomdp->getTransitionMatrix().makeRowGroupsAbsorbing(surelyNotAlmostSurelyReachTarget);
+            targetStates = qualitativeAnalysis.analyseProb1(formula->asProbabilityOperatorFormula());
+        }
+
+        WinningStates computeWinningStates(bool incrementalSolving, bool graphPruning) const {
+            storm::pomdp::MemlessSearchOptions options;
+            options.incrementalSolving = incrementalSolving;
+            options.graphPruning = graphPruning;
+            std::shared_ptr<storm::utility::solver::SmtSolverFactory> smtSolverFactory = std::make_shared<storm::utility::solver::Z3SmtSolverFactory>();
+            storm::pomdp::IterativePolicySearch<double> search(*pomdp, targetStates, surelyNotAlmostSurelyReachTarget, smtSolverFactory, options);
+            search.computeWinningRegion(pomdp->getNumberOfStates());
+
+            WinningStates result;
+            std::vector<uint64_t> offsets(pomdp->getNrObservations(), 0);
+            for (uint64_t state = 0; state < pomdp->getNumberOfStates(); ++state) {
+                uint64_t observation = pomdp->getObservation(state);
+                result.winning.push_back(search.getLastWinningRegion().isWinning(observation, offsets[observation]));
+                ++offsets[observation];
+            }
+            result.beliefSupportStates = search.getLastWinningRegion().beliefSupportStates();
+            return result;
+        }
+
+        void checkWinningRegionsCoincide() const {
+            WinningStates nonIncremental = computeWinningStates(false, false);
+            WinningStates incremental = computeWinningStates(true, true);
+            WinningStates pruningOnly = computeWinningStates(false, true);
+
+            // Make sure that the regions are not trivially empty.
+            EXPECT_FALSE(targetStates.empty());
+            EXPECT_EQ(nonIncremental.winning, incremental.winning);
+            EXPECT_EQ(nonIncremental.winning, pruningOnly.winning);
+            EXPECT_EQ(nonIncremental.beliefSupportStates, incremental.beliefSupportStates);
+            EXPECT_EQ(nonIncremental.beliefSupportStates, pruningOnly.beliefSupportStates);
+        }
+
+        std::shared_ptr<storm::logic::Formula const> formula;
+        std::shared_ptr<storm::models::sparse::Pomdp<double>> pomdp;
+        storm::storage::BitVector surelyNotAlmostSurelyReachTarget;
+        storm::storage::BitVector targetStates;
+    };
+
+    TEST_F(IterativePolicySearchTest, simple_slippery) {
+        buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/simple.prism", "Pmax=? [F \"goal\" ]", "slippery=0.4");
+        checkWinningRegionsCoincide();
+    }
+
+    TEST_F(IterativePolicySearchTest, refuel) {
+        buildPrism(STORM_TEST_RESOURCES_DIR "/pomdp/refuel.prism", "Pmax=? [\"notbad\" U \"goal\"]", "N=4");
+        checkWinningRegionsCoincide();
+    }
+}
+#endif
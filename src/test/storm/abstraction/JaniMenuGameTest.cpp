@@ -0,0 +1,77 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_MSAT
+
+#include <tuple>
+
+#include "storm-parsers/parser/PrismParser.h"
+
+#include "storm/abstraction/MenuGameRefiner.h"
+#include "storm/abstraction/jani/JaniMenuGameAbstractor.h"
+
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/jani/Model.h"
+
+#include "storm/storage/dd/Add.h"
+#include "storm/storage/dd/Bdd.h"
+
+#include "storm/models/symbolic/StandardRewardModel.h"
+
+#include "storm/utility/solver.h"
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/AbstractionSettings.h"
+
+namespace {
+    
+    /*!
+     * Abstracts and refines the crowds model using the given number of threads and returns the number of transitions,
+     * states and bottom states of the resulting game.
+     */
+    template <storm::dd::DdType DdType>
+    std::tuple<uint64_t, uint64_t, uint64_t> abstractAndRefineCrowds(storm::jani::Model const& janiModel, uint64_t numberOfThreads) {
+        storm::settings::mutableAbstractionSettings().setNumberOfThreads(numberOfThreads);
+        
+        storm::expressions::ExpressionManager& manager = janiModel.getManager();
+        std::shared_ptr<storm::utility::solver::SmtSolverFactory> smtSolverFactory = std::make_shared<storm::utility::solver::MathsatSmtSolverFactory>();
+        storm::abstraction::jani::JaniMenuGameAbstractor<DdType, double> abstractor(janiModel, smtSolverFactory);
+        storm::abstraction::MenuGameRefiner<DdType, double> refiner(abstractor, smtSolverFactory->create(manager));
+        refiner.refine({manager.getVariableExpression("phase") < manager.integer(3)});
+        refiner.refine({manager.getVariableExpression("observe0") + manager.getVariableExpression("observe1") + manager.getVariableExpression("observe2") + manager.getVariableExpression("observe3") + manager.getVariableExpression("observe4") <= manager.getVariableExpression("runCount")});
+        
+        storm::abstraction::MenuGame<DdType, double> game = abstractor.abstract();
+        return std::make_tuple(game.getNumberOfTransitions(), game.getNumberOfStates(), game.getBottomStates().getNonZeroCount());
+    }
+    
+    template <storm::dd::DdType DdType>
+    void checkConcurrentCrowdsAbstraction() {
+        auto& settings = storm::settings::mutableAbstractionSettings();
+        settings.setAddAllGuards(false);
+        settings.setAddAllInitialExpressions(false);
+        
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+        storm::jani::Model janiModel = program.substituteConstantsFormulas().toJani().flattenComposition();
+        
+        auto sequentialResult = abstractAndRefineCrowds<DdType>(janiModel, 1);
+        // Make sure that the abstraction is not trivial.
+        EXPECT_LT(1ull, std::get<1>(sequentialResult));
+        EXPECT_LT(std::get<1>(sequentialResult), std::get<0>(sequentialResult));
+        for (uint64_t numberOfThreads : {2ull, 4ull}) {
+            EXPECT_EQ(sequentialResult, abstractAndRefineCrowds<DdType>(janiModel, numberOfThreads)) << numberOfThreads << " threads";
+        }
+        
+        storm::settings::mutableAbstractionSettings().restoreDefaults();
+    }
+    
+}
+
+TEST(JaniMenuGame, CrowdsAbstractionAndRefinementTest_Concurrent_Cudd) {
+    checkConcurrentCrowdsAbstraction<storm::dd::DdType::CUDD>();
+}
+
+TEST(JaniMenuGame, CrowdsAbstractionAndRefinementTest_Concurrent_Sylvan) {
+    checkConcurrentCrowdsAbstraction<storm::dd::DdType::Sylvan>();
+}
+
+#endif
@@ -3,6 +3,8 @@
 
 #ifdef STORM_HAVE_MSAT
 
+#include <tuple>
+
 #include "storm-parsers/parser/PrismParser.h"
 
 #include "storm/abstraction/MenuGameRefiner.h"
@@ -328,6 +330,41 @@ TEST(PrismMenuGame, CrowdsAbstractionAndRefinementTest_Cudd) {
     storm::settings::mutableAbstractionSettings().restoreDefaults();
 }
 
+TEST(PrismMenuGame, CrowdsAbstractionAndRefinementTest_Concurrent_Cudd) {
+    auto& settings = storm::settings::mutableAbstractionSettings();
+    settings.setAddAllGuards(false);
+    settings.setAddAllInitialExpressions(false);
+    
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    program = program.substituteConstantsFormulas();
+    storm::expressions::ExpressionManager& manager = program.getManager();
+    std::shared_ptr<storm::utility::solver::SmtSolverFactory> smtSolverFactory = std::make_shared<storm::utility::solver::MathsatSmtSolverFactory>();
+    
+    // Abstracts and refines the program using the given number of threads and returns the number of transitions,
+    // states and bottom states of the resulting game.
+    auto abstractAndRefine = [&] (uint64_t numberOfThreads) {
+        storm::settings::mutableAbstractionSettings().setNumberOfThreads(numberOfThreads);
+        
+        storm::abstraction::prism::PrismMenuGameAbstractor<storm::dd::DdType::CUDD, double> abstractor(program, smtSolverFactory);
+        storm::abstraction::MenuGameRefiner<storm::dd::DdType::CUDD, double> refiner(abstractor, smtSolverFactory->create(manager));
+        refiner.refine({manager.getVariableExpression("phase") < manager.integer(3)});
+        refiner.refine({manager.getVariableExpression("observe0") + manager.getVariableExpression("observe1") + manager.getVariableExpression("observe2") + manager.getVariableExpression("observe3") + manager.getVariableExpression("observe4") <= manager.getVariableExpression("runCount")});
+        
+        storm::abstraction::MenuGame<storm::dd::DdType::CUDD, double> game = abstractor.abstract();
+        return std::make_tuple(game.getNumberOfTransitions(), game.getNumberOfStates(), game.getBottomStates().getNonZeroCount());
+    };
+    
+    auto sequentialResult = abstractAndRefine(1);
+    auto concurrentResult = abstractAndRefine(4);
+    
+    EXPECT_EQ(68ull, std::get<0>(sequentialResult));
+    EXPECT_EQ(8ull, std::get<1>(sequentialResult));
+    EXPECT_EQ(4ull, std::get<2>(sequentialResult));
+    EXPECT_EQ(sequentialResult, concurrentResult);
+    
+    storm::settings::mutableAbstractionSettings().restoreDefaults();
+}
+
 TEST(PrismMenuGame, CrowdsAbstractionAndRefinementTest_Sylvan) {
     auto& settings = storm::settings::mutableAbstractionSettings();
     settings.setAddAllGuards(false);
@@ -12,9 +12,11 @@
 #include "storm/models/symbolic/StandardRewardModel.h"
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm/builder/DdJaniModelBuilder.h"
+#include "storm/utility/graph.h"
 
 #include "storm/settings/SettingMemento.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/BuildSettings.h"
 
 #include "storm/exceptions/InvalidSettingsException.h"
 
@@ -663,3 +665,79 @@ TEST(DdJaniModelBuilderTest_Sylvan, InputEnabling) {
     EXPECT_EQ(4ul, model->getNumberOfStates());
     EXPECT_EQ(5ul, model->getNumberOfTransitions());
 }
+
+namespace {
+    
+    class CuddEnvironment {
+    public:
+        static const storm::dd::DdType ddType = storm::dd::DdType::CUDD;
+    };
+    
+    class SylvanEnvironment {
+    public:
+        static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan;
+    };
+    
+    template<typename TestType>
+    class DdJaniModelBuilderTest : public ::testing::Test {
+    protected:
+        void TearDown() override {
+            storm::settings::mutableBuildSettings().setSymbolicReachabilityMethod(storm::utility::dd::ReachabilityMethod::Monolithic);
+        }
+    };
+    
+    typedef ::testing::Types<
+            CuddEnvironment,
+            SylvanEnvironment
+    > TestingTypes;
+    
+    TYPED_TEST_SUITE(DdJaniModelBuilderTest, TestingTypes,);
+    
+    TYPED_TEST(DdJaniModelBuilderTest, ReachabilityMethods) {
+        const storm::dd::DdType DdType = TypeParam::ddType;
+        std::vector<std::pair<std::string, std::string>> filesAndLabels = {{"/dtmc/die.pm", "done"}, {"/dtmc/crowds-5-5.pm", "observe0Greater1"}, {"/dtmc/leader-3-5.pm", "elected"}, {"/ctmc/polling2.sm", "target"}, {"/mdp/two_dice.nm", "done"}, {"/mdp/coin2-2.nm", "finished"}, {"/mdp/csma2-2.nm", "all_delivered"}, {"/mdp/leader3.nm", "elected"}};
+        typename storm::builder::DdJaniModelBuilder<DdType, double>::Options options(true);
+        
+        for (auto const& fileAndLabel : filesAndLabels) {
+            storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + fileAndLabel.first);
+            storm::jani::Model janiModel = modelDescription.toJani(true).preprocess().asJaniModel();
+            
+            storm::settings::mutableBuildSettings().setSymbolicReachabilityMethod(storm::utility::dd::ReachabilityMethod::Monolithic);
+            std::shared_ptr<storm::models::symbolic::Model<DdType>> model = storm::builder::DdJaniModelBuilder<DdType, double>().build(janiModel, options);
+            EXPECT_FALSE(model->hasTransitionParts());
+            uint64_t numberOfStatesWithProbabilityGreater0 = storm::utility::graph::performProbGreater0(*model, model->getQualitativeTransitionMatrix(false), model->getReachableStates(), model->getStates(fileAndLabel.second)).getNonZeroCount();
+            
+            for (auto method : {storm::utility::dd::ReachabilityMethod::Chaining, storm::utility::dd::ReachabilityMethod::Saturation}) {
+                storm::settings::mutableBuildSettings().setSymbolicReachabilityMethod(method);
+                std::shared_ptr<storm::models::symbolic::Model<DdType>> partitionedModel = storm::builder::DdJaniModelBuilder<DdType, double>().build(janiModel, options);
+                EXPECT_TRUE(partitionedModel->hasTransitionParts()) << fileAndLabel.first << " (" << method << ")";
+                EXPECT_EQ(model->getNumberOfStates(), partitionedModel->getNumberOfStates()) << fileAndLabel.first << " (" << method << ")";
+                EXPECT_EQ(model->getNumberOfTransitions(), partitionedModel->getNumberOfTransitions()) << fileAndLabel.first << " (" << method << ")";
+                
+                // The backward search of the qualitative analysis uses the parts of the transition relation.
+                EXPECT_EQ(numberOfStatesWithProbabilityGreater0, storm::utility::graph::performProbGreater0(*partitionedModel, partitionedModel->getQualitativeTransitionMatrix(false), partitionedModel->getReachableStates(), partitionedModel->getStates(fileAndLabel.second)).getNonZeroCount()) << fileAndLabel.first << " (" << method << ")";
+            }
+        }
+    }
+
+    TYPED_TEST(DdJaniModelBuilderTest, DdStatistics) {
+        const storm::dd::DdType DdType = TypeParam::ddType;
+        storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+        storm::jani::Model janiModel = modelDescription.toJani(true).preprocess().asJaniModel();
+        
+        storm::builder::DdJaniModelBuilder<DdType, double> builder;
+        std::shared_ptr<storm::models::symbolic::Model<DdType>> model = builder.build(janiModel);
+        EXPECT_EQ(13ul, model->getNumberOfStates());
+        
+        // Building again replaces the statistics of the first run.
+        model = builder.build(janiModel);
+        auto const& ddStatistics = builder.getDdStatistics();
+        ASSERT_EQ(3ul, ddStatistics.size());
+        EXPECT_EQ("translating the automata", ddStatistics[0].first);
+        EXPECT_EQ("reachability analysis", ddStatistics[1].first);
+        EXPECT_EQ("building the reward models", ddStatistics[2].first);
+        // The transition matrix is stored in the manager after the reachability analysis.
+        EXPECT_LE(model->getTransitionMatrix().getNodeCount(), ddStatistics[1].second.numberOfNodes);
+        EXPECT_LE(ddStatistics[0].second.garbageCollections, ddStatistics[2].second.garbageCollections);
+    }
+}
@@ -10,6 +10,7 @@
 #include "storm/models/symbolic/StandardRewardModel.h"
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm/builder/DdPrismModelBuilder.h"
+#include "storm/utility/graph.h"
 
 TEST(DdPrismModelBuilderTest_Sylvan, Dtmc) {
     storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
@@ -319,3 +320,77 @@ TEST(DdPrismModelBuilderTest_Cudd, Composition) {
     EXPECT_EQ(21ul, mdp->getNumberOfChoices());
 }
 
+namespace {
+    
+    class CuddEnvironment {
+    public:
+        static const storm::dd::DdType ddType = storm::dd::DdType::CUDD;
+    };
+    
+    class SylvanEnvironment {
+    public:
+        static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan;
+    };
+    
+    template<typename TestType>
+    class DdPrismModelBuilderTest : public ::testing::Test {
+    protected:
+        void TearDown() override {
+            storm::settings::mutableBuildSettings().setSymbolicReachabilityMethod(storm::utility::dd::ReachabilityMethod::Monolithic);
+        }
+    };
+    
+    typedef ::testing::Types<
+            CuddEnvironment,
+            SylvanEnvironment
+    > TestingTypes;
+    
+    TYPED_TEST_SUITE(DdPrismModelBuilderTest, TestingTypes,);
+    
+    TYPED_TEST(DdPrismModelBuilderTest, ReachabilityMethods) {
+        const storm::dd::DdType DdType = TypeParam::ddType;
+        std::vector<std::pair<std::string, std::string>> filesAndLabels = {{"/dtmc/die.pm", "done"}, {"/dtmc/crowds-5-5.pm", "observe0Greater1"}, {"/dtmc/leader-3-5.pm", "elected"}, {"/ctmc/polling2.sm", "target"}, {"/mdp/two_dice.nm", "done"}, {"/mdp/coin2-2.nm", "finished"}, {"/mdp/csma2-2.nm", "all_delivered"}, {"/mdp/leader3.nm", "elected"}};
+        
+        for (auto const& fileAndLabel : filesAndLabels) {
+            storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + fileAndLabel.first);
+            storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+            
+            storm::settings::mutableBuildSettings().setSymbolicReachabilityMethod(storm::utility::dd::ReachabilityMethod::Monolithic);
+            std::shared_ptr<storm::models::symbolic::Model<DdType>> model = storm::builder::DdPrismModelBuilder<DdType>().build(program);
+            EXPECT_FALSE(model->hasTransitionParts());
+            uint64_t numberOfStatesWithProbabilityGreater0 = storm::utility::graph::performProbGreater0(*model, model->getQualitativeTransitionMatrix(false), model->getReachableStates(), model->getStates(fileAndLabel.second)).getNonZeroCount();
+            
+            for (auto method : {storm::utility::dd::ReachabilityMethod::Chaining, storm::utility::dd::ReachabilityMethod::Saturation}) {
+                storm::settings::mutableBuildSettings().setSymbolicReachabilityMethod(method);
+                std::shared_ptr<storm::models::symbolic::Model<DdType>> partitionedModel = storm::builder::DdPrismModelBuilder<DdType>().build(program);
+                EXPECT_TRUE(partitionedModel->hasTransitionParts()) << fileAndLabel.first << " (" << method << ")";
+                EXPECT_EQ(model->getNumberOfStates(), partitionedModel->getNumberOfStates()) << fileAndLabel.first << " (" << method << ")";
+                EXPECT_EQ(model->getNumberOfTransitions(), partitionedModel->getNumberOfTransitions()) << fileAndLabel.first << " (" << method << ")";
+                
+                // The backward search of the qualitative analysis uses the parts of the transition relation.
+                EXPECT_EQ(numberOfStatesWithProbabilityGreater0, storm::utility::graph::performProbGreater0(*partitionedModel, partitionedModel->getQualitativeTransitionMatrix(false), partitionedModel->getReachableStates(), partitionedModel->getStates(fileAndLabel.second)).getNonZeroCount()) << fileAndLabel.first << " (" << method << ")";
+            }
+        }
+    }
+
+    TYPED_TEST(DdPrismModelBuilderTest, DdStatistics) {
+        const storm::dd::DdType DdType = TypeParam::ddType;
+        storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+        storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+        
+        storm::builder::DdPrismModelBuilder<DdType> builder;
+        std::shared_ptr<storm::models::symbolic::Model<DdType>> model = builder.build(program);
+        EXPECT_EQ(13ul, model->getNumberOfStates());
+        
+        // Building again replaces the statistics of the first run.
+        model = builder.build(program);
+        auto const& ddStatistics = builder.getDdStatistics();
+        ASSERT_EQ(3ul, ddStatistics.size());
+        EXPECT_EQ("translating the modules", ddStatistics[0].first);
+        EXPECT_EQ("reachability analysis", ddStatistics[1].first);
+        EXPECT_EQ("building the reward models", ddStatistics[2].first);
+        // The transition matrix is stored in the manager after the reachability analysis.
+        EXPECT_LE(model->getTransitionMatrix().getNodeCount(), ddStatistics[1].second.numberOfNodes);
+        EXPECT_LE(ddStatistics[0].second.garbageCollections, ddStatistics[2].second.garbageCollections);
+    }
+}
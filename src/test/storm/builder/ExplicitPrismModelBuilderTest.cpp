@@ -4,6 +4,8 @@
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/exceptions/IllegalArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
 
 
 TEST(ExplicitPrismModelBuilderTest, Dtmc) {
@@ -125,3 +127,203 @@ TEST(ExplicitPrismModelBuilderTest, FailComposition) {
 
     STORM_SILENT_ASSERT_THROW(storm::builder::ExplicitModelBuilder<double>(program).build(), storm::exceptions::WrongFormatException);
 }
+
+TEST(ExplicitPrismModelBuilderTest, QuotientVariables) {
+    std::string programString =
+    R"(dtmc
+
+    module main
+        s : [0..2] init 0;
+        c : [0..3] init 0;
+        [] s=0 -> 0.5:(s'=1)&(c'=min(c+1,3)) + 0.5:(s'=2)&(c'=min(c+1,3));
+        [] s>0 -> 1:(s'=0)&(c'=min(c+1,3));
+    endmodule
+
+    label "done" = s=2;)";
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(programString, "testfile");
+
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program).build();
+    EXPECT_EQ(7ul, model->getNumberOfStates());
+    EXPECT_EQ(10ul, model->getNumberOfTransitions());
+
+    // The counter does not influence the behavior, so all states that only differ in it can be merged.
+    storm::builder::ExplicitModelBuilder<double>::Options options;
+    options.quotientVariables.insert("c");
+    storm::generator::NextStateGeneratorOptions generatorOptions(false, true);
+    model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, options).build();
+    EXPECT_EQ(3ul, model->getNumberOfStates());
+    EXPECT_EQ(4ul, model->getNumberOfTransitions());
+    EXPECT_EQ(1ul, model->getStates("done").getNumberOfSetBits());
+
+    options.quotientVariables.insert("unknown");
+    STORM_SILENT_ASSERT_THROW(storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, options), storm::exceptions::IllegalArgumentException);
+}
+
+TEST(ExplicitPrismModelBuilderTest, QuotientVariablesInLabelsAndRewards) {
+    std::string programString =
+    R"(dtmc
+
+    module main
+        s : [0..2] init 0;
+        c : [0..3] init 0;
+        [] s=0 -> 0.5:(s'=1)&(c'=min(c+1,3)) + 0.5:(s'=2)&(c'=min(c+1,3));
+        [] s>0 -> 1:(s'=0)&(c'=min(c+1,3));
+    endmodule
+
+    label "done" = s=2;
+    label "late" = c=3;
+
+    rewards "steps"
+        s=0 : 1;
+    endrewards
+
+    rewards "counter"
+        true : c;
+    endrewards)";
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(programString, "testfile");
+    storm::builder::ExplicitModelBuilder<double>::Options options;
+    options.quotientVariables.insert("c");
+
+    // The merged states would get the label and the reward of the representative only.
+    storm::generator::NextStateGeneratorOptions allLabels(false, true);
+    STORM_SILENT_ASSERT_THROW(storm::builder::ExplicitModelBuilder<double>(program, allLabels, options), storm::exceptions::IllegalArgumentException);
+
+    storm::generator::NextStateGeneratorOptions counterReward;
+    counterReward.addLabel("done");
+    counterReward.addRewardModel("counter");
+    STORM_SILENT_ASSERT_THROW(storm::builder::ExplicitModelBuilder<double>(program, counterReward, options), storm::exceptions::IllegalArgumentException);
+
+    // Labels and reward models that do not refer to the variable can be built.
+    storm::generator::NextStateGeneratorOptions stepsReward;
+    stepsReward.addLabel("done");
+    stepsReward.addRewardModel("steps");
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, stepsReward, options).build();
+    EXPECT_EQ(3ul, model->getNumberOfStates());
+    EXPECT_TRUE(model->hasRewardModel("steps"));
+    EXPECT_EQ(1ul, model->getStates("done").getNumberOfSetBits());
+}
+
+TEST(ExplicitPrismModelBuilderTest, SymmetryReduction) {
+    std::string programString =
+    R"(mdp
+
+    module process1
+        x1 : [0..2] init 0;
+        [] true -> 1:(x1'=mod(x1+1,3));
+    endmodule
+
+    module process2 = process1 [x1=x2] endmodule
+    module process3 = process1 [x1=x3] endmodule
+
+    label "idle" = x1=0 & x2=0 & x3=0;
+    label "busy" = x1+x2+x3>=5;)";
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(programString, "testfile");
+
+    storm::builder::BuilderOptions options(false, true);
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+    EXPECT_EQ(27ul, model->getNumberOfStates());
+    EXPECT_EQ(81ul, model->getNumberOfTransitions());
+
+    // Only the multiset of local states matters, so each state is merged with all permutations of its local states.
+    options.setSymmetryReduction();
+    model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+    EXPECT_EQ(10ul, model->getNumberOfStates());
+    EXPECT_EQ(30ul, model->getNumberOfTransitions());
+    EXPECT_EQ(1ul, model->getStates("idle").getNumberOfSetBits());
+    EXPECT_EQ(2ul, model->getStates("busy").getNumberOfSetBits());
+
+    // A label that distinguishes the processes prevents the reduction.
+    programString += "\n    label \"first\" = x1=1;";
+    program = storm::parser::PrismParser::parseFromString(programString, "testfile");
+    model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+    EXPECT_EQ(27ul, model->getNumberOfStates());
+}
+
+TEST(ExplicitPrismModelBuilderTest, GuardCaching) {
+    // Caching the enabled commands must not change the resulting model.
+    storm::builder::BuilderOptions options(false, true);
+    options.setGuardCaching();
+
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+    EXPECT_EQ(8607ul, model->getNumberOfStates());
+    EXPECT_EQ(15113ul, model->getNumberOfTransitions());
+
+    program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/leader3.nm");
+    model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+    EXPECT_EQ(364ul, model->getNumberOfStates());
+    EXPECT_EQ(654ul, model->getNumberOfTransitions());
+
+    program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/csma2-2.nm");
+    model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+    EXPECT_EQ(1038ul, model->getNumberOfStates());
+    EXPECT_EQ(1282ul, model->getNumberOfTransitions());
+}
+
+TEST(ExplicitPrismModelBuilderTest, TreeCompression) {
+    storm::builder::ExplicitModelBuilder<double>::Options options;
+    options.treeCompression = true;
+
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(false, true), options).build();
+    EXPECT_EQ(8607ul, model->getNumberOfStates());
+    EXPECT_EQ(15113ul, model->getNumberOfTransitions());
+
+    program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/csma2-2.nm");
+    model = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(false, true), options).build();
+    EXPECT_EQ(1038ul, model->getNumberOfStates());
+    EXPECT_EQ(1282ul, model->getNumberOfTransitions());
+    EXPECT_EQ(1ul, model->getInitialStates().getNumberOfSetBits());
+
+    options.quotientVariables.insert("c");
+    STORM_SILENT_ASSERT_THROW(storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(), options), storm::exceptions::NotSupportedException);
+}
+
+TEST(ExplicitPrismModelBuilderTest, DuplicateSuccessors) {
+    // Updates of the same command (and fused commands of a DTMC) that lead to the same state are merged into one entry.
+    std::string programString =
+    R"(dtmc
+
+    module main
+        s : [0..2] init 0;
+        [] s=0 -> 0.3:(s'=1) + 0.2:(s'=1) + 0.5:(s'=2);
+        [] s=0 -> 0.4:(s'=2) + 0.6:(s'=0);
+        [] s>0 -> 1:(s'=s);
+    endmodule
+
+    label "one" = s=1;
+    label "two" = s=2;)";
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(programString, "testfile");
+
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program).build();
+    EXPECT_EQ(3ul, model->getNumberOfStates());
+    EXPECT_EQ(5ul, model->getNumberOfTransitions());
+    uint64_t initialState = *model->getInitialStates().begin();
+    uint64_t stateOne = *model->getStates("one").begin();
+    uint64_t stateTwo = *model->getStates("two").begin();
+    std::map<uint64_t, double> expectedRow = {{initialState, 0.3}, {stateOne, 0.25}, {stateTwo, 0.45}};
+    std::map<uint64_t, double> row;
+    for (auto const& entry : model->getTransitionMatrix().getRow(initialState)) {
+        EXPECT_TRUE(row.empty() || row.rbegin()->first < entry.getColumn());
+        row[entry.getColumn()] = entry.getValue();
+    }
+    ASSERT_EQ(expectedRow.size(), row.size());
+    for (auto const& entry : expectedRow) {
+        EXPECT_NEAR(entry.second, row[entry.first], 1e-12);
+    }
+
+    // In an MDP, the commands yield separate choices.
+    programString.replace(0, 4, "mdp");
+    program = storm::parser::PrismParser::parseFromString(programString, "testfile");
+    model = storm::builder::ExplicitModelBuilder<double>(program).build();
+    EXPECT_EQ(3ul, model->getNumberOfStates());
+    EXPECT_EQ(6ul, model->getNumberOfTransitions());
+    initialState = *model->getInitialStates().begin();
+    stateOne = *model->getStates("one").begin();
+    stateTwo = *model->getStates("two").begin();
+    uint64_t firstChoice = model->getTransitionMatrix().getRowGroupIndices()[initialState];
+    ASSERT_EQ(2ul, model->getTransitionMatrix().getRowGroupSize(initialState));
+    EXPECT_EQ(2ul, model->getTransitionMatrix().getRow(firstChoice).getNumberOfEntries());
+    EXPECT_NEAR(0.5, model->getTransitionMatrix().getRow(firstChoice).begin()->getValue(), 1e-12);
+    EXPECT_EQ(std::min(stateOne, stateTwo), model->getTransitionMatrix().getRow(firstChoice).begin()->getColumn());
+}
@@ -0,0 +1,73 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include "storm/builder/jit/Distribution.h"
+
+namespace {
+    
+    std::vector<std::pair<uint32_t, double>> getEntries(storm::builder::jit::Distribution<uint32_t, double> const& distribution) {
+        std::vector<std::pair<uint32_t, double>> result;
+        for (auto const& entry : distribution) {
+            result.emplace_back(entry.getState(), entry.getValue());
+        }
+        return result;
+    }
+    
+}
+
+TEST(JitDistributionTest, CompressSortedEntries) {
+    storm::builder::jit::Distribution<uint32_t, double> distribution;
+    distribution.add(1, 0.25);
+    distribution.add(3, 0.25);
+    distribution.add(storm::builder::jit::DistributionEntry<uint32_t, double>(4, 0.5));
+    distribution.compress();
+    EXPECT_EQ((std::vector<std::pair<uint32_t, double>>{{1, 0.25}, {3, 0.25}, {4, 0.5}}), getEntries(distribution));
+}
+
+TEST(JitDistributionTest, CompressMergesDuplicates) {
+    // A repeated index at the end of otherwise sorted entries has to be merged.
+    storm::builder::jit::Distribution<uint32_t, double> distribution;
+    distribution.add(1, 0.25);
+    distribution.add(3, 0.25);
+    distribution.add(3, 0.5);
+    distribution.compress();
+    EXPECT_EQ((std::vector<std::pair<uint32_t, double>>{{1, 0.25}, {3, 0.75}}), getEntries(distribution));
+    
+    // The same holds for entries that are added as a whole.
+    distribution.clear();
+    distribution.add(storm::builder::jit::DistributionEntry<uint32_t, double>(2, 0.5));
+    distribution.add(storm::builder::jit::DistributionEntry<uint32_t, double>(2, 0.5));
+    distribution.compress();
+    EXPECT_EQ((std::vector<std::pair<uint32_t, double>>{{2, 1.0}}), getEntries(distribution));
+    
+    // Unsorted entries are sorted and merged.
+    distribution.clear();
+    distribution.add(5, 0.125);
+    distribution.add(0, 0.25);
+    distribution.add(5, 0.125);
+    distribution.add(2, 0.5);
+    distribution.compress();
+    EXPECT_EQ((std::vector<std::pair<uint32_t, double>>{{0, 0.25}, {2, 0.5}, {5, 0.25}}), getEntries(distribution));
+}
+
+TEST(JitDistributionTest, CompressAfterCopyAndMove) {
+    // Copies and moved-to distributions keep track of whether their entries still need to be merged.
+    storm::builder::jit::Distribution<uint32_t, double> distribution;
+    distribution.add(4, 0.5);
+    distribution.add(4, 0.5);
+    
+    storm::builder::jit::Distribution<uint32_t, double> copy(distribution);
+    copy.compress();
+    EXPECT_EQ((std::vector<std::pair<uint32_t, double>>{{4, 1.0}}), getEntries(copy));
+    
+    storm::builder::jit::Distribution<uint32_t, double> moved(std::move(distribution));
+    moved.compress();
+    EXPECT_EQ((std::vector<std::pair<uint32_t, double>>{{4, 1.0}}), getEntries(moved));
+    
+    // Appending another distribution may break the order.
+    storm::builder::jit::Distribution<uint32_t, double> other;
+    other.add(1, 0.5);
+    moved.add(std::move(other));
+    moved.compress();
+    EXPECT_EQ((std::vector<std::pair<uint32_t, double>>{{1, 0.5}, {4, 1.0}}), getEntries(moved));
+}
@@ -27,6 +27,7 @@
 #include "storm/environment/solver/NativeSolverEnvironment.h"
 #include "storm/environment/solver/GmmxxSolverEnvironment.h"
 #include "storm/environment/solver/EigenSolverEnvironment.h"
+#include "storm/environment/solver/TimeBoundedSolverEnvironment.h"
 
 namespace {
     
@@ -49,6 +50,24 @@ namespace {
         }
     };
     
+    class SparseGmmxxGmresIluKrylovEnvironment {
+    public:
+        static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan; // unused for sparse models
+        static const CtmcEngine engine = CtmcEngine::PrismSparse;
+        static const bool isExact = false;
+        typedef double ValueType;
+        typedef storm::models::sparse::Ctmc<ValueType> ModelType;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Gmmxx);
+            env.solver().gmmxx().setMethod(storm::solver::GmmxxLinearEquationSolverMethod::Gmres);
+            env.solver().gmmxx().setPreconditioner(storm::solver::GmmxxLinearEquationSolverPreconditioner::Ilu);
+            env.solver().gmmxx().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+            env.solver().timeBounded().setCtmcMethod(storm::solver::CtmcTransientMethod::Krylov);
+            return env;
+        }
+    };
+    
     class JaniSparseGmmxxGmresIluEnvironment {
     public:
         static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan; // unused for sparse models
@@ -282,6 +301,7 @@ namespace {
   
     typedef ::testing::Types<
             SparseGmmxxGmresIluEnvironment,
+            SparseGmmxxGmresIluKrylovEnvironment,
             JaniSparseGmmxxGmresIluEnvironment,
             JitSparseGmmxxGmresIluEnvironment,
             SparseEigenDGmresEnvironment,
@@ -446,4 +466,74 @@ namespace {
         EXPECT_NEAR(0.404043, result[0], 1e-6);
         EXPECT_NEAR(0.595957, result[1], 1e-6);
     }
+
+    TEST(CtmcCslModelCheckerTest, TransientProbabilitiesSteadyStateDetection) {
+        // A stiff model that requires a large number of iterations without steady-state detection.
+        storm::storage::SparseMatrixBuilder<double> matrixBuilder;
+        matrixBuilder.addNextValue(0, 1, 3000.0);
+        matrixBuilder.addNextValue(1, 0, 2000.0);
+        storm::storage::SparseMatrix<double> matrix = matrixBuilder.build();
+
+        std::vector<double> exitRates = {3000, 2000};
+        storm::storage::BitVector initialStates(2);
+        initialStates.set(0);
+        storm::storage::BitVector phiStates(2);
+        storm::storage::BitVector psiStates(2);
+        storm::Environment env;
+        env.solver().timeBounded().setSteadyStateDetection(true);
+        std::vector<double> result = storm::modelchecker::helper::SparseCtmcCslHelper::computeAllTransientProbabilities(env, matrix, initialStates, phiStates, psiStates, exitRates, 10);
+
+        EXPECT_NEAR(0.4, result[0], 1e-6);
+        EXPECT_NEAR(0.6, result[1], 1e-6);
+    }
+
+    TEST(CtmcCslModelCheckerTest, TransientProbabilitiesSteadyStateDetectionIterations) {
+        // The stiff model from above. Its uniformized chain mixes fast, so only few of the iterations are needed.
+        storm::storage::SparseMatrixBuilder<double> matrixBuilder;
+        matrixBuilder.addNextValue(0, 1, 3000.0);
+        matrixBuilder.addNextValue(1, 0, 2000.0);
+        storm::storage::SparseMatrix<double> matrix = matrixBuilder.build();
+        std::vector<double> exitRates = {3000, 2000};
+        double uniformizationRate = 3060;
+        storm::storage::SparseMatrix<double> uniformizedMatrix = storm::modelchecker::helper::SparseCtmcCslHelper::computeUniformizedMatrix(matrix, storm::storage::BitVector(2, true), uniformizationRate, exitRates);
+        
+        // Compute the probability to be in state 1 at time 10 (backwards).
+        std::vector<double> values = {0.0, 1.0};
+        storm::Environment env;
+        uint64_t iterations = 0;
+        std::vector<double> result = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities(env, uniformizedMatrix, nullptr, 10.0, uniformizationRate, values, 1e-7, &iterations);
+        EXPECT_NEAR(0.6, result[0], 1e-6);
+        
+        env.solver().timeBounded().setSteadyStateDetection(true);
+        uint64_t iterationsWithDetection = 0;
+        result = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities(env, uniformizedMatrix, nullptr, 10.0, uniformizationRate, values, 1e-7, &iterationsWithDetection);
+        EXPECT_NEAR(0.6, result[0], 1e-6);
+        EXPECT_LT(30000ull, iterations);
+        EXPECT_GT(iterations / 100, iterationsWithDetection);
+    }
+
+    TEST(CtmcCslModelCheckerTest, TransientProbabilitiesSteadyStateDetectionSlowMixing) {
+        // State 0 slowly moves to the absorbing state 1, while the fast (unrelated) states 2 and 3 force a high
+        // uniformization rate. Consecutive iterates then differ by less than the precision right from the start, even
+        // though the probability to be in state 1 keeps growing.
+        storm::storage::SparseMatrixBuilder<double> matrixBuilder;
+        matrixBuilder.addNextValue(0, 1, 1e-4);
+        matrixBuilder.addNextValue(2, 3, 1000.0);
+        matrixBuilder.addNextValue(3, 2, 1000.0);
+        storm::storage::SparseMatrix<double> matrix = matrixBuilder.build();
+        std::vector<double> exitRates = {1e-4, 0, 1000, 1000};
+        double uniformizationRate = 1020;
+        storm::storage::SparseMatrix<double> uniformizedMatrix = storm::modelchecker::helper::SparseCtmcCslHelper::computeUniformizedMatrix(matrix, storm::storage::BitVector(4, true), uniformizationRate, exitRates);
+        
+        std::vector<double> values = {0.0, 1.0, 0.0, 0.0};
+        storm::Environment env;
+        env.solver().timeBounded().setSteadyStateDetection(true);
+        uint64_t iterations = 0;
+        std::vector<double> result = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities(env, uniformizedMatrix, nullptr, 1000.0, uniformizationRate, values, 1e-6, &iterations);
+        EXPECT_NEAR(1.0 - std::exp(-0.1), result[0], 1e-6);
+        EXPECT_NEAR(1.0, result[1], 1e-6);
+        EXPECT_NEAR(0.0, result[2], 1e-6);
+        // The detection must not stop before (roughly) the expected number of jumps has been performed.
+        EXPECT_LT(1000000ull, iterations);
+    }
 }
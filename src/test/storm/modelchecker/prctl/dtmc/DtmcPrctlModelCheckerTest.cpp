@@ -715,5 +715,41 @@ namespace {
         EXPECT_NEAR(0.125, result[11], 1e-6);
         EXPECT_NEAR(0, result[12], 1e-6);
     }
+    
+    TEST(DtmcPrctlModelCheckerTest, RelevantStatesUntilProbabilities) {
+        // State 2 can not be reached from state 1, so it is not needed to compute the value of state 1.
+        storm::storage::SparseMatrixBuilder<double> builder(5, 5);
+        builder.addNextValue(0, 1, 0.5);
+        builder.addNextValue(0, 2, 0.5);
+        builder.addNextValue(1, 1, 0.5);
+        builder.addNextValue(1, 3, 0.25);
+        builder.addNextValue(1, 4, 0.25);
+        builder.addNextValue(2, 3, 0.3);
+        builder.addNextValue(2, 4, 0.7);
+        builder.addNextValue(3, 3, 1.0);
+        builder.addNextValue(4, 4, 1.0);
+        storm::storage::SparseMatrix<double> matrix = builder.build();
+        storm::storage::SparseMatrix<double> backwardTransitions = matrix.transpose(true);
+        storm::storage::BitVector phiStates(5, true);
+        storm::storage::BitVector psiStates(5);
+        psiStates.set(3);
+        storm::Environment env;
+        
+        storm::solver::SolveGoal<double> goal;
+        std::vector<double> result = storm::modelchecker::helper::SparseDtmcPrctlHelper<double>::computeUntilProbabilities(env, std::move(goal), matrix, backwardTransitions, phiStates, psiStates, false);
+        EXPECT_NEAR(0.4, result[0], 1e-6);
+        EXPECT_NEAR(0.5, result[1], 1e-6);
+        EXPECT_NEAR(0.3, result[2], 1e-6);
+        
+        storm::storage::BitVector relevantStates(5);
+        relevantStates.set(1);
+        storm::solver::SolveGoal<double> relevantGoal;
+        relevantGoal.setRelevantValues(std::move(relevantStates));
+        result = storm::modelchecker::helper::SparseDtmcPrctlHelper<double>::computeUntilProbabilities(env, std::move(relevantGoal), matrix, backwardTransitions, phiStates, psiStates, false);
+        EXPECT_NEAR(0.5, result[1], 1e-6);
+        // The maybe states 0 and 2 are not reachable from the relevant state, so their values are not computed.
+        EXPECT_EQ(0.0, result[0]);
+        EXPECT_EQ(0.0, result[2]);
+    }
 
 }
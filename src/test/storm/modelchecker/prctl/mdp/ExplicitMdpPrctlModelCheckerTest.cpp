@@ -6,6 +6,7 @@
 #include "storm/solver/StandardMinMaxLinearEquationSolver.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
+#include "storm/modelchecker/prctl/helper/SparseMdpPrctlHelper.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
@@ -197,3 +198,47 @@ TEST(ExplicitMdpPrctlModelCheckerTest, AsynchronousLeader) {
     EXPECT_NEAR(30.0/7.0, quantitativeResult6[0], precision);
 }
 
+TEST(ExplicitMdpPrctlModelCheckerTest, ConditionalProbabilitiesWithNonZeroInitialState) {
+    // State 0 is unreachable, so the initial state 4 gets a different index in the transformed model. In state 4,
+    // the first choice leads to the states 2 (target and condition) and 3 (condition) and the second choice leads to
+    // state 5, which moves to the states 1 (neither target nor condition) and 2.
+    storm::storage::SparseMatrixBuilder<double> builder(0, 6, 0, false, true);
+    builder.newRowGroup(0);
+    builder.addNextValue(0, 0, 1.0);
+    builder.newRowGroup(1);
+    builder.addNextValue(1, 1, 1.0);
+    builder.newRowGroup(2);
+    builder.addNextValue(2, 2, 1.0);
+    builder.newRowGroup(3);
+    builder.addNextValue(3, 3, 1.0);
+    builder.newRowGroup(4);
+    builder.addNextValue(4, 2, 0.5);
+    builder.addNextValue(4, 3, 0.5);
+    builder.addNextValue(5, 5, 1.0);
+    builder.newRowGroup(6);
+    builder.addNextValue(6, 1, 0.5);
+    builder.addNextValue(6, 2, 0.5);
+    storm::storage::SparseMatrix<double> matrix = builder.build();
+    storm::storage::SparseMatrix<double> backwardTransitions = matrix.transpose(true);
+    
+    storm::storage::BitVector targetStates(6);
+    targetStates.set(2);
+    storm::storage::BitVector conditionStates(6);
+    conditionStates.set(2);
+    conditionStates.set(3);
+    storm::storage::BitVector initialStates(6);
+    initialStates.set(4);
+    storm::Environment env;
+    
+    // The second choice reaches the target whenever it satisfies the condition.
+    storm::solver::SolveGoal<double> maxGoal(storm::OptimizationDirection::Maximize);
+    maxGoal.setRelevantValues(storm::storage::BitVector(initialStates));
+    auto result = storm::modelchecker::helper::SparseMdpPrctlHelper<double>::computeConditionalProbabilities(env, std::move(maxGoal), matrix, backwardTransitions, targetStates, conditionStates);
+    EXPECT_NEAR(1.0, result->asExplicitQuantitativeCheckResult<double>()[4], 1e-6);
+    
+    // The first choice always satisfies the condition, but reaches the target only with probability 0.5.
+    storm::solver::SolveGoal<double> minGoal(storm::OptimizationDirection::Minimize);
+    minGoal.setRelevantValues(storm::storage::BitVector(initialStates));
+    result = storm::modelchecker::helper::SparseMdpPrctlHelper<double>::computeConditionalProbabilities(env, std::move(minGoal), matrix, backwardTransitions, targetStates, conditionStates);
+    EXPECT_NEAR(0.5, result->asExplicitQuantitativeCheckResult<double>()[4], 1e-6);
+}
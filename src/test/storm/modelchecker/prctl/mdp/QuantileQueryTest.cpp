@@ -1,6 +1,9 @@
 #include "test/storm_gtest.h"
+#include "test/storm_concurrency.h"
 #include "storm-config.h"
 
+#include <algorithm>
+
 #include "test/storm_gtest.h"
 
 #include "storm/api/builder.h"
@@ -13,11 +16,14 @@
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
+#include "storm/modelchecker/prctl/helper/rewardbounded/QuantileHelper.h"
 #include "storm/modelchecker/results/ExplicitParetoCurveCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/logic/Formulas.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/ModelCheckerSettings.h"
 #include "storm/storage/jani/Property.h"
 
 namespace {
@@ -299,4 +305,37 @@ namespace {
         EXPECT_TRUE(compare.first) << compare.second;
     
     }
+    
+    TEST(ConcurrentQuantileQueryTest, resources) {
+        typedef storm::models::sparse::Mdp<double> ModelType;
+        
+        std::string formulasString = "quantile(max GOLD, max GEM, Pmax>0.95 [F{\"gold\"}>=GOLD,{\"gem\"}>=GEM,{\"steps\"}<=100 true]);\n";
+        storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/mdp/quantiles_resources.nm");
+        auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+        auto model = storm::api::buildSparseModel<double>(program, formulas)->as<ModelType>();
+        
+        // The coarse precision forces restarts of the sub-queries which then continue on their reward unfoldings.
+        storm::Environment env;
+        env.solver().setForceSoundness(true);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-1));
+        
+        auto computeQuantile = [&] () {
+            storm::modelchecker::helper::rewardbounded::QuantileHelper<ModelType> helper(*model, formulas.front()->asQuantileFormula());
+            auto result = helper.computeQuantile(env);
+            EXPECT_LT(0ull, helper.getNumberOfPrecisionRefinements());
+            std::sort(result.begin(), result.end());
+            return result;
+        };
+        
+        std::vector<std::vector<double>> expectedResult = {{0, 10}, {1, 9}, {4, 8}, {7, 7}, {8, 4}, {9, 2}, {10, 0}};
+        EXPECT_EQ(expectedResult, computeQuantile());
+        
+        // Both one-dimensional sub-queries depend on the same zero-dimensional sub-query, which is thus requested
+        // by two threads at the same time.
+        storm::test::ConcurrencySetting concurrentSubQueries(storm::settings::mutableModelCheckerSettings(), &storm::settings::modules::ModelCheckerSettings::overrideConcurrentQuantileSubQueriesSet, &storm::settings::modules::ModelCheckerSettings::setNumberOfConcurrentQuantileSubQueryThreads, 2);
+        for (uint64_t numberOfThreads : {2, 4}) {
+            concurrentSubQueries.setNumberOfThreads(numberOfThreads);
+            EXPECT_EQ(expectedResult, computeQuantile()) << numberOfThreads << " threads";
+        }
+    }
 }
@@ -7,6 +7,7 @@
 #include "storm/modelchecker/reachability/SparseDtmcEliminationModelChecker.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/storage/StraightLineProgram.h"
 
 #include "storm/settings/modules/GeneralSettings.h"
 #include "storm/settings/SettingMemento.h"
@@ -56,6 +57,31 @@ TEST(SparseDtmcEliminationModelCheckerTest, Die) {
     EXPECT_NEAR(11.0 / 3.0, quantitativeResult4[0], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
 }
 
+TEST(SparseDtmcEliminationModelCheckerTest, DieStraightLineProgram) {
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel = storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/die.tra", STORM_TEST_RESOURCES_DIR "/lab/die.lab", "", "");
+
+    ASSERT_EQ(abstractModel->getType(), storm::models::ModelType::Dtmc);
+
+    std::shared_ptr<storm::models::sparse::Dtmc<double>> dtmc = abstractModel->as<storm::models::sparse::Dtmc<double>>();
+
+    storm::storage::BitVector phiStates(dtmc->getNumberOfStates(), true);
+    storm::storage::BitVector psiStates = dtmc->getStates("two");
+
+    // Do not carry out any operations on constants, so the program records the complete elimination.
+    storm::storage::StraightLineProgram<double> program(0);
+    std::vector<uint64_t> nodes = storm::modelchecker::SparseDtmcEliminationModelChecker<storm::models::sparse::Dtmc<double>>::computeUntilProbabilitiesAsStraightLineProgram(dtmc->getTransitionMatrix(), dtmc->getBackwardTransitions(), dtmc->getInitialStates(), phiStates, psiStates, program);
+
+    ASSERT_EQ(1ull, nodes.size());
+    EXPECT_FALSE(program.isConstant(nodes.front()));
+    EXPECT_NEAR(1.0 / 6.0, program.toValues(nodes).front(), storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+
+    // The program is evaluated anew for other values of the constants (here: halving every coin flip).
+    std::vector<double> evaluated = program.evaluate<double>(nodes, [] (double const& value) { return value == 0.5 ? 0.25 : value; });
+    EXPECT_GT(std::abs(evaluated.front() - 1.0 / 6.0), 0.01);
+    evaluated = program.evaluate<double>(nodes, [] (double const& value) { return value; });
+    EXPECT_NEAR(1.0 / 6.0, evaluated.front(), storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+}
+
 TEST(SparseDtmcEliminationModelCheckerTest, Crowds) {
     std::shared_ptr<storm::models::sparse::Model<double>> abstractModel = storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/crowds5_5.tra", STORM_TEST_RESOURCES_DIR "/lab/crowds5_5.lab", "", "");
 
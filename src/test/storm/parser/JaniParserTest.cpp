@@ -0,0 +1,14 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+#include "storm-parsers/parser/JaniParser.h"
+#include "storm/storage/jani/Model.h"
+#include "storm/storage/jani/Property.h"
+
+TEST(JaniParser, PropertyCommentTest) {
+    std::pair<storm::jani::Model, std::vector<storm::jani::Property>> result;
+    ASSERT_NO_THROW(result = storm::parser::JaniParser<double>::parse(STORM_TEST_RESOURCES_DIR "/dtmc/comments.jani", true));
+    ASSERT_EQ(1ull, result.second.size());
+    EXPECT_EQ("reach", result.second.front().getName());
+    EXPECT_EQ("Probability to set x", result.second.front().getComment());
+    EXPECT_EQ(1ull, result.first.getNumberOfAutomata());
+}
@@ -0,0 +1,88 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include <cmath>
+#include <memory>
+
+#include "storm/api/simulation.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/simulator/ImportanceSplittingSimulator.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace {
+
+    /*!
+     * Builds a gambler's ruin chain on the states 0, ..., n that moves up with probability p and down otherwise. The
+     * states 0 and n are absorbing, n is labelled with "goal" and the chain starts in state 1.
+     */
+    std::shared_ptr<storm::models::sparse::Dtmc<double>> buildGamblersRuin(uint64_t n, double p) {
+        storm::storage::SparseMatrixBuilder<double> matrixBuilder(n + 1, n + 1, 2 * n);
+        matrixBuilder.addNextValue(0, 0, 1.0);
+        for (uint64_t state = 1; state < n; ++state) {
+            matrixBuilder.addNextValue(state, state - 1, 1.0 - p);
+            matrixBuilder.addNextValue(state, state + 1, p);
+        }
+        matrixBuilder.addNextValue(n, n, 1.0);
+
+        storm::models::sparse::StateLabeling labeling(n + 1);
+        labeling.addLabel("init");
+        labeling.addLabelToState("init", 1);
+        labeling.addLabel("goal");
+        labeling.addLabelToState("goal", n);
+        return std::make_shared<storm::models::sparse::Dtmc<double>>(matrixBuilder.build(), labeling);
+    }
+
+    TEST(ImportanceSplittingSimulatorTest, GamblersRuin) {
+        auto dtmc = buildGamblersRuin(10, 0.2);
+        // The probability to reach state 10 from state 1 is (1 - r) / (1 - r^10) with r = 0.8 / 0.2.
+        double exactProbability = 3.0 / (std::pow(4.0, 10) - 1.0);
+
+        storm::api::ImportanceSplittingOptions options;
+        options.numberOfRuns = 20;
+        options.confidenceLevel = 0.99;
+
+        // The random numbers depend on the standard library, so we do not check the outcome for a single seed but
+        // only statistical properties over several seeds (with generous tolerances).
+        uint64_t numberOfSeeds = 10;
+        uint64_t numberOfCoveringIntervals = 0;
+        double sumOfEstimates = 0.0;
+        double sumOfWidths = 0.0;
+        for (uint64_t seedIndex = 0; seedIndex < numberOfSeeds; ++seedIndex) {
+            // Every run uses its own seed, so we skip the seeds of the runs of the previous estimate.
+            options.seed = seedIndex * options.numberOfRuns;
+            storm::simulator::RareEventEstimate estimate = storm::api::estimateReachabilityProbabilityWithImportanceSplitting(*dtmc, "goal", options);
+            EXPECT_EQ(20ull, estimate.numberOfRuns);
+            EXPECT_LE(estimate.lowerBound, estimate.estimate);
+            EXPECT_GE(estimate.upperBound, estimate.estimate);
+            EXPECT_NEAR(exactProbability, estimate.estimate, 0.5 * exactProbability);
+            if (estimate.lowerBound <= exactProbability && exactProbability <= estimate.upperBound) {
+                ++numberOfCoveringIntervals;
+            }
+            sumOfEstimates += estimate.estimate;
+            sumOfWidths += estimate.upperBound - estimate.lowerBound;
+        }
+        EXPECT_GE(numberOfCoveringIntervals, 8ull);
+        EXPECT_NEAR(exactProbability, sumOfEstimates / numberOfSeeds, 0.1 * exactProbability);
+        // The intervals are considerably tighter than the probability itself.
+        EXPECT_LT(sumOfWidths / numberOfSeeds, 0.5 * exactProbability);
+
+        // The estimate does not depend on the number of threads executing the runs.
+        options.seed = 42;
+        storm::simulator::RareEventEstimate estimate = storm::api::estimateReachabilityProbabilityWithImportanceSplitting(*dtmc, "goal", options);
+        options.numberOfThreads = 4;
+        storm::simulator::RareEventEstimate concurrentEstimate = storm::api::estimateReachabilityProbabilityWithImportanceSplitting(*dtmc, "goal", options);
+        EXPECT_EQ(estimate.estimate, concurrentEstimate.estimate);
+        EXPECT_EQ(estimate.lowerBound, concurrentEstimate.lowerBound);
+        EXPECT_EQ(estimate.upperBound, concurrentEstimate.upperBound);
+    }
+
+    TEST(ImportanceSplittingSimulatorTest, DistanceBasedImportance) {
+        auto dtmc = buildGamblersRuin(5, 0.5);
+        storm::simulator::ImportanceSplittingSimulator<double> simulator(*dtmc, dtmc->getStates("goal"));
+
+        // State 0 cannot reach the goal, state i > 0 has distance 5 - i to it.
+        std::vector<uint64_t> expectedImportance = {0, 0, 1, 2, 3, 4};
+        EXPECT_EQ(expectedImportance, simulator.getImportanceFunction());
+    }
+}
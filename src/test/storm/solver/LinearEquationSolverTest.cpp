@@ -7,6 +7,7 @@
 #include "storm/environment/solver/GmmxxSolverEnvironment.h"
 #include "storm/environment/solver/EigenSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
+#include "storm/environment/solver/MultiplierEnvironment.h"
 
 #include "storm/utility/vector.h"
 namespace {
@@ -122,6 +123,19 @@ namespace {
         }
     };
     
+    class NativeDoubleAggregationDisaggregationEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+            env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::AggregationDisaggregation);
+            env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-10"));
+            return env;
+        }
+    };
+    
     class NativeRationalRationalSearchEnvironment {
     public:
         typedef storm::RationalNumber ValueType;
@@ -281,6 +295,19 @@ namespace {
         }
     };
     
+    class TopologicalDirectDoubleEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Topological);
+            env.solver().topological().setUnderlyingEquationSolverType(storm::solver::EquationSolverType::Native);
+            env.solver().topological().setDirectSccSize(10);
+            return env;
+        }
+    };
+    
     class TopologicalEigenRationalLUEnvironment {
     public:
         typedef storm::RationalNumber ValueType;
@@ -315,6 +342,7 @@ namespace {
             NativeDoubleGaussSeidelEnvironment,
             NativeDoubleSorEnvironment,
             NativeDoubleWalkerChaeEnvironment,
+            NativeDoubleAggregationDisaggregationEnvironment,
             NativeRationalRationalSearchEnvironment,
             EliminationRationalEnvironment,
             GmmGmresIluEnvironment,
@@ -327,6 +355,7 @@ namespace {
             EigenBicgstabNoneEnvironment,
             EigenDoubleLUEnvironment,
             EigenRationalLUEnvironment,
+            TopologicalDirectDoubleEnvironment,
             TopologicalEigenRationalLUEnvironment
     > TestingTypes;
     
@@ -369,4 +398,44 @@ namespace {
         EXPECT_NEAR(x[1], this->parseNumber("457/9"), this->precision());
         EXPECT_NEAR(x[2], this->parseNumber("875/18"), this->precision());
     }
+    TEST(LinearEquationSolverTest, CompressedMultiplierReleasesMatrix) {
+        storm::storage::SparseMatrixBuilder<double> builder;
+        ASSERT_NO_THROW(builder.addNextValue(0, 0, 0.2));
+        ASSERT_NO_THROW(builder.addNextValue(0, 1, 0.4));
+        ASSERT_NO_THROW(builder.addNextValue(0, 2, 0.4));
+        ASSERT_NO_THROW(builder.addNextValue(1, 0, 0.02));
+        ASSERT_NO_THROW(builder.addNextValue(1, 1, 0.96));
+        ASSERT_NO_THROW(builder.addNextValue(1, 2, 0.02));
+        ASSERT_NO_THROW(builder.addNextValue(2, 0, 0.4));
+        ASSERT_NO_THROW(builder.addNextValue(2, 1, 0.3));
+        ASSERT_NO_THROW(builder.addNextValue(2, 2, 0.0));
+        storm::storage::SparseMatrix<double> A;
+        ASSERT_NO_THROW(A = builder.build());
+        std::vector<double> b = {3.0, -0.01, 12.0};
+
+        storm::Environment env = NativeDoublePowerEnvironment::createEnvironment();
+        env.solver().multiplier().setType(storm::solver::MultiplierType::Compressed);
+        storm::Environment soundEnv = NativeDoubleSoundValueIterationEnvironment::createEnvironment();
+
+        // The solver owns the matrix, so it releases the matrix after compressing it.
+        auto solver = storm::solver::GeneralLinearEquationSolverFactory<double>().create(env, std::move(A));
+        solver->setBounds(-100.0, 100.0);
+        std::vector<double> x(3);
+        ASSERT_NO_THROW(solver->solveEquations(env, x, b));
+        EXPECT_NEAR(481.0 / 9.0, x[0], 1e-6);
+        EXPECT_NEAR(457.0 / 9.0, x[1], 1e-6);
+        EXPECT_NEAR(875.0 / 18.0, x[2], 1e-6);
+
+        // Solving again reuses the compressed matrix.
+        std::vector<double> y(3);
+        ASSERT_NO_THROW(solver->solveEquations(env, y, b));
+        EXPECT_NEAR(x[0], y[0], 1e-6);
+
+        // Methods that access the matrix directly restore it.
+        std::vector<double> z(3);
+        ASSERT_NO_THROW(solver->solveEquations(soundEnv, z, b));
+        EXPECT_NEAR(x[0], z[0], 1e-5);
+        EXPECT_NEAR(x[1], z[1], 1e-5);
+        EXPECT_NEAR(x[2], z[2], 1e-5);
+    }
 }
\ No newline at end of file
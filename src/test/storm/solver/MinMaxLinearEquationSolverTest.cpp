@@ -7,6 +7,7 @@
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
+#include "storm/environment/solver/MultiplierEnvironment.h"
 #include "storm/solver/SolverSelectionOptions.h"
 #include "storm/storage/SparseMatrix.h"
 
@@ -76,6 +77,20 @@ namespace {
         }
     };
     
+    class DoubleTopologicalDirectEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::Topological);
+            env.solver().topological().setUnderlyingMinMaxMethod(storm::solver::MinMaxMethod::ValueIteration);
+            env.solver().topological().setDirectSccSize(10);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+            return env;
+        }
+    };
+    
     class DoubleTopologicalCudaViEnvironment {
     public:
         typedef double ValueType;
@@ -140,6 +155,7 @@ namespace {
             DoubleIntervalIterationEnvironment,
             DoubleOptimisticViEnvironment,
             DoubleTopologicalViEnvironment,
+            DoubleTopologicalDirectEnvironment,
             DoubleTopologicalCudaViEnvironment,
             DoublePIEnvironment,
             RationalPIEnvironment,
@@ -175,6 +191,43 @@ namespace {
         ASSERT_NO_THROW(solver->solveEquations(this->env(), storm::OptimizationDirection::Maximize, x, b));
         EXPECT_NEAR(x[0], this->parseNumber("0.99"), this->precision());
     }
+
+    TEST(MinMaxLinearEquationSolverTest, CompressedMultiplierReleasesMatrix) {
+        storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+        ASSERT_NO_THROW(builder.newRowGroup(0));
+        ASSERT_NO_THROW(builder.addNextValue(0, 0, 0.9));
+        ASSERT_NO_THROW(builder.newRowGroup(2));
+        ASSERT_NO_THROW(builder.addNextValue(2, 0, 0.5));
+        storm::storage::SparseMatrix<double> A;
+        ASSERT_NO_THROW(A = builder.build(3));
+        std::vector<double> b = {0.099, 0.5, 0.0};
+
+        storm::Environment env = DoubleViEnvironment::createEnvironment();
+        env.solver().multiplier().setType(storm::solver::MultiplierType::Compressed);
+        storm::Environment piEnv = DoublePIEnvironment::createEnvironment();
+
+        // The solver owns the matrix, so it releases the matrix after compressing it.
+        auto solver = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>().create(env, std::move(A));
+        solver->setHasUniqueSolution(true);
+        solver->setHasNoEndComponents(true);
+        solver->setBounds(0.0, 2.0);
+        solver->setTrackScheduler(true);
+        std::vector<double> x(2);
+        ASSERT_NO_THROW(solver->solveEquations(env, storm::OptimizationDirection::Minimize, x, b));
+        EXPECT_NEAR(0.5, x[0], 1e-6);
+        EXPECT_NEAR(0.25, x[1], 1e-6);
+        EXPECT_EQ(1ull, solver->getSchedulerChoices()[0]);
+        ASSERT_NO_THROW(solver->solveEquations(env, storm::OptimizationDirection::Maximize, x, b));
+        EXPECT_NEAR(0.99, x[0], 1e-6);
+        EXPECT_NEAR(0.495, x[1], 1e-6);
+        EXPECT_EQ(0ull, solver->getSchedulerChoices()[0]);
+
+        // Policy iteration accesses the matrix directly, which restores it.
+        std::vector<double> y(2);
+        ASSERT_NO_THROW(solver->solveEquations(piEnv, storm::OptimizationDirection::Maximize, y, b));
+        EXPECT_NEAR(x[0], y[0], 1e-6);
+        EXPECT_NEAR(x[1], y[1], 1e-6);
+    }
 }
 
 
@@ -31,6 +31,17 @@ namespace {
         }
     };
     
+    class CompressedEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().multiplier().setType(storm::solver::MultiplierType::Compressed);
+            return env;
+        }
+    };
+    
     template<typename TestType>
     class MultiplierTest : public ::testing::Test {
     public:
@@ -45,7 +56,8 @@ namespace {
   
     typedef ::testing::Types<
             NativeEnvironment,
-            GmmxxEnvironment
+            GmmxxEnvironment,
+            CompressedEnvironment
     > TestingTypes;
     
     TYPED_TEST_SUITE(MultiplierTest, TestingTypes,);
@@ -120,4 +132,4 @@ namespace {
         EXPECT_NEAR(x[0], this->parseNumber("0.923808265834023387639"), this->precision());
     }
     
-}
\ No newline at end of file
+}
@@ -0,0 +1,65 @@
+#include "test/storm_gtest.h"
+
+#include <cstdint>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorTreeTable.h"
+
+TEST(BitVectorTreeTableTest, FindOrAdd) {
+    storm::storage::BitVectorTreeTable table(200);
+
+    storm::storage::BitVector first(200);
+    first.set(4);
+    first.set(130);
+    first.set(199);
+
+    storm::storage::BitVector second(first);
+    second.set(70);
+
+    std::pair<uint64_t, bool> result = table.findOrAdd(first);
+    EXPECT_EQ(0ul, result.first);
+    EXPECT_TRUE(result.second);
+
+    result = table.findOrAdd(second);
+    EXPECT_EQ(1ul, result.first);
+    EXPECT_TRUE(result.second);
+
+    result = table.findOrAdd(first);
+    EXPECT_EQ(0ul, result.first);
+    EXPECT_FALSE(result.second);
+    EXPECT_EQ(2ul, table.size());
+
+    EXPECT_TRUE(table.contains(second));
+    EXPECT_EQ(1ul, table.getValue(second));
+
+    storm::storage::BitVector third(200);
+    EXPECT_FALSE(table.contains(third));
+
+    EXPECT_EQ(first, table.getBitVector(0));
+    EXPECT_EQ(second, table.getBitVector(1));
+}
+
+TEST(BitVectorTreeTableTest, Sharing) {
+    storm::storage::BitVectorTreeTable table(256);
+
+    // All bit vectors only differ in their first chunk, so the other chunks are stored only once.
+    for (uint64_t value = 0; value < 100; ++value) {
+        storm::storage::BitVector bitVector(256);
+        bitVector.setFromInt(0, 64, value);
+        bitVector.set(200);
+        EXPECT_EQ(value, table.findOrAdd(bitVector).first);
+    }
+    EXPECT_EQ(100ul, table.size());
+    // 100 nodes for the first leaf, one for each of the three other leaves, 100 for the parent of the first two
+    // leaves, one for the parent of the last two leaves and 100 roots.
+    EXPECT_EQ(304ul, table.getNumberOfNodes());
+
+    uint64_t index = 0;
+    for (auto const& bitVectorIndexPair : table) {
+        EXPECT_EQ(index, bitVectorIndexPair.second);
+        EXPECT_EQ(index, bitVectorIndexPair.first.getAsInt(0, 64));
+        EXPECT_TRUE(bitVectorIndexPair.first.get(200));
+        ++index;
+    }
+    EXPECT_EQ(100ul, index);
+}
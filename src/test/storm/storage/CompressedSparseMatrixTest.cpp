@@ -0,0 +1,117 @@
+#include "test/storm_gtest.h"
+
+#include <algorithm>
+#include <cstdint>
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/CompressedSparseMatrix.h"
+#include "storm/storage/BitVector.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+
+TEST(CompressedSparseMatrixTest, SmallDictionary) {
+    storm::storage::SparseMatrixBuilder<double> builder(3, 200000, 5);
+    ASSERT_NO_THROW(builder.addNextValue(0, 1, 0.5));
+    ASSERT_NO_THROW(builder.addNextValue(0, 199999, 0.5));
+    ASSERT_NO_THROW(builder.addNextValue(2, 0, 0.25));
+    ASSERT_NO_THROW(builder.addNextValue(2, 127, 0.25));
+    ASSERT_NO_THROW(builder.addNextValue(2, 128, 0.5));
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = builder.build());
+
+    auto compressedMatrix = storm::storage::CompressedSparseMatrix<double>::compress(matrix);
+    ASSERT_TRUE(static_cast<bool>(compressedMatrix));
+    storm::storage::CompressedSparseMatrix<double> const& compressed = compressedMatrix.get();
+    EXPECT_EQ(3ul, compressed.getRowCount());
+    EXPECT_EQ(200000ul, compressed.getColumnCount());
+    EXPECT_EQ(5ul, compressed.getEntryCount());
+    EXPECT_EQ(2ul, compressed.getNumberOfDistinctValues());
+
+    for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+        auto compressedRow = compressed.getRow(row);
+        ASSERT_EQ(matrix.getRow(row).getNumberOfEntries(), compressedRow.size());
+        auto entryIt = compressedRow.begin();
+        for (auto const& entry : matrix.getRow(row)) {
+            EXPECT_EQ(entry.getColumn(), entryIt->getColumn());
+            EXPECT_EQ(entry.getValue(), entryIt->getValue());
+            ++entryIt;
+        }
+    }
+
+    std::vector<double> x(200000, 0.0);
+    x[1] = 1.0;
+    x[127] = 2.0;
+    x[128] = 4.0;
+    x[199999] = 3.0;
+    EXPECT_EQ(2.0, compressed.multiplyRowWithVector(0, x));
+    EXPECT_EQ(0.0, compressed.multiplyRowWithVector(1, x));
+    EXPECT_EQ(2.5, compressed.multiplyRowWithVector(2, x));
+}
+
+TEST(CompressedSparseMatrixTest, LargeDictionary) {
+    // More than 256 distinct values require codes with two bytes.
+    uint64_t size = 1000;
+    storm::storage::SparseMatrixBuilder<double> builder(size, size, 2 * size);
+    for (uint64_t row = 0; row < size; ++row) {
+        uint64_t successor = (row * 7 + 1) % size;
+        ASSERT_NO_THROW(builder.addNextValue(row, std::min(row, successor), 1.0 / (row + 2)));
+        ASSERT_NO_THROW(builder.addNextValue(row, std::max(row, successor), 1.0 - 1.0 / (row + 2)));
+    }
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = builder.build());
+
+    storm::storage::CompressedSparseMatrix<double> compressed(matrix);
+    EXPECT_LT(256ul, compressed.getNumberOfDistinctValues());
+
+    std::vector<double> x(size);
+    for (uint64_t i = 0; i < size; ++i) {
+        x[i] = static_cast<double>(i);
+    }
+    std::vector<double> expected(size);
+    matrix.multiplyWithVector(x, expected);
+    for (uint64_t row = 0; row < size; ++row) {
+        EXPECT_NEAR(expected[row], compressed.multiplyRowWithVector(row, x), 1e-12);
+    }
+}
+
+TEST(CompressedSparseMatrixTest, TooManyValues) {
+    uint64_t size = storm::storage::CompressedSparseMatrix<double>::maximalNumberOfDistinctValues + 1;
+    storm::storage::SparseMatrixBuilder<double> builder(size, size, size);
+    for (uint64_t row = 0; row < size; ++row) {
+        ASSERT_NO_THROW(builder.addNextValue(row, row, static_cast<double>(row + 1)));
+    }
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = builder.build());
+
+    EXPECT_FALSE(static_cast<bool>(storm::storage::CompressedSparseMatrix<double>::compress(matrix)));
+    STORM_SILENT_EXPECT_THROW(storm::storage::CompressedSparseMatrix<double> compressed(matrix), storm::exceptions::InvalidArgumentException);
+}
+
+TEST(CompressedSparseMatrixTest, Decompress) {
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    ASSERT_NO_THROW(builder.newRowGroup(0));
+    ASSERT_NO_THROW(builder.addNextValue(0, 0, 0.5));
+    ASSERT_NO_THROW(builder.addNextValue(0, 300, 0.5));
+    ASSERT_NO_THROW(builder.addNextValue(1, 2, 1.0));
+    ASSERT_NO_THROW(builder.newRowGroup(2));
+    ASSERT_NO_THROW(builder.newRowGroup(2));
+    ASSERT_NO_THROW(builder.addNextValue(3, 1, 0.0));
+    ASSERT_NO_THROW(builder.addNextValue(3, 2, 1.0));
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = builder.build(4, 301, 4));
+
+    storm::storage::CompressedSparseMatrix<double> compressed(matrix);
+    EXPECT_FALSE(compressed.hasTrivialRowGrouping());
+    EXPECT_EQ(matrix.getRowGroupIndices(), compressed.getRowGroupIndices());
+    EXPECT_EQ(matrix, compressed.decompress());
+
+    // Trivial row groupings are kept trivial.
+    storm::storage::SparseMatrix<double> submatrix = matrix.getSubmatrix(false, storm::storage::BitVector(4, true), storm::storage::BitVector(301, true));
+    ASSERT_TRUE(submatrix.hasTrivialRowGrouping());
+    storm::storage::CompressedSparseMatrix<double> compressedSubmatrix(submatrix);
+    EXPECT_TRUE(compressedSubmatrix.hasTrivialRowGrouping());
+    EXPECT_EQ(5ul, compressedSubmatrix.getRowGroupIndices().size());
+    storm::storage::SparseMatrix<double> decompressedSubmatrix = compressedSubmatrix.decompress();
+    EXPECT_TRUE(decompressedSubmatrix.hasTrivialRowGrouping());
+    EXPECT_EQ(submatrix, decompressedSubmatrix);
+}
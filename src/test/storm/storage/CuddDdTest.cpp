@@ -8,8 +8,10 @@
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/storage/expressions/Expression.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CuddSettings.h"
 
 #include "storm/storage/SparseMatrix.h"
+#include "storm/utility/dd.h"
 
 TEST(CuddDd, AddConstants) {
     std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
@@ -778,3 +780,49 @@ TEST(CuddDd, BddToExpressionTest) {
     
     auto result = bdd.toExpression(*manager);
 }
+
+TEST(CuddDd, PartitionedReachabilityTest) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 0, 3);
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> y = manager->addMetaVariable("y", 0, 3);
+    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> rowColumnMetaVariablePairs = {x, y};
+    
+    // Both variables are counted up independently of each other.
+    storm::dd::Bdd<storm::dd::DdType::CUDD> xTransitions = manager->getBddZero();
+    storm::dd::Bdd<storm::dd::DdType::CUDD> yTransitions = manager->getBddZero();
+    for (int_fast64_t value = 0; value < 3; ++value) {
+        xTransitions |= manager->getEncoding(x.first, value) && manager->getEncoding(x.second, value + 1);
+        yTransitions |= manager->getEncoding(y.first, value) && manager->getEncoding(y.second, value + 1);
+    }
+    // The x part leaves y unchanged by not mentioning it, the y part carries the identity of x explicitly.
+    yTransitions &= manager->getIdentity(x.first, x.second);
+    
+    storm::dd::Bdd<storm::dd::DdType::CUDD> initialStates = manager->getEncoding(x.first, 0) && manager->getEncoding(y.first, 0);
+    storm::dd::Bdd<storm::dd::DdType::CUDD> allStates = manager->getRange(x.first) && manager->getRange(y.first);
+    std::vector<storm::dd::Bdd<storm::dd::DdType::CUDD>> transitionParts = {xTransitions, yTransitions};
+    
+    for (auto method : {storm::utility::dd::ReachabilityMethod::Monolithic, storm::utility::dd::ReachabilityMethod::Chaining, storm::utility::dd::ReachabilityMethod::Saturation}) {
+        storm::dd::Bdd<storm::dd::DdType::CUDD> reachableStates = storm::utility::dd::computeReachableStates(initialStates, transitionParts, rowColumnMetaVariablePairs, method).first;
+        EXPECT_EQ(16ul, reachableStates.getNonZeroCount());
+        EXPECT_TRUE(reachableStates == allStates);
+    }
+}
+
+TEST(CuddDd, Statistics) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 0, 9);
+    storm::dd::Bdd<storm::dd::DdType::CUDD> range = manager->getRange(x.first) && manager->getRange(x.second);
+    EXPECT_EQ(100ul, range.getNonZeroCount());
+    
+    storm::dd::DdManagerStatistics statistics = manager->getStatistics();
+    EXPECT_LE(range.getNodeCount(), statistics.numberOfNodes);
+    EXPECT_LE(statistics.numberOfNodes, statistics.peakNumberOfNodes);
+    // The few nodes of this manager do not trigger a garbage collection.
+    EXPECT_EQ(0ul, statistics.garbageCollections);
+    ASSERT_TRUE(static_cast<bool>(statistics.memoryLimit));
+    EXPECT_EQ(storm::settings::getModule<storm::settings::modules::CuddSettings>().getMaximalMemory() * 1024ul * 1024ul, statistics.memoryLimit.get());
+    // CUDD counts the lookups in its computed table.
+    ASSERT_TRUE(static_cast<bool>(statistics.cacheLookups));
+    ASSERT_TRUE(static_cast<bool>(statistics.cacheHits));
+    EXPECT_LE(statistics.cacheHits.get(), statistics.cacheLookups.get());
+}
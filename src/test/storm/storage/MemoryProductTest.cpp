@@ -0,0 +1,138 @@
+#include "test/storm_gtest.h"
+#include "test/storm_concurrency.h"
+#include "storm-config.h"
+
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/api/builder.h"
+#include "storm/api/properties.h"
+#include "storm/api/verification.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/BuildSettings.h"
+#include "storm/storage/memorystructure/MemoryStructureBuilder.h"
+#include "storm/storage/memorystructure/NondeterministicMemoryStructureBuilder.h"
+#include "storm/storage/memorystructure/SparseModelMemoryProduct.h"
+#include "storm/storage/memorystructure/SparseModelNondeterministicMemoryProduct.h"
+
+namespace {
+
+    std::shared_ptr<storm::models::sparse::Model<double>> buildModel(std::string const& programFile) {
+        storm::prism::Program program = storm::api::parseProgram(programFile);
+        return storm::api::buildSparseModel<double>(program, storm::builder::BuilderOptions(true, true));
+    }
+
+    /*!
+     * Builds a memory structure that tracks whether the number of visited even model states is even or odd.
+     */
+    storm::storage::MemoryStructure buildParityMemory(storm::models::sparse::Model<double> const& model) {
+        storm::storage::BitVector evenStates(model.getNumberOfStates());
+        for (uint64_t state = 0; state < model.getNumberOfStates(); state += 2) {
+            evenStates.set(state);
+        }
+        storm::storage::MemoryStructureBuilder<double> builder(2, model);
+        builder.setTransition(0, 1, evenStates);
+        builder.setTransition(0, 0, ~evenStates);
+        builder.setTransition(1, 0, evenStates);
+        builder.setTransition(1, 1, ~evenStates);
+        return builder.build();
+    }
+
+    /*!
+     * Checks the given formula on the given model and returns the value of the (unique) initial state.
+     */
+    double checkInitialState(std::shared_ptr<storm::models::sparse::Model<double>> const& model, std::string const& formulaAsString) {
+        auto formula = storm::api::extractFormulasFromProperties(storm::api::parseProperties(formulaAsString)).front();
+        auto result = storm::api::verifyWithSparseEngine<double>(model, storm::api::createTask<double>(formula, true));
+        return result->asExplicitQuantitativeCheckResult<double>()[*model->getInitialStates().begin()];
+    }
+
+    /*!
+     * Builds the transition matrix of the nondeterministic memory product row by row, i.e., without precomputing the
+     * row indications. Product state (s, m) has index s * |M| + m.
+     */
+    storm::storage::SparseMatrix<double> buildReferenceNondeterministicProductMatrix(storm::models::sparse::Mdp<double> const& mdp, storm::storage::NondeterministicMemoryStructure const& memory) {
+        storm::storage::SparseMatrix<double> const& modelMatrix = mdp.getTransitionMatrix();
+        uint64_t numberOfMemoryStates = memory.getNumberOfStates();
+        uint64_t numberOfProductStates = mdp.getNumberOfStates() * numberOfMemoryStates;
+        storm::storage::SparseMatrixBuilder<double> builder(0, numberOfProductStates, 0, true, true, numberOfProductStates);
+        uint64_t row = 0;
+        for (uint64_t modelState = 0; modelState < mdp.getNumberOfStates(); ++modelState) {
+            for (uint64_t memoryState = 0; memoryState < numberOfMemoryStates; ++memoryState) {
+                builder.newRowGroup(row);
+                for (uint64_t modelRow = modelMatrix.getRowGroupIndices()[modelState]; modelRow < modelMatrix.getRowGroupIndices()[modelState + 1]; ++modelRow) {
+                    for (auto const& memorySuccessor : memory.getTransitions(memoryState)) {
+                        for (auto const& entry : modelMatrix.getRow(modelRow)) {
+                            builder.addNextValue(row, entry.getColumn() * numberOfMemoryStates + memorySuccessor, entry.getValue());
+                        }
+                        ++row;
+                    }
+                }
+            }
+        }
+        return builder.build();
+    }
+
+    std::unique_ptr<storm::test::ConcurrencySetting> enableConcurrentProduct(uint64_t numberOfThreads) {
+        return std::make_unique<storm::test::ConcurrencySetting>(storm::settings::mutableBuildSettings(), &storm::settings::modules::BuildSettings::overrideConcurrentProductSet, &storm::settings::modules::BuildSettings::setNumberOfConcurrentProductThreads, numberOfThreads);
+    }
+
+    TEST(MemoryProductTest, ConcurrentProduct) {
+        for (std::string const& programFile : {STORM_TEST_RESOURCES_DIR "/dtmc/brp-16-2.pm", STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm"}) {
+            auto model = buildModel(programFile);
+            storm::storage::MemoryStructure memory = buildParityMemory(*model);
+
+            auto sequentialProduct = memory.product(*model).build();
+            std::shared_ptr<storm::models::sparse::Model<double>> concurrentProduct;
+            {
+                auto concurrent = enableConcurrentProduct(4);
+                concurrentProduct = memory.product(*model).build();
+            }
+
+            EXPECT_EQ(model->getType(), concurrentProduct->getType()) << programFile;
+            EXPECT_LT(model->getNumberOfStates(), sequentialProduct->getNumberOfStates()) << programFile;
+            EXPECT_EQ(sequentialProduct->getNumberOfStates(), concurrentProduct->getNumberOfStates()) << programFile;
+            EXPECT_TRUE(sequentialProduct->getTransitionMatrix() == concurrentProduct->getTransitionMatrix()) << programFile;
+        }
+    }
+
+    TEST(MemoryProductTest, ConcurrentProductPreservesResults) {
+        // The memory does not restrict the behavior of the model, so the product has to yield the same values as the model itself.
+        std::vector<std::pair<std::string, std::vector<std::string>>> programsAndFormulas = {
+            {STORM_TEST_RESOURCES_DIR "/dtmc/brp-16-2.pm", {"P=? [F \"target\"]"}},
+            {STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm", {"Pmin=? [F \"finished\" & \"all_coins_equal_1\"]", "Pmax=? [F \"finished\" & \"all_coins_equal_1\"]"}}
+        };
+        for (auto const& programAndFormulas : programsAndFormulas) {
+            auto model = buildModel(programAndFormulas.first);
+            storm::storage::MemoryStructure memory = buildParityMemory(*model);
+            std::shared_ptr<storm::models::sparse::Model<double>> concurrentProduct;
+            {
+                auto concurrent = enableConcurrentProduct(3);
+                concurrentProduct = memory.product(*model).build();
+            }
+            for (auto const& formulaAsString : programAndFormulas.second) {
+                EXPECT_NEAR(checkInitialState(model, formulaAsString), checkInitialState(concurrentProduct, formulaAsString), 1e-5) << formulaAsString;
+            }
+        }
+    }
+
+    TEST(MemoryProductTest, ConcurrentNondeterministicProduct) {
+        auto mdp = buildModel(STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm")->as<storm::models::sparse::Mdp<double>>();
+        storm::storage::NondeterministicMemoryStructure memory = storm::storage::NondeterministicMemoryStructureBuilder().build(storm::storage::NondeterministicMemoryStructurePattern::Full, 3);
+
+        auto sequentialProduct = storm::storage::SparseModelNondeterministicMemoryProduct<storm::models::sparse::Mdp<double>>(*mdp, memory).build();
+        std::shared_ptr<storm::models::sparse::Mdp<double>> concurrentProduct;
+        {
+            auto concurrent = enableConcurrentProduct(4);
+            concurrentProduct = storm::storage::SparseModelNondeterministicMemoryProduct<storm::models::sparse::Mdp<double>>(*mdp, memory).build();
+        }
+
+        // Each choice of the model is available once per memory successor.
+        EXPECT_EQ(3 * mdp->getNumberOfStates(), sequentialProduct->getNumberOfStates());
+        EXPECT_EQ(9 * mdp->getNumberOfChoices(), sequentialProduct->getNumberOfChoices());
+        EXPECT_TRUE(sequentialProduct->getTransitionMatrix() == concurrentProduct->getTransitionMatrix());
+        EXPECT_TRUE(buildReferenceNondeterministicProductMatrix(*mdp, memory) == concurrentProduct->getTransitionMatrix());
+    }
+}
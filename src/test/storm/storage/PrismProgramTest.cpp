@@ -140,6 +140,17 @@ TEST(PrismProgramTest, FlattenModules_Dice_Z3) {
     EXPECT_EQ(1ull, program.getNumberOfModules());
     EXPECT_EQ(16ull, program.getModule(0).getNumberOfCommands());
 }
+
+TEST(PrismProgramTest, FlattenModules_Firewire_Z3_Threads) {
+    storm::prism::Program program;
+    ASSERT_NO_THROW(program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/firewire.nm"));
+    
+    std::shared_ptr<storm::utility::solver::SmtSolverFactory> smtSolverFactory = std::make_shared<storm::utility::solver::Z3SmtSolverFactory>();
+    
+    ASSERT_NO_THROW(program = program.substituteFormulas().flattenModules(smtSolverFactory, 4));
+    EXPECT_EQ(1ull, program.getNumberOfModules());
+    EXPECT_EQ(5024ull, program.getModule(0).getNumberOfCommands());
+}
 #endif
 
 TEST(PrismProgramTest, ConvertToJani) {
@@ -8,8 +8,10 @@
 #include "storm/storage/dd/Odd.h"
 #include "storm/storage/dd/DdMetaVariable.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/SylvanSettings.h"
 
 #include "storm/storage/SparseMatrix.h"
+#include "storm/utility/dd.h"
 
 #include <memory>
 #include <iostream>
@@ -954,3 +956,65 @@ TEST(SylvanDd, BddToExpressionTest) {
     
     auto result = bdd.toExpression(*manager);
 }
+
+TEST(SylvanDd, PartitionedReachabilityTest) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 0, 3);
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> y = manager->addMetaVariable("y", 0, 3);
+    std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> rowColumnMetaVariablePairs = {x, y};
+    
+    // Both variables are counted up independently of each other.
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> xTransitions = manager->getBddZero();
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> yTransitions = manager->getBddZero();
+    for (int_fast64_t value = 0; value < 3; ++value) {
+        xTransitions |= manager->getEncoding(x.first, value) && manager->getEncoding(x.second, value + 1);
+        yTransitions |= manager->getEncoding(y.first, value) && manager->getEncoding(y.second, value + 1);
+    }
+    // The x part leaves y unchanged by not mentioning it, the y part carries the identity of x explicitly.
+    yTransitions &= manager->getIdentity(x.first, x.second);
+    
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> initialStates = manager->getEncoding(x.first, 0) && manager->getEncoding(y.first, 0);
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> allStates = manager->getRange(x.first) && manager->getRange(y.first);
+    std::vector<storm::dd::Bdd<storm::dd::DdType::Sylvan>> transitionParts = {xTransitions, yTransitions};
+    
+    for (auto method : {storm::utility::dd::ReachabilityMethod::Monolithic, storm::utility::dd::ReachabilityMethod::Chaining, storm::utility::dd::ReachabilityMethod::Saturation}) {
+        storm::dd::Bdd<storm::dd::DdType::Sylvan> reachableStates = storm::utility::dd::computeReachableStates(initialStates, transitionParts, rowColumnMetaVariablePairs, method).first;
+        EXPECT_EQ(16ul, reachableStates.getNonZeroCount());
+        EXPECT_TRUE(reachableStates == allStates);
+    }
+}
+
+TEST(SylvanDd, Statistics) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 0, 9);
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> range = manager->getRange(x.first) && manager->getRange(x.second);
+    EXPECT_EQ(100ul, range.getNonZeroCount());
+    
+    storm::dd::DdManagerStatistics statistics = manager->getStatistics();
+    EXPECT_LE(range.getNodeCount(), statistics.numberOfNodes);
+    EXPECT_LE(statistics.numberOfNodes, statistics.peakNumberOfNodes);
+    // Without the adaptive memory mode, sylvan allocates its tables at their maximal size right away.
+    ASSERT_TRUE(static_cast<bool>(statistics.maximalTableSize));
+    ASSERT_TRUE(static_cast<bool>(statistics.maximalCacheSize));
+    EXPECT_EQ(statistics.maximalTableSize.get(), statistics.tableSize);
+    EXPECT_EQ(statistics.maximalCacheSize.get(), statistics.cacheSize);
+    ASSERT_TRUE(static_cast<bool>(statistics.memoryLimit));
+    EXPECT_EQ(storm::settings::getModule<storm::settings::modules::SylvanSettings>().getMaximalMemory() * 1024ul * 1024ul, statistics.memoryLimit.get());
+    // Every bucket takes at least one byte and the tables are doubled as long as they fit into the memory limit.
+    EXPECT_LE(statistics.tableSize + statistics.cacheSize, statistics.memoryInUse);
+    EXPECT_LE(statistics.memoryInUse, statistics.memoryLimit.get());
+    EXPECT_LT(statistics.memoryLimit.get() / 2, statistics.memoryInUse);
+    // Sylvan does not count the lookups in its operation cache.
+    EXPECT_FALSE(static_cast<bool>(statistics.cacheLookups));
+    
+    // Creating more nodes is reflected in the statistics, whereas the preallocated tables keep their size.
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> y = manager->addMetaVariable("y", 0, 99);
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> largerRange = range && manager->getRange(y.first) && manager->getRange(y.second);
+    EXPECT_EQ(1000000ul, largerRange.getNonZeroCount());
+    storm::dd::DdManagerStatistics laterStatistics = manager->getStatistics();
+    EXPECT_LE(largerRange.getNodeCount(), laterStatistics.numberOfNodes);
+    EXPECT_LT(statistics.numberOfNodes, laterStatistics.numberOfNodes);
+    EXPECT_LE(statistics.peakNumberOfNodes, laterStatistics.peakNumberOfNodes);
+    EXPECT_LE(laterStatistics.numberOfNodes, laterStatistics.peakNumberOfNodes);
+    EXPECT_EQ(statistics.memoryInUse, laterStatistics.memoryInUse);
+}
@@ -0,0 +1,138 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include <chrono>
+
+#include "storm/utility/parallel.h"
+
+#include "storm/api/storm.h"
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/environment/Environment.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/storage/jani/Property.h"
+#include "storm/exceptions/BaseException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace {
+
+    // Checks the given formulas in order on the given number of threads and records the value of the initial state
+    // for every consumed result.
+    std::vector<std::pair<uint64_t, double>> checkInOrder(std::shared_ptr<storm::models::sparse::Dtmc<double>> const& dtmc, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas, uint64_t numberOfThreads) {
+        std::vector<std::pair<uint64_t, double>> consumed;
+        uint64_t initialState = *dtmc->getInitialStates().begin();
+        storm::utility::parallel::computeConcurrentlyInOrder<std::unique_ptr<storm::modelchecker::CheckResult>>(formulas.size(), numberOfThreads, [&dtmc, &formulas] (uint64_t index) {
+            // Concurrent checks must not share the environment.
+            storm::Environment env;
+            return storm::api::verifyWithSparseEngine<double>(env, dtmc, storm::api::createTask<double>(formulas[index], true));
+        }, [&consumed, initialState] (uint64_t index, std::unique_ptr<storm::modelchecker::CheckResult>& result) {
+            consumed.emplace_back(index, result->asExplicitQuantitativeCheckResult<double>()[initialState]);
+        });
+        return consumed;
+    }
+
+    TEST(ParallelTest, ResolveNumberOfThreads) {
+        EXPECT_EQ(3ull, storm::utility::parallel::resolveNumberOfThreads(3));
+        // Zero refers to the number of hardware threads, which is at least one even if it cannot be determined.
+        EXPECT_LE(1ull, storm::utility::parallel::resolveNumberOfThreads(0));
+        EXPECT_EQ(std::max<uint64_t>(std::thread::hardware_concurrency(), 1), storm::utility::parallel::resolveNumberOfThreads(0));
+    }
+
+    TEST(ParallelTest, EntryBalancedBlocks) {
+        // Five row groups with 1, 1, 6, 1 and 1 entries (the third group consists of two rows).
+        std::vector<uint64_t> rowGroupIndices = {0, 1, 2, 4, 5, 6};
+        std::vector<uint64_t> rowIndications = {0, 1, 2, 5, 8, 9, 10};
+        EXPECT_EQ(std::vector<uint64_t>({0, 5}), storm::utility::parallel::computeEntryBalancedBlocks(rowGroupIndices, rowIndications, 1));
+        EXPECT_EQ(std::vector<uint64_t>({0, 3, 5}), storm::utility::parallel::computeEntryBalancedBlocks(rowGroupIndices, rowIndications, 2));
+        // A block ends at the first row group that starts at or after its share of the entries. The large group cannot be split, so some blocks remain empty.
+        EXPECT_EQ(std::vector<uint64_t>({0, 2, 3, 3, 3, 5}), storm::utility::parallel::computeEntryBalancedBlocks(rowGroupIndices, rowIndications, 5));
+
+        // Every row group is processed exactly once, regardless of the number of threads.
+        for (uint64_t numberOfThreads : {1ull, 2ull, 5ull, 8ull}) {
+            std::vector<std::atomic<uint64_t>> processed(rowGroupIndices.size() - 1);
+            storm::utility::parallel::processRowGroupBlocksConcurrently(rowGroupIndices, rowIndications, numberOfThreads, [&processed] (uint64_t first, uint64_t last) {
+                for (uint64_t group = first; group < last; ++group) {
+                    ++processed[group];
+                }
+            });
+            for (auto const& count : processed) {
+                EXPECT_EQ(1ull, count.load());
+            }
+        }
+    }
+
+    TEST(ParallelTest, ComputeConcurrentlyInOrder) {
+        for (uint64_t numberOfThreads : {1ull, 2ull, 4ull, 16ull}) {
+            std::vector<uint64_t> consumed;
+            std::thread::id callingThread = std::this_thread::get_id();
+            storm::utility::parallel::computeConcurrentlyInOrder<uint64_t>(100, numberOfThreads, [] (uint64_t index) {
+                // Let earlier indices take longer such that they tend to finish after later ones.
+                std::this_thread::sleep_for(std::chrono::microseconds((100 - index) * 10));
+                return index * index;
+            }, [&consumed, callingThread] (uint64_t index, uint64_t& result) {
+                EXPECT_EQ(callingThread, std::this_thread::get_id());
+                EXPECT_EQ(index * index, result);
+                consumed.push_back(index);
+            });
+            ASSERT_EQ(100ull, consumed.size());
+            for (uint64_t index = 0; index < consumed.size(); ++index) {
+                EXPECT_EQ(index, consumed[index]);
+            }
+        }
+    }
+
+    TEST(ParallelTest, ComputeConcurrentlyInOrderWithException) {
+        for (uint64_t numberOfThreads : {1ull, 4ull}) {
+            std::vector<uint64_t> consumed;
+            STORM_SILENT_EXPECT_THROW(storm::utility::parallel::computeConcurrentlyInOrder<uint64_t>(20, numberOfThreads, [] (uint64_t index) {
+                STORM_LOG_THROW(index != 7 && index != 12, storm::exceptions::InvalidArgumentException, "Index " << index << " is invalid.");
+                return index;
+            }, [&consumed] (uint64_t index, uint64_t&) {
+                consumed.push_back(index);
+            }), storm::exceptions::InvalidArgumentException);
+            EXPECT_EQ(std::vector<uint64_t>({0, 1, 2, 3, 4, 5, 6}), consumed);
+        }
+    }
+
+    TEST(ParallelTest, ConcurrentPropertiesMatchSequential) {
+        storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+        std::string formulasAsString = "P=? [F \"one\"]; P=? [F \"two\"]; R{\"coin_flips\"}=? [F \"done\"]; P=? [F<=5 \"three\"]; P=? [!\"three\" U \"done\"]";
+        auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+        auto dtmc = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Dtmc<double>>();
+        // Trigger the lazily computed row grouping such that all threads can share the model read-only.
+        dtmc->getTransitionMatrix().getRowGroupIndices();
+
+        auto sequential = checkInOrder(dtmc, formulas, 1);
+        ASSERT_EQ(formulas.size(), sequential.size());
+        EXPECT_NEAR(1.0 / 6.0, sequential[0].second, 1e-6);
+        EXPECT_NEAR(11.0 / 3.0, sequential[2].second, 1e-6);
+        for (uint64_t numberOfThreads : {2ull, 4ull}) {
+            auto concurrent = checkInOrder(dtmc, formulas, numberOfThreads);
+            ASSERT_EQ(sequential.size(), concurrent.size());
+            for (uint64_t index = 0; index < sequential.size(); ++index) {
+                EXPECT_EQ(sequential[index].first, concurrent[index].first);
+                EXPECT_NEAR(sequential[index].second, concurrent[index].second, 1e-10);
+            }
+        }
+
+        // Checking a property that refers to a reward model that does not exist throws. Both sequential and concurrent
+        // checking report the results up to this property and then raise the exception.
+        auto throwingFormulas = formulas;
+        throwingFormulas.insert(throwingFormulas.begin() + 2, storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("R{\"nonexistent\"}=? [F \"done\"]", program)).front());
+        for (uint64_t numberOfThreads : {1ull, 4ull}) {
+            std::vector<std::pair<uint64_t, double>> consumed;
+            uint64_t initialState = *dtmc->getInitialStates().begin();
+            STORM_SILENT_EXPECT_THROW(storm::utility::parallel::computeConcurrentlyInOrder<std::unique_ptr<storm::modelchecker::CheckResult>>(throwingFormulas.size(), numberOfThreads, [&dtmc, &throwingFormulas] (uint64_t index) {
+                storm::Environment env;
+                return storm::api::verifyWithSparseEngine<double>(env, dtmc, storm::api::createTask<double>(throwingFormulas[index], true));
+            }, [&consumed, initialState] (uint64_t index, std::unique_ptr<storm::modelchecker::CheckResult>& result) {
+                consumed.emplace_back(index, result->asExplicitQuantitativeCheckResult<double>()[initialState]);
+            }), storm::exceptions::BaseException);
+            ASSERT_EQ(2ull, consumed.size());
+            for (uint64_t index = 0; index < consumed.size(); ++index) {
+                EXPECT_EQ(sequential[index].first, consumed[index].first);
+                EXPECT_NEAR(sequential[index].second, consumed[index].second, 1e-10);
+            }
+        }
+    }
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+#include "storm/settings/SettingMemento.h"
+
+namespace storm {
+    namespace test {
+        
+        /*!
+         * Enables a concurrency option of a settings module with the given number of threads. As soon as this object
+         * goes out of scope, the option is restored and the number of threads is reset to its default (zero, i.e., as
+         * many as there are hardware threads). This way, tests that fail early do not leak their settings into other tests.
+         */
+        class ConcurrencySetting {
+        public:
+            template<typename SettingsType>
+            ConcurrencySetting(SettingsType& settings, std::unique_ptr<storm::settings::SettingMemento> (SettingsType::*overrideOptionSet)(bool), void (SettingsType::*setNumberOfThreadsOfOption)(uint64_t), uint64_t numberOfThreads) : numberOfThreadsSetter([&settings, setNumberOfThreadsOfOption] (uint64_t value) { (settings.*setNumberOfThreadsOfOption)(value); }) {
+                setNumberOfThreads(numberOfThreads);
+                memento = (settings.*overrideOptionSet)(true);
+            }
+            
+            ConcurrencySetting(ConcurrencySetting const&) = delete;
+            ConcurrencySetting& operator=(ConcurrencySetting const&) = delete;
+            
+            ~ConcurrencySetting() {
+                memento.reset();
+                setNumberOfThreads(0);
+            }
+            
+            void setNumberOfThreads(uint64_t numberOfThreads) {
+                numberOfThreadsSetter(numberOfThreads);
+            }
+            
+        private:
+            std::function<void(uint64_t)> numberOfThreadsSetter;
+            std::unique_ptr<storm::settings::SettingMemento> memento;
+        };
+    }
+}